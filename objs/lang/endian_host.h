@@ -0,0 +1,4 @@
+#ifndef ENDIAN_H
+#define ENDIAN_H
+#define TTD_LITTLE_ENDIAN
+#endif
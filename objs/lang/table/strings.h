@@ -0,0 +1,3205 @@
+/* This file is automatically generated. Do not modify */
+
+#ifndef TABLE_STRINGS_H
+#define TABLE_STRINGS_H
+
+static const StringID STR_NULL = 0x0;
+static const StringID STR_0001_OFF_EDGE_OF_MAP = 0x1;
+static const StringID STR_0002_TOO_CLOSE_TO_EDGE_OF_MAP = 0x2;
+static const StringID STR_0003_NOT_ENOUGH_CASH_REQUIRES = 0x3;
+static const StringID STR_0004 = 0x4;
+static const StringID STR_EMPTY = 0x5;
+static const StringID STR_0007_FLAT_LAND_REQUIRED = 0x6;
+static const StringID STR_0008_WAITING = 0x7;
+static const StringID STR_0009 = 0x8;
+static const StringID STR_EN_ROUTE_FROM = 0x9;
+static const StringID STR_000C_ACCEPTS = 0xA;
+static const StringID STR_000D_ACCEPTS = 0xB;
+static const StringID STR_000E = 0xC;
+static const StringID STR_000F_PASSENGERS = 0xD;
+static const StringID STR_0010_COAL = 0xE;
+static const StringID STR_0011_MAIL = 0xF;
+static const StringID STR_0012_OIL = 0x10;
+static const StringID STR_0013_LIVESTOCK = 0x11;
+static const StringID STR_0014_GOODS = 0x12;
+static const StringID STR_0015_GRAIN = 0x13;
+static const StringID STR_0016_WOOD = 0x14;
+static const StringID STR_0017_IRON_ORE = 0x15;
+static const StringID STR_0018_STEEL = 0x16;
+static const StringID STR_0019_VALUABLES = 0x17;
+static const StringID STR_001A_COPPER_ORE = 0x18;
+static const StringID STR_001B_MAIZE = 0x19;
+static const StringID STR_001C_FRUIT = 0x1A;
+static const StringID STR_001D_DIAMONDS = 0x1B;
+static const StringID STR_001E_FOOD = 0x1C;
+static const StringID STR_001F_PAPER = 0x1D;
+static const StringID STR_0020_GOLD = 0x1E;
+static const StringID STR_0021_WATER = 0x1F;
+static const StringID STR_0022_WHEAT = 0x20;
+static const StringID STR_0023_RUBBER = 0x21;
+static const StringID STR_0024_SUGAR = 0x22;
+static const StringID STR_0025_TOYS = 0x23;
+static const StringID STR_0026_CANDY = 0x24;
+static const StringID STR_0027_COLA = 0x25;
+static const StringID STR_0028_COTTON_CANDY = 0x26;
+static const StringID STR_0029_BUBBLES = 0x27;
+static const StringID STR_002A_TOFFEE = 0x28;
+static const StringID STR_002B_BATTERIES = 0x29;
+static const StringID STR_002C_PLASTIC = 0x2A;
+static const StringID STR_002D_FIZZY_DRINKS = 0x2B;
+static const StringID STR_002E = 0x2C;
+static const StringID STR_002F_PASSENGER = 0x2D;
+static const StringID STR_0030_COAL = 0x2E;
+static const StringID STR_0031_MAIL = 0x2F;
+static const StringID STR_0032_OIL = 0x30;
+static const StringID STR_0033_LIVESTOCK = 0x31;
+static const StringID STR_0034_GOODS = 0x32;
+static const StringID STR_0035_GRAIN = 0x33;
+static const StringID STR_0036_WOOD = 0x34;
+static const StringID STR_0037_IRON_ORE = 0x35;
+static const StringID STR_0038_STEEL = 0x36;
+static const StringID STR_0039_VALUABLES = 0x37;
+static const StringID STR_003A_COPPER_ORE = 0x38;
+static const StringID STR_003B_MAIZE = 0x39;
+static const StringID STR_003C_FRUIT = 0x3A;
+static const StringID STR_003D_DIAMOND = 0x3B;
+static const StringID STR_003E_FOOD = 0x3C;
+static const StringID STR_003F_PAPER = 0x3D;
+static const StringID STR_0040_GOLD = 0x3E;
+static const StringID STR_0041_WATER = 0x3F;
+static const StringID STR_0042_WHEAT = 0x40;
+static const StringID STR_0043_RUBBER = 0x41;
+static const StringID STR_0044_SUGAR = 0x42;
+static const StringID STR_0045_TOY = 0x43;
+static const StringID STR_0046_CANDY = 0x44;
+static const StringID STR_0047_COLA = 0x45;
+static const StringID STR_0048_COTTON_CANDY = 0x46;
+static const StringID STR_0049_BUBBLE = 0x47;
+static const StringID STR_004A_TOFFEE = 0x48;
+static const StringID STR_004B_BATTERY = 0x49;
+static const StringID STR_004C_PLASTIC = 0x4A;
+static const StringID STR_004D_FIZZY_DRINK = 0x4B;
+static const StringID STR_QUANTITY_NOTHING = 0x4C;
+static const StringID STR_QUANTITY_PASSENGERS = 0x4D;
+static const StringID STR_QUANTITY_COAL = 0x4E;
+static const StringID STR_QUANTITY_MAIL = 0x4F;
+static const StringID STR_QUANTITY_OIL = 0x50;
+static const StringID STR_QUANTITY_LIVESTOCK = 0x51;
+static const StringID STR_QUANTITY_GOODS = 0x52;
+static const StringID STR_QUANTITY_GRAIN = 0x53;
+static const StringID STR_QUANTITY_WOOD = 0x54;
+static const StringID STR_QUANTITY_IRON_ORE = 0x55;
+static const StringID STR_QUANTITY_STEEL = 0x56;
+static const StringID STR_QUANTITY_VALUABLES = 0x57;
+static const StringID STR_QUANTITY_COPPER_ORE = 0x58;
+static const StringID STR_QUANTITY_MAIZE = 0x59;
+static const StringID STR_QUANTITY_FRUIT = 0x5A;
+static const StringID STR_QUANTITY_DIAMONDS = 0x5B;
+static const StringID STR_QUANTITY_FOOD = 0x5C;
+static const StringID STR_QUANTITY_PAPER = 0x5D;
+static const StringID STR_QUANTITY_GOLD = 0x5E;
+static const StringID STR_QUANTITY_WATER = 0x5F;
+static const StringID STR_QUANTITY_WHEAT = 0x60;
+static const StringID STR_QUANTITY_RUBBER = 0x61;
+static const StringID STR_QUANTITY_SUGAR = 0x62;
+static const StringID STR_QUANTITY_TOYS = 0x63;
+static const StringID STR_QUANTITY_SWEETS = 0x64;
+static const StringID STR_QUANTITY_COLA = 0x65;
+static const StringID STR_QUANTITY_CANDYFLOSS = 0x66;
+static const StringID STR_QUANTITY_BUBBLES = 0x67;
+static const StringID STR_QUANTITY_TOFFEE = 0x68;
+static const StringID STR_QUANTITY_BATTERIES = 0x69;
+static const StringID STR_QUANTITY_PLASTIC = 0x6A;
+static const StringID STR_QUANTITY_FIZZY_DRINKS = 0x6B;
+static const StringID STR_ABBREV_NOTHING = 0x6C;
+static const StringID STR_ABBREV_PASSENGERS = 0x6D;
+static const StringID STR_ABBREV_COAL = 0x6E;
+static const StringID STR_ABBREV_MAIL = 0x6F;
+static const StringID STR_ABBREV_OIL = 0x70;
+static const StringID STR_ABBREV_LIVESTOCK = 0x71;
+static const StringID STR_ABBREV_GOODS = 0x72;
+static const StringID STR_ABBREV_GRAIN = 0x73;
+static const StringID STR_ABBREV_WOOD = 0x74;
+static const StringID STR_ABBREV_IRON_ORE = 0x75;
+static const StringID STR_ABBREV_STEEL = 0x76;
+static const StringID STR_ABBREV_VALUABLES = 0x77;
+static const StringID STR_ABBREV_COPPER_ORE = 0x78;
+static const StringID STR_ABBREV_MAIZE = 0x79;
+static const StringID STR_ABBREV_FRUIT = 0x7A;
+static const StringID STR_ABBREV_DIAMONDS = 0x7B;
+static const StringID STR_ABBREV_FOOD = 0x7C;
+static const StringID STR_ABBREV_PAPER = 0x7D;
+static const StringID STR_ABBREV_GOLD = 0x7E;
+static const StringID STR_ABBREV_WATER = 0x7F;
+static const StringID STR_ABBREV_WHEAT = 0x80;
+static const StringID STR_ABBREV_RUBBER = 0x81;
+static const StringID STR_ABBREV_SUGAR = 0x82;
+static const StringID STR_ABBREV_TOYS = 0x83;
+static const StringID STR_ABBREV_SWEETS = 0x84;
+static const StringID STR_ABBREV_COLA = 0x85;
+static const StringID STR_ABBREV_CANDYFLOSS = 0x86;
+static const StringID STR_ABBREV_BUBBLES = 0x87;
+static const StringID STR_ABBREV_TOFFEE = 0x88;
+static const StringID STR_ABBREV_BATTERIES = 0x89;
+static const StringID STR_ABBREV_PLASTIC = 0x8A;
+static const StringID STR_ABBREV_FIZZY_DRINKS = 0x8B;
+static const StringID STR_ABBREV_NONE = 0x8C;
+static const StringID STR_ABBREV_ALL = 0x8D;
+static const StringID STR_00AE = 0x8E;
+static const StringID STR_00AF = 0x8F;
+static const StringID STR_00B0_MAP = 0x90;
+static const StringID STR_00B1_GAME_OPTIONS = 0x91;
+static const StringID STR_00B2_MESSAGE = 0x92;
+static const StringID STR_00B3_MESSAGE_FROM = 0x93;
+static const StringID STR_POPUP_CAUTION_CAPTION = 0x94;
+static const StringID STR_00B4_CAN_T_DO_THIS = 0x95;
+static const StringID STR_00B5_CAN_T_CLEAR_THIS_AREA = 0x96;
+static const StringID STR_00B6_ORIGINAL_COPYRIGHT = 0x97;
+static const StringID STR_00B7_VERSION = 0x98;
+static const StringID STR_00BA_COPYRIGHT_OPENTTD = 0x99;
+static const StringID STR_TRANSLATED_BY = 0x9A;
+static const StringID STR_00C5 = 0x9B;
+static const StringID STR_00C6 = 0x9C;
+static const StringID STR_00C7_QUIT = 0x9D;
+static const StringID STR_00C8_YES = 0x9E;
+static const StringID STR_00C9_NO = 0x9F;
+static const StringID STR_00CA_ARE_YOU_SURE_YOU_WANT_TO = 0xA0;
+static const StringID STR_00CB_1 = 0xA1;
+static const StringID STR_00CC_2 = 0xA2;
+static const StringID STR_00CD_3 = 0xA3;
+static const StringID STR_00CE_4 = 0xA4;
+static const StringID STR_00CF_5 = 0xA5;
+static const StringID STR_00D0_NOTHING = 0xA6;
+static const StringID STR_00D1_DARK_BLUE = 0xA7;
+static const StringID STR_00D2_PALE_GREEN = 0xA8;
+static const StringID STR_00D3_PINK = 0xA9;
+static const StringID STR_00D4_YELLOW = 0xAA;
+static const StringID STR_00D5_RED = 0xAB;
+static const StringID STR_00D6_LIGHT_BLUE = 0xAC;
+static const StringID STR_00D7_GREEN = 0xAD;
+static const StringID STR_00D8_DARK_GREEN = 0xAE;
+static const StringID STR_00D9_BLUE = 0xAF;
+static const StringID STR_00DA_CREAM = 0xB0;
+static const StringID STR_00DB_MAUVE = 0xB1;
+static const StringID STR_00DC_PURPLE = 0xB2;
+static const StringID STR_00DD_ORANGE = 0xB3;
+static const StringID STR_00DE_BROWN = 0xB4;
+static const StringID STR_00DF_GREY = 0xB5;
+static const StringID STR_00E0_WHITE = 0xB6;
+static const StringID STR_00E1_TOO_MANY_VEHICLES_IN_GAME = 0xB7;
+static const StringID STR_00E2 = 0xB8;
+static const StringID STR_00E3 = 0xB9;
+static const StringID STR_00E4_LOCATION = 0xBA;
+static const StringID STR_00E5_CONTOURS = 0xBB;
+static const StringID STR_00E6_VEHICLES = 0xBC;
+static const StringID STR_00E7_INDUSTRIES = 0xBD;
+static const StringID STR_00E8_ROUTES = 0xBE;
+static const StringID STR_00E9_VEGETATION = 0xBF;
+static const StringID STR_00EA_OWNERS = 0xC0;
+static const StringID STR_00EB_ROADS = 0xC1;
+static const StringID STR_00EC_RAILROADS = 0xC2;
+static const StringID STR_00ED_STATIONS_AIRPORTS_DOCKS = 0xC3;
+static const StringID STR_00EE_BUILDINGS_INDUSTRIES = 0xC4;
+static const StringID STR_00EF_VEHICLES = 0xC5;
+static const StringID STR_00F0_100M = 0xC6;
+static const StringID STR_00F1_200M = 0xC7;
+static const StringID STR_00F2_300M = 0xC8;
+static const StringID STR_00F3_400M = 0xC9;
+static const StringID STR_00F4_500M = 0xCA;
+static const StringID STR_00F5_TRAINS = 0xCB;
+static const StringID STR_00F6_ROAD_VEHICLES = 0xCC;
+static const StringID STR_00F7_SHIPS = 0xCD;
+static const StringID STR_00F8_AIRCRAFT = 0xCE;
+static const StringID STR_00F9_TRANSPORT_ROUTES = 0xCF;
+static const StringID STR_00FA_COAL_MINE = 0xD0;
+static const StringID STR_00FB_POWER_STATION = 0xD1;
+static const StringID STR_00FC_FOREST = 0xD2;
+static const StringID STR_00FD_SAWMILL = 0xD3;
+static const StringID STR_00FE_OIL_REFINERY = 0xD4;
+static const StringID STR_00FF_FARM = 0xD5;
+static const StringID STR_0100_FACTORY = 0xD6;
+static const StringID STR_0101_PRINTING_WORKS = 0xD7;
+static const StringID STR_0102_OIL_WELLS = 0xD8;
+static const StringID STR_0103_IRON_ORE_MINE = 0xD9;
+static const StringID STR_0104_STEEL_MILL = 0xDA;
+static const StringID STR_0105_BANK = 0xDB;
+static const StringID STR_0106_PAPER_MILL = 0xDC;
+static const StringID STR_0107_GOLD_MINE = 0xDD;
+static const StringID STR_0108_FOOD_PROCESSING_PLANT = 0xDE;
+static const StringID STR_0109_DIAMOND_MINE = 0xDF;
+static const StringID STR_010A_COPPER_ORE_MINE = 0xE0;
+static const StringID STR_010B_FRUIT_PLANTATION = 0xE1;
+static const StringID STR_010C_RUBBER_PLANTATION = 0xE2;
+static const StringID STR_010D_WATER_SUPPLY = 0xE3;
+static const StringID STR_010E_WATER_TOWER = 0xE4;
+static const StringID STR_010F_LUMBER_MILL = 0xE5;
+static const StringID STR_0110_COTTON_CANDY_FOREST = 0xE6;
+static const StringID STR_0111_CANDY_FACTORY = 0xE7;
+static const StringID STR_0112_BATTERY_FARM = 0xE8;
+static const StringID STR_0113_COLA_WELLS = 0xE9;
+static const StringID STR_0114_TOY_SHOP = 0xEA;
+static const StringID STR_0115_TOY_FACTORY = 0xEB;
+static const StringID STR_0116_PLASTIC_FOUNTAINS = 0xEC;
+static const StringID STR_0117_FIZZY_DRINK_FACTORY = 0xED;
+static const StringID STR_0118_BUBBLE_GENERATOR = 0xEE;
+static const StringID STR_0119_TOFFEE_QUARRY = 0xEF;
+static const StringID STR_011A_SUGAR_MINE = 0xF0;
+static const StringID STR_011B_RAILROAD_STATION = 0xF1;
+static const StringID STR_011C_TRUCK_LOADING_BAY = 0xF2;
+static const StringID STR_011D_BUS_STATION = 0xF3;
+static const StringID STR_011E_AIRPORT_HELIPORT = 0xF4;
+static const StringID STR_011F_DOCK = 0xF5;
+static const StringID STR_0120_ROUGH_LAND = 0xF6;
+static const StringID STR_0121_GRASS_LAND = 0xF7;
+static const StringID STR_0122_BARE_LAND = 0xF8;
+static const StringID STR_0123_FIELDS = 0xF9;
+static const StringID STR_0124_TREES = 0xFA;
+static const StringID STR_0125_ROCKS = 0xFB;
+static const StringID STR_0126_WATER = 0xFC;
+static const StringID STR_0127_NO_OWNER = 0xFD;
+static const StringID STR_0128_TOWNS = 0xFE;
+static const StringID STR_0129_INDUSTRIES = 0xFF;
+static const StringID STR_012A_DESERT = 0x100;
+static const StringID STR_012B_SNOW = 0x101;
+static const StringID STR_012C_MESSAGE = 0x102;
+static const StringID STR_012D = 0x103;
+static const StringID STR_012E_CANCEL = 0x104;
+static const StringID STR_012F_OK = 0x105;
+static const StringID STR_0130_RENAME = 0x106;
+static const StringID STR_0131_TOO_MANY_NAMES_DEFINED = 0x107;
+static const StringID STR_0132_CHOSEN_NAME_IN_USE_ALREADY = 0x108;
+static const StringID STR_OSNAME_WINDOWS = 0x109;
+static const StringID STR_OSNAME_UNIX = 0x10A;
+static const StringID STR_OSNAME_OSX = 0x10B;
+static const StringID STR_OSNAME_BEOS = 0x10C;
+static const StringID STR_OSNAME_MORPHOS = 0x10D;
+static const StringID STR_OSNAME_AMIGAOS = 0x10E;
+static const StringID STR_OSNAME_OS2 = 0x10F;
+static const StringID STR_OSNAME_SUNOS = 0x110;
+static const StringID STR_013B_OWNED_BY = 0x111;
+static const StringID STR_013C_CARGO = 0x112;
+static const StringID STR_013D_INFORMATION = 0x113;
+static const StringID STR_013E_CAPACITIES = 0x114;
+static const StringID STR_TOTAL_CARGO = 0x115;
+static const StringID STR_013F_CAPACITY = 0x116;
+static const StringID STR_CAPACITY_MULT = 0x117;
+static const StringID STR_TOTAL_CAPACITY_TEXT = 0x118;
+static const StringID STR_TOTAL_CAPACITY = 0x119;
+static const StringID STR_TOTAL_CAPACITY_MULT = 0x11A;
+static const StringID STR_0140_NEW_GAME = 0x11B;
+static const StringID STR_0141_LOAD_GAME = 0x11C;
+static const StringID STR_SINGLE_PLAYER = 0x11D;
+static const StringID STR_MULTIPLAYER = 0x11E;
+static const StringID STR_SCENARIO_EDITOR = 0x11F;
+static const StringID STR_MAPSIZE = 0x120;
+static const StringID STR_BY = 0x121;
+static const StringID STR_0148_GAME_OPTIONS = 0x122;
+static const StringID STR_0150_SOMEONE = 0x123;
+static const StringID STR_0151_MAP_OF_WORLD = 0x124;
+static const StringID STR_0152_TOWN_DIRECTORY = 0x125;
+static const StringID STR_0153_SUBSIDIES = 0x126;
+static const StringID STR_UNITS_IMPERIAL = 0x127;
+static const StringID STR_UNITS_METRIC = 0x128;
+static const StringID STR_UNITS_SI = 0x129;
+static const StringID STR_UNITS_VELOCITY_IMPERIAL = 0x12A;
+static const StringID STR_UNITS_VELOCITY_METRIC = 0x12B;
+static const StringID STR_UNITS_VELOCITY_SI = 0x12C;
+static const StringID STR_UNITS_POWER_IMPERIAL = 0x12D;
+static const StringID STR_UNITS_POWER_METRIC = 0x12E;
+static const StringID STR_UNITS_POWER_SI = 0x12F;
+static const StringID STR_UNITS_WEIGHT_SHORT_IMPERIAL = 0x130;
+static const StringID STR_UNITS_WEIGHT_SHORT_METRIC = 0x131;
+static const StringID STR_UNITS_WEIGHT_SHORT_SI = 0x132;
+static const StringID STR_UNITS_WEIGHT_LONG_IMPERIAL = 0x133;
+static const StringID STR_UNITS_WEIGHT_LONG_METRIC = 0x134;
+static const StringID STR_UNITS_WEIGHT_LONG_SI = 0x135;
+static const StringID STR_UNITS_VOLUME_SHORT_IMPERIAL = 0x136;
+static const StringID STR_UNITS_VOLUME_SHORT_METRIC = 0x137;
+static const StringID STR_UNITS_VOLUME_SHORT_SI = 0x138;
+static const StringID STR_UNITS_VOLUME_LONG_IMPERIAL = 0x139;
+static const StringID STR_UNITS_VOLUME_LONG_METRIC = 0x13A;
+static const StringID STR_UNITS_VOLUME_LONG_SI = 0x13B;
+static const StringID STR_UNITS_FORCE_IMPERIAL = 0x13C;
+static const StringID STR_UNITS_FORCE_METRIC = 0x13D;
+static const StringID STR_UNITS_FORCE_SI = 0x13E;
+static const StringID STR_0154_OPERATING_PROFIT_GRAPH = 0x13F;
+static const StringID STR_0155_INCOME_GRAPH = 0x140;
+static const StringID STR_0156_DELIVERED_CARGO_GRAPH = 0x141;
+static const StringID STR_0157_PERFORMANCE_HISTORY_GRAPH = 0x142;
+static const StringID STR_0158_COMPANY_VALUE_GRAPH = 0x143;
+static const StringID STR_0159_CARGO_PAYMENT_RATES = 0x144;
+static const StringID STR_015A_COMPANY_LEAGUE_TABLE = 0x145;
+static const StringID STR_PERFORMANCE_DETAIL_MENU = 0x146;
+static const StringID STR_015B_OPENTTD = 0x147;
+static const StringID STR_015C_SAVE_GAME = 0x148;
+static const StringID STR_015D_LOAD_GAME = 0x149;
+static const StringID STR_015E_QUIT_GAME = 0x14A;
+static const StringID STR_015F_QUIT = 0x14B;
+static const StringID STR_ABANDON_GAME_QUERY = 0x14C;
+static const StringID STR_0161_QUIT_GAME = 0x14D;
+static const StringID STR_SORT_ORDER_TIP = 0x14E;
+static const StringID STR_SORT_CRITERIA_TIP = 0x14F;
+static const StringID STR_SORT_BY = 0x150;
+static const StringID STR_SORT_BY_POPULATION = 0x151;
+static const StringID STR_SORT_BY_PRODUCTION = 0x152;
+static const StringID STR_SORT_BY_TYPE = 0x153;
+static const StringID STR_SORT_BY_TRANSPORTED = 0x154;
+static const StringID STR_SORT_BY_NAME = 0x155;
+static const StringID STR_SORT_BY_DROPDOWN_NAME = 0x156;
+static const StringID STR_SORT_BY_DATE = 0x157;
+static const StringID STR_SORT_BY_NUMBER = 0x158;
+static const StringID STR_SORT_BY_PROFIT_LAST_YEAR = 0x159;
+static const StringID STR_SORT_BY_PROFIT_THIS_YEAR = 0x15A;
+static const StringID STR_SORT_BY_AGE = 0x15B;
+static const StringID STR_SORT_BY_RELIABILITY = 0x15C;
+static const StringID STR_SORT_BY_TOTAL_CAPACITY_PER_CARGOTYPE = 0x15D;
+static const StringID STR_SORT_BY_MAX_SPEED = 0x15E;
+static const StringID STR_SORT_BY_MODEL = 0x15F;
+static const StringID STR_SORT_BY_VALUE = 0x160;
+static const StringID STR_SORT_BY_FACILITY = 0x161;
+static const StringID STR_SORT_BY_WAITING = 0x162;
+static const StringID STR_SORT_BY_RATING_MAX = 0x163;
+static const StringID STR_ENGINE_SORT_ENGINE_ID = 0x164;
+static const StringID STR_ENGINE_SORT_COST = 0x165;
+static const StringID STR_ENGINE_SORT_POWER = 0x166;
+static const StringID STR_ENGINE_SORT_INTRO_DATE = 0x167;
+static const StringID STR_ENGINE_SORT_RUNNING_COST = 0x168;
+static const StringID STR_ENGINE_SORT_POWER_VS_RUNNING_COST = 0x169;
+static const StringID STR_ENGINE_SORT_CARGO_CAPACITY = 0x16A;
+static const StringID STR_NO_WAITING_CARGO = 0x16B;
+static const StringID STR_SELECT_ALL_FACILITIES = 0x16C;
+static const StringID STR_SELECT_ALL_TYPES = 0x16D;
+static const StringID STR_AVAILABLE_TRAINS = 0x16E;
+static const StringID STR_AVAILABLE_ROAD_VEHICLES = 0x16F;
+static const StringID STR_AVAILABLE_SHIPS = 0x170;
+static const StringID STR_AVAILABLE_AIRCRAFT = 0x171;
+static const StringID STR_AVAILABLE_ENGINES_TIP = 0x172;
+static const StringID STR_MANAGE_LIST = 0x173;
+static const StringID STR_MANAGE_LIST_TIP = 0x174;
+static const StringID STR_REPLACE_VEHICLES = 0x175;
+static const StringID STR_SEND_TRAIN_TO_DEPOT = 0x176;
+static const StringID STR_SEND_ROAD_VEHICLE_TO_DEPOT = 0x177;
+static const StringID STR_SEND_SHIP_TO_DEPOT = 0x178;
+static const StringID STR_SEND_AIRCRAFT_TO_HANGAR = 0x179;
+static const StringID STR_SEND_FOR_SERVICING = 0x17A;
+static const StringID STR_0162_JAN = 0x17B;
+static const StringID STR_0163_FEB = 0x17C;
+static const StringID STR_0164_MAR = 0x17D;
+static const StringID STR_0165_APR = 0x17E;
+static const StringID STR_0166_MAY = 0x17F;
+static const StringID STR_0167_JUN = 0x180;
+static const StringID STR_0168_JUL = 0x181;
+static const StringID STR_0169_AUG = 0x182;
+static const StringID STR_016A_SEP = 0x183;
+static const StringID STR_016B_OCT = 0x184;
+static const StringID STR_016C_NOV = 0x185;
+static const StringID STR_016D_DEC = 0x186;
+static const StringID STR_016E = 0x187;
+static const StringID STR_016F = 0x188;
+static const StringID STR_0170 = 0x189;
+static const StringID STR_0171_PAUSE_GAME = 0x18A;
+static const StringID STR_0172_SAVE_GAME_ABANDON_GAME = 0x18B;
+static const StringID STR_0173_DISPLAY_LIST_OF_COMPANY = 0x18C;
+static const StringID STR_0174_DISPLAY_MAP = 0x18D;
+static const StringID STR_0175_DISPLAY_MAP_TOWN_DIRECTORY = 0x18E;
+static const StringID STR_0176_DISPLAY_TOWN_DIRECTORY = 0x18F;
+static const StringID STR_0177_DISPLAY_COMPANY_FINANCES = 0x190;
+static const StringID STR_0178_DISPLAY_COMPANY_GENERAL = 0x191;
+static const StringID STR_0179_DISPLAY_GRAPHS = 0x192;
+static const StringID STR_017A_DISPLAY_COMPANY_LEAGUE = 0x193;
+static const StringID STR_017B_DISPLAY_LIST_OF_COMPANY = 0x194;
+static const StringID STR_017C_DISPLAY_LIST_OF_COMPANY = 0x195;
+static const StringID STR_017D_DISPLAY_LIST_OF_COMPANY = 0x196;
+static const StringID STR_017E_DISPLAY_LIST_OF_COMPANY = 0x197;
+static const StringID STR_017F_ZOOM_THE_VIEW_IN = 0x198;
+static const StringID STR_0180_ZOOM_THE_VIEW_OUT = 0x199;
+static const StringID STR_0181_BUILD_RAILROAD_TRACK = 0x19A;
+static const StringID STR_0182_BUILD_ROADS = 0x19B;
+static const StringID STR_0183_BUILD_SHIP_DOCKS = 0x19C;
+static const StringID STR_0184_BUILD_AIRPORTS = 0x19D;
+static const StringID STR_0185_PLANT_TREES_PLACE_SIGNS = 0x19E;
+static const StringID STR_0186_LAND_BLOCK_INFORMATION = 0x19F;
+static const StringID STR_0187_OPTIONS = 0x1A0;
+static const StringID STR_0188 = 0x1A1;
+static const StringID STR_0189 = 0x1A2;
+static const StringID STR_018A_CAN_T_CHANGE_SERVICING = 0x1A3;
+static const StringID STR_018B_CLOSE_WINDOW = 0x1A4;
+static const StringID STR_018C_WINDOW_TITLE_DRAG_THIS = 0x1A5;
+static const StringID STR_STICKY_BUTTON = 0x1A6;
+static const StringID STR_RESIZE_BUTTON = 0x1A7;
+static const StringID STR_SAVELOAD_HOME_BUTTON = 0x1A8;
+static const StringID STR_018D_DEMOLISH_BUILDINGS_ETC = 0x1A9;
+static const StringID STR_018E_LOWER_A_CORNER_OF_LAND = 0x1AA;
+static const StringID STR_018F_RAISE_A_CORNER_OF_LAND = 0x1AB;
+static const StringID STR_0190_SCROLL_BAR_SCROLLS_LIST = 0x1AC;
+static const StringID STR_HSCROLL_BAR_SCROLLS_LIST = 0x1AD;
+static const StringID STR_0191_SHOW_LAND_CONTOURS_ON_MAP = 0x1AE;
+static const StringID STR_0192_SHOW_VEHICLES_ON_MAP = 0x1AF;
+static const StringID STR_0193_SHOW_INDUSTRIES_ON_MAP = 0x1B0;
+static const StringID STR_0194_SHOW_TRANSPORT_ROUTES_ON = 0x1B1;
+static const StringID STR_0195_SHOW_VEGETATION_ON_MAP = 0x1B2;
+static const StringID STR_0196_SHOW_LAND_OWNERS_ON_MAP = 0x1B3;
+static const StringID STR_0197_TOGGLE_TOWN_NAMES_ON_OFF = 0x1B4;
+static const StringID STR_0198_PROFIT_THIS_YEAR_LAST_YEAR = 0x1B5;
+static const StringID STR_AGE = 0x1B6;
+static const StringID STR_AGE_RED = 0x1B7;
+static const StringID STR_019C_ROAD_VEHICLE = 0x1B8;
+static const StringID STR_019D_AIRCRAFT = 0x1B9;
+static const StringID STR_019E_SHIP = 0x1BA;
+static const StringID STR_019F_TRAIN = 0x1BB;
+static const StringID STR_01A0_IS_GETTING_OLD = 0x1BC;
+static const StringID STR_01A1_IS_GETTING_VERY_OLD = 0x1BD;
+static const StringID STR_01A2_IS_GETTING_VERY_OLD_AND = 0x1BE;
+static const StringID STR_01A3_LAND_AREA_INFORMATION = 0x1BF;
+static const StringID STR_01A4_COST_TO_CLEAR_N_A = 0x1C0;
+static const StringID STR_01A5_COST_TO_CLEAR = 0x1C1;
+static const StringID STR_01A6_N_A = 0x1C2;
+static const StringID STR_01A7_OWNER = 0x1C3;
+static const StringID STR_01A8_LOCAL_AUTHORITY = 0x1C4;
+static const StringID STR_01A9_NONE = 0x1C5;
+static const StringID STR_01AA_NAME = 0x1C6;
+static const StringID STR_01AB = 0x1C7;
+static const StringID STR_01AC_1ST = 0x1C8;
+static const StringID STR_01AD_2ND = 0x1C9;
+static const StringID STR_01AE_3RD = 0x1CA;
+static const StringID STR_01AF_4TH = 0x1CB;
+static const StringID STR_01B0_5TH = 0x1CC;
+static const StringID STR_01B1_6TH = 0x1CD;
+static const StringID STR_01B2_7TH = 0x1CE;
+static const StringID STR_01B3_8TH = 0x1CF;
+static const StringID STR_01B4_9TH = 0x1D0;
+static const StringID STR_01B5_10TH = 0x1D1;
+static const StringID STR_01B6_11TH = 0x1D2;
+static const StringID STR_01B7_12TH = 0x1D3;
+static const StringID STR_01B8_13TH = 0x1D4;
+static const StringID STR_01B9_14TH = 0x1D5;
+static const StringID STR_01BA_15TH = 0x1D6;
+static const StringID STR_01BB_16TH = 0x1D7;
+static const StringID STR_01BC_17TH = 0x1D8;
+static const StringID STR_01BD_18TH = 0x1D9;
+static const StringID STR_01BE_19TH = 0x1DA;
+static const StringID STR_01BF_20TH = 0x1DB;
+static const StringID STR_01C0_21ST = 0x1DC;
+static const StringID STR_01C1_22ND = 0x1DD;
+static const StringID STR_01C2_23RD = 0x1DE;
+static const StringID STR_01C3_24TH = 0x1DF;
+static const StringID STR_01C4_25TH = 0x1E0;
+static const StringID STR_01C5_26TH = 0x1E1;
+static const StringID STR_01C6_27TH = 0x1E2;
+static const StringID STR_01C7_28TH = 0x1E3;
+static const StringID STR_01C8_29TH = 0x1E4;
+static const StringID STR_01C9_30TH = 0x1E5;
+static const StringID STR_01CA_31ST = 0x1E6;
+static const StringID STR_01CB = 0x1E7;
+static const StringID STR_01CE_CARGO_ACCEPTED = 0x1E8;
+static const StringID STR_01D1_8 = 0x1E9;
+static const StringID STR_01D2_JAZZ_JUKEBOX = 0x1EA;
+static const StringID STR_01D3_SOUND_MUSIC = 0x1EB;
+static const StringID STR_01D4_SHOW_SOUND_MUSIC_WINDOW = 0x1EC;
+static const StringID STR_01D5_ALL = 0x1ED;
+static const StringID STR_01D6_OLD_STYLE = 0x1EE;
+static const StringID STR_01D7_NEW_STYLE = 0x1EF;
+static const StringID STR_01D8_EZY_STREET = 0x1F0;
+static const StringID STR_01D9_CUSTOM_1 = 0x1F1;
+static const StringID STR_01DA_CUSTOM_2 = 0x1F2;
+static const StringID STR_01DB_MUSIC_VOLUME = 0x1F3;
+static const StringID STR_01DC_EFFECTS_VOLUME = 0x1F4;
+static const StringID STR_01DD_MIN_MAX = 0x1F5;
+static const StringID STR_01DE_SKIP_TO_PREVIOUS_TRACK = 0x1F6;
+static const StringID STR_01DF_SKIP_TO_NEXT_TRACK_IN_SELECTION = 0x1F7;
+static const StringID STR_01E0_STOP_PLAYING_MUSIC = 0x1F8;
+static const StringID STR_01E1_START_PLAYING_MUSIC = 0x1F9;
+static const StringID STR_01E2_DRAG_SLIDERS_TO_SET_MUSIC = 0x1FA;
+static const StringID STR_01E3 = 0x1FB;
+static const StringID STR_01E4_0 = 0x1FC;
+static const StringID STR_01E5 = 0x1FD;
+static const StringID STR_01E6 = 0x1FE;
+static const StringID STR_01E7 = 0x1FF;
+static const StringID STR_01E8_TRACK_XTITLE = 0x200;
+static const StringID STR_01E9_SHUFFLE = 0x201;
+static const StringID STR_01EA_PROGRAM = 0x202;
+static const StringID STR_01EB_MUSIC_PROGRAM_SELECTION = 0x203;
+static const StringID STR_01EC_0 = 0x204;
+static const StringID STR_01ED = 0x205;
+static const StringID STR_01EE_TRACK_INDEX = 0x206;
+static const StringID STR_01EF_PROGRAM = 0x207;
+static const StringID STR_01F0_CLEAR = 0x208;
+static const StringID STR_01F1_SAVE = 0x209;
+static const StringID STR_01F2_CURRENT_PROGRAM_OF_MUSIC = 0x20A;
+static const StringID STR_01F3_SELECT_ALL_TRACKS_PROGRAM = 0x20B;
+static const StringID STR_01F4_SELECT_OLD_STYLE_MUSIC = 0x20C;
+static const StringID STR_01F5_SELECT_NEW_STYLE_MUSIC = 0x20D;
+static const StringID STR_01F6_SELECT_CUSTOM_1_USER_DEFINED = 0x20E;
+static const StringID STR_01F7_SELECT_CUSTOM_2_USER_DEFINED = 0x20F;
+static const StringID STR_01F8_CLEAR_CURRENT_PROGRAM_CUSTOM1 = 0x210;
+static const StringID STR_01F9_SAVE_MUSIC_SETTINGS = 0x211;
+static const StringID STR_01FA_CLICK_ON_MUSIC_TRACK_TO = 0x212;
+static const StringID STR_CLICK_ON_TRACK_TO_REMOVE = 0x213;
+static const StringID STR_01FB_TOGGLE_PROGRAM_SHUFFLE = 0x214;
+static const StringID STR_01FC_SHOW_MUSIC_TRACK_SELECTION = 0x215;
+static const StringID STR_01FD_CLICK_ON_SERVICE_TO_CENTER = 0x216;
+static const StringID STR_01FE_DIFFICULTY = 0x217;
+static const StringID STR_01FF = 0x218;
+static const StringID STR_0200_LAST_MESSAGE_NEWS_REPORT = 0x219;
+static const StringID STR_0201_MESSAGE_SETTINGS = 0x21A;
+static const StringID STR_MESSAGE_HISTORY_MENU = 0x21B;
+static const StringID STR_0203_SHOW_LAST_MESSAGE_NEWS = 0x21C;
+static const StringID STR_0204_MESSAGE_OPTIONS = 0x21D;
+static const StringID STR_0205_MESSAGE_TYPES = 0x21E;
+static const StringID STR_0206_ARRIVAL_OF_FIRST_VEHICLE = 0x21F;
+static const StringID STR_0207_ARRIVAL_OF_FIRST_VEHICLE = 0x220;
+static const StringID STR_0208_ACCIDENTS_DISASTERS = 0x221;
+static const StringID STR_0209_COMPANY_INFORMATION = 0x222;
+static const StringID STR_NEWS_OPEN_CLOSE = 0x223;
+static const StringID STR_020A_ECONOMY_CHANGES = 0x224;
+static const StringID STR_INDUSTRY_CHANGES_SERVED_BY_PLAYER = 0x225;
+static const StringID STR_INDUSTRY_CHANGES_SERVED_BY_OTHER = 0x226;
+static const StringID STR_OTHER_INDUSTRY_PRODUCTION_CHANGES = 0x227;
+static const StringID STR_020B_ADVICE_INFORMATION_ON_PLAYER = 0x228;
+static const StringID STR_020C_NEW_VEHICLES = 0x229;
+static const StringID STR_020D_CHANGES_OF_CARGO_ACCEPTANCE = 0x22A;
+static const StringID STR_020E_SUBSIDIES = 0x22B;
+static const StringID STR_020F_GENERAL_INFORMATION = 0x22C;
+static const StringID STR_MESSAGES_ALL = 0x22D;
+static const StringID STR_MESSAGE_SOUND = 0x22E;
+static const StringID STR_0210_TOO_FAR_FROM_PREVIOUS_DESTINATIO = 0x22F;
+static const StringID STR_0211_TOP_COMPANIES_WHO_REACHED = 0x230;
+static const StringID STR_TOP_COMPANIES_NETWORK_GAME = 0x231;
+static const StringID STR_0212 = 0x232;
+static const StringID STR_0213_BUSINESSMAN = 0x233;
+static const StringID STR_0214_ENTREPRENEUR = 0x234;
+static const StringID STR_0215_INDUSTRIALIST = 0x235;
+static const StringID STR_0216_CAPITALIST = 0x236;
+static const StringID STR_0217_MAGNATE = 0x237;
+static const StringID STR_0218_MOGUL = 0x238;
+static const StringID STR_0219_TYCOON_OF_THE_CENTURY = 0x239;
+static const StringID STR_HIGHSCORE_NAME = 0x23A;
+static const StringID STR_HIGHSCORE_STATS = 0x23B;
+static const StringID STR_021B_ACHIEVES_STATUS = 0x23C;
+static const StringID STR_021C_OF_ACHIEVES_STATUS = 0x23D;
+static const StringID STR_021F = 0x23E;
+static const StringID STR_0221_OPENTTD = 0x23F;
+static const StringID STR_0222_SCENARIO_EDITOR = 0x240;
+static const StringID STR_0223_LAND_GENERATION = 0x241;
+static const StringID STR_0224 = 0x242;
+static const StringID STR_0225 = 0x243;
+static const StringID STR_0228_INCREASE_SIZE_OF_LAND_AREA = 0x244;
+static const StringID STR_0229_DECREASE_SIZE_OF_LAND_AREA = 0x245;
+static const StringID STR_022A_GENERATE_RANDOM_LAND = 0x246;
+static const StringID STR_022B_RESET_LANDSCAPE = 0x247;
+static const StringID STR_022C_RESET_LANDSCAPE = 0x248;
+static const StringID STR_RESET_LANDSCAPE_TOOLTIP = 0x249;
+static const StringID STR_RESET_LANDSCAPE_CONFIRMATION_TEXT = 0x24A;
+static const StringID STR_022E_LANDSCAPE_GENERATION = 0x24B;
+static const StringID STR_022F_TOWN_GENERATION = 0x24C;
+static const StringID STR_0230_INDUSTRY_GENERATION = 0x24D;
+static const StringID STR_0231_ROAD_CONSTRUCTION = 0x24E;
+static const StringID STR_0233_TOWN_GENERATION = 0x24F;
+static const StringID STR_0234_NEW_TOWN = 0x250;
+static const StringID STR_0235_CONSTRUCT_NEW_TOWN = 0x251;
+static const StringID STR_0236_CAN_T_BUILD_TOWN_HERE = 0x252;
+static const StringID STR_0237_TOO_CLOSE_TO_EDGE_OF_MAP = 0x253;
+static const StringID STR_0238_TOO_CLOSE_TO_ANOTHER_TOWN = 0x254;
+static const StringID STR_0239_SITE_UNSUITABLE = 0x255;
+static const StringID STR_023A_TOO_MANY_TOWNS = 0x256;
+static const StringID STR_CANNOT_GENERATE_TOWN = 0x257;
+static const StringID STR_NO_SPACE_FOR_TOWN = 0x258;
+static const StringID STR_023B_INCREASE_SIZE_OF_TOWN = 0x259;
+static const StringID STR_023C_EXPAND = 0x25A;
+static const StringID STR_023D_RANDOM_TOWN = 0x25B;
+static const StringID STR_023E_BUILD_TOWN_IN_RANDOM_LOCATION = 0x25C;
+static const StringID STR_023F_INDUSTRY_GENERATION = 0x25D;
+static const StringID STR_0240_COAL_MINE = 0x25E;
+static const StringID STR_0241_POWER_STATION = 0x25F;
+static const StringID STR_0242_SAWMILL = 0x260;
+static const StringID STR_0243_FOREST = 0x261;
+static const StringID STR_0244_OIL_REFINERY = 0x262;
+static const StringID STR_0245_OIL_RIG = 0x263;
+static const StringID STR_0246_FACTORY = 0x264;
+static const StringID STR_0247_STEEL_MILL = 0x265;
+static const StringID STR_0248_FARM = 0x266;
+static const StringID STR_0249_IRON_ORE_MINE = 0x267;
+static const StringID STR_024A_OIL_WELLS = 0x268;
+static const StringID STR_024B_BANK = 0x269;
+static const StringID STR_024C_PAPER_MILL = 0x26A;
+static const StringID STR_024D_FOOD_PROCESSING_PLANT = 0x26B;
+static const StringID STR_024E_PRINTING_WORKS = 0x26C;
+static const StringID STR_024F_GOLD_MINE = 0x26D;
+static const StringID STR_0250_LUMBER_MILL = 0x26E;
+static const StringID STR_0251_FRUIT_PLANTATION = 0x26F;
+static const StringID STR_0252_RUBBER_PLANTATION = 0x270;
+static const StringID STR_0253_WATER_SUPPLY = 0x271;
+static const StringID STR_0254_WATER_TOWER = 0x272;
+static const StringID STR_0255_DIAMOND_MINE = 0x273;
+static const StringID STR_0256_COPPER_ORE_MINE = 0x274;
+static const StringID STR_0257_COTTON_CANDY_FOREST = 0x275;
+static const StringID STR_0258_CANDY_FACTORY = 0x276;
+static const StringID STR_0259_BATTERY_FARM = 0x277;
+static const StringID STR_025A_COLA_WELLS = 0x278;
+static const StringID STR_025B_TOY_SHOP = 0x279;
+static const StringID STR_025C_TOY_FACTORY = 0x27A;
+static const StringID STR_025D_PLASTIC_FOUNTAINS = 0x27B;
+static const StringID STR_025E_FIZZY_DRINK_FACTORY = 0x27C;
+static const StringID STR_025F_BUBBLE_GENERATOR = 0x27D;
+static const StringID STR_0260_TOFFEE_QUARRY = 0x27E;
+static const StringID STR_0261_SUGAR_MINE = 0x27F;
+static const StringID STR_0262_CONSTRUCT_COAL_MINE = 0x280;
+static const StringID STR_0263_CONSTRUCT_POWER_STATION = 0x281;
+static const StringID STR_0264_CONSTRUCT_SAWMILL = 0x282;
+static const StringID STR_0265_PLANT_FOREST = 0x283;
+static const StringID STR_0266_CONSTRUCT_OIL_REFINERY = 0x284;
+static const StringID STR_0267_CONSTRUCT_OIL_RIG_CAN_ONLY = 0x285;
+static const StringID STR_0268_CONSTRUCT_FACTORY = 0x286;
+static const StringID STR_0269_CONSTRUCT_STEEL_MILL = 0x287;
+static const StringID STR_026A_CONSTRUCT_FARM = 0x288;
+static const StringID STR_026B_CONSTRUCT_IRON_ORE_MINE = 0x289;
+static const StringID STR_026C_CONSTRUCT_OIL_WELLS = 0x28A;
+static const StringID STR_026D_CONSTRUCT_BANK_CAN_ONLY = 0x28B;
+static const StringID STR_026E_CONSTRUCT_PAPER_MILL = 0x28C;
+static const StringID STR_026F_CONSTRUCT_FOOD_PROCESSING = 0x28D;
+static const StringID STR_0270_CONSTRUCT_PRINTING_WORKS = 0x28E;
+static const StringID STR_0271_CONSTRUCT_GOLD_MINE = 0x28F;
+static const StringID STR_0272_CONSTRUCT_BANK_CAN_ONLY = 0x290;
+static const StringID STR_0273_CONSTRUCT_LUMBER_MILL_TO = 0x291;
+static const StringID STR_0274_PLANT_FRUIT_PLANTATION = 0x292;
+static const StringID STR_0275_PLANT_RUBBER_PLANTATION = 0x293;
+static const StringID STR_0276_CONSTRUCT_WATER_SUPPLY = 0x294;
+static const StringID STR_0277_CONSTRUCT_WATER_TOWER_CAN = 0x295;
+static const StringID STR_0278_CONSTRUCT_DIAMOND_MINE = 0x296;
+static const StringID STR_0279_CONSTRUCT_COPPER_ORE_MINE = 0x297;
+static const StringID STR_027A_PLANT_COTTON_CANDY_FOREST = 0x298;
+static const StringID STR_027B_CONSTRUCT_CANDY_FACTORY = 0x299;
+static const StringID STR_027C_CONSTRUCT_BATTERY_FARM = 0x29A;
+static const StringID STR_027D_CONSTRUCT_COLA_WELLS = 0x29B;
+static const StringID STR_027E_CONSTRUCT_TOY_SHOP = 0x29C;
+static const StringID STR_027F_CONSTRUCT_TOY_FACTORY = 0x29D;
+static const StringID STR_0280_CONSTRUCT_PLASTIC_FOUNTAINS = 0x29E;
+static const StringID STR_0281_CONSTRUCT_FIZZY_DRINK_FACTORY = 0x29F;
+static const StringID STR_0282_CONSTRUCT_BUBBLE_GENERATOR = 0x2A0;
+static const StringID STR_0283_CONSTRUCT_TOFFEE_QUARRY = 0x2A1;
+static const StringID STR_0284_CONSTRUCT_SUGAR_MINE = 0x2A2;
+static const StringID STR_0285_CAN_T_BUILD_HERE = 0x2A3;
+static const StringID STR_0286_MUST_BUILD_TOWN_FIRST = 0x2A4;
+static const StringID STR_0287_ONLY_ONE_ALLOWED_PER_TOWN = 0x2A5;
+static const StringID STR_0288_PLANT_TREES = 0x2A6;
+static const StringID STR_0289_PLACE_SIGN = 0x2A7;
+static const StringID STR_028A_RANDOM_TREES = 0x2A8;
+static const StringID STR_028B_PLANT_TREES_RANDOMLY_OVER = 0x2A9;
+static const StringID STR_028C_PLACE_ROCKY_AREAS_ON_LANDSCAPE = 0x2AA;
+static const StringID STR_028D_PLACE_LIGHTHOUSE = 0x2AB;
+static const StringID STR_028E_PLACE_TRANSMITTER = 0x2AC;
+static const StringID STR_028F_DEFINE_DESERT_AREA = 0x2AD;
+static const StringID STR_CREATE_LAKE = 0x2AE;
+static const StringID STR_CREATE_RIVER = 0x2AF;
+static const StringID STR_0290_DELETE = 0x2B0;
+static const StringID STR_0291_DELETE_THIS_TOWN_COMPLETELY = 0x2B1;
+static const StringID STR_0292_SAVE_SCENARIO = 0x2B2;
+static const StringID STR_0293_LOAD_SCENARIO = 0x2B3;
+static const StringID STR_MENU_SAVE_HEIGHTMAP = 0x2B4;
+static const StringID STR_MENU_LOAD_HEIGHTMAP = 0x2B5;
+static const StringID STR_0294_QUIT_EDITOR = 0x2B6;
+static const StringID STR_0295 = 0x2B7;
+static const StringID STR_0296_QUIT = 0x2B8;
+static const StringID STR_0297_SAVE_SCENARIO_LOAD_SCENARIO = 0x2B9;
+static const StringID STR_0298_LOAD_SCENARIO = 0x2BA;
+static const StringID STR_0299_SAVE_SCENARIO = 0x2BB;
+static const StringID STR_029A_PLAY_SCENARIO = 0x2BC;
+static const StringID STR_PLAY_HEIGHTMAP = 0x2BD;
+static const StringID STR_PLAY_HEIGHTMAP_HINT = 0x2BE;
+static const StringID STR_QUIT_SCENARIO_QUERY = 0x2BF;
+static const StringID STR_029C_QUIT_EDITOR = 0x2C0;
+static const StringID STR_029D_CAN_ONLY_BE_BUILT_IN_TOWNS = 0x2C1;
+static const StringID STR_029E_MOVE_THE_STARTING_DATE = 0x2C2;
+static const StringID STR_029F_MOVE_THE_STARTING_DATE = 0x2C3;
+static const StringID STR_02A0_ENDS_OF_BRIDGE_MUST_BOTH = 0x2C4;
+static const StringID STR_02A1_SMALL = 0x2C5;
+static const StringID STR_02A2_MEDIUM = 0x2C6;
+static const StringID STR_02A3_LARGE = 0x2C7;
+static const StringID STR_SCENARIO_EDITOR_CITY = 0x2C8;
+static const StringID STR_02A4_SELECT_TOWN_SIZE = 0x2C9;
+static const StringID STR_02A5_TOWN_SIZE = 0x2CA;
+static const StringID STR_02B6 = 0x2CB;
+static const StringID STR_02B7_SHOW_LAST_MESSAGE_OR_NEWS = 0x2CC;
+static const StringID STR_OFF = 0x2CD;
+static const StringID STR_SUMMARY = 0x2CE;
+static const StringID STR_FULL = 0x2CF;
+static const StringID STR_SCREENSHOT = 0x2D0;
+static const StringID STR_02BA = 0x2D1;
+static const StringID STR_02BB_TOWN_DIRECTORY = 0x2D2;
+static const StringID STR_02BC_VEHICLE_DESIGN_NAMES = 0x2D3;
+static const StringID STR_02BD = 0x2D4;
+static const StringID STR_02BE_DEFAULT = 0x2D5;
+static const StringID STR_02BF_CUSTOM = 0x2D6;
+static const StringID STR_02C0_SAVE_CUSTOM_NAMES = 0x2D7;
+static const StringID STR_02C1_VEHICLE_DESIGN_NAMES_SELECTION = 0x2D8;
+static const StringID STR_02C2_SAVE_CUSTOMIZED_VEHICLE = 0x2D9;
+static const StringID STR_CHECKMARK = 0x2DA;
+static const StringID STR_02C4_GAME_OPTIONS = 0x2DB;
+static const StringID STR_02C6_DIFFICULTY_SETTINGS = 0x2DC;
+static const StringID STR_MENU_CONFIG_PATCHES = 0x2DD;
+static const StringID STR_NEWGRF_SETTINGS = 0x2DE;
+static const StringID STR_TRANSPARENCY_OPTIONS = 0x2DF;
+static const StringID STR_GAMEOPTMENU_0A = 0x2E0;
+static const StringID STR_02CA_TOWN_NAMES_DISPLAYED = 0x2E1;
+static const StringID STR_02CC_STATION_NAMES_DISPLAYED = 0x2E2;
+static const StringID STR_02CE_SIGNS_DISPLAYED = 0x2E3;
+static const StringID STR_WAYPOINTS_DISPLAYED2 = 0x2E4;
+static const StringID STR_02D0_FULL_ANIMATION = 0x2E5;
+static const StringID STR_02D2_FULL_DETAIL = 0x2E6;
+static const StringID STR_02D4_TRANSPARENT_BUILDINGS = 0x2E7;
+static const StringID STR_TRANSPARENT_SIGNS = 0x2E8;
+static const StringID STR_02D5_LAND_BLOCK_INFO = 0x2E9;
+static const StringID STR_02D6 = 0x2EA;
+static const StringID STR_CONSOLE_SETTING = 0x2EB;
+static const StringID STR_02D7_SCREENSHOT_CTRL_S = 0x2EC;
+static const StringID STR_ABOUT_MENU_ZOOMIN_SCREENSHOT = 0x2ED;
+static const StringID STR_02D8_GIANT_SCREENSHOT_CTRL_G = 0x2EE;
+static const StringID STR_ABOUT_MENU_MINIMAP_SCREENSHOT = 0x2EF;
+static const StringID STR_02D9_ABOUT_OPENTTD = 0x2F0;
+static const StringID STR_02DB_OFF = 0x2F1;
+static const StringID STR_02DA_ON = 0x2F2;
+static const StringID STR_02DC_DISPLAY_SUBSIDIES = 0x2F3;
+static const StringID STR_02DD_SUBSIDIES = 0x2F4;
+static const StringID STR_02DE_MAP_OF_WORLD = 0x2F5;
+static const StringID STR_EXTRA_VIEW_PORT = 0x2F6;
+static const StringID STR_SIGN_LIST = 0x2F7;
+static const StringID STR_02DF_TOWN_DIRECTORY = 0x2F8;
+static const StringID STR_TOWN_POPULATION = 0x2F9;
+static const StringID STR_EXTRA_VIEW_PORT_TITLE = 0x2FA;
+static const StringID STR_EXTRA_VIEW_MOVE_VIEW_TO_MAIN = 0x2FB;
+static const StringID STR_EXTRA_VIEW_MOVE_VIEW_TO_MAIN_TT = 0x2FC;
+static const StringID STR_EXTRA_VIEW_MOVE_MAIN_TO_VIEW = 0x2FD;
+static const StringID STR_EXTRA_VIEW_MOVE_MAIN_TO_VIEW_TT = 0x2FE;
+static const StringID STR_02E0_CURRENCY_UNITS = 0x2FF;
+static const StringID STR_02E1 = 0x300;
+static const StringID STR_02E2_CURRENCY_UNITS_SELECTION = 0x301;
+static const StringID STR_MEASURING_UNITS = 0x302;
+static const StringID STR_02E4 = 0x303;
+static const StringID STR_MEASURING_UNITS_SELECTION = 0x304;
+static const StringID STR_02E6_ROAD_VEHICLES = 0x305;
+static const StringID STR_02E7 = 0x306;
+static const StringID STR_02E8_SELECT_SIDE_OF_ROAD_FOR = 0x307;
+static const StringID STR_02E9_DRIVE_ON_LEFT = 0x308;
+static const StringID STR_02EA_DRIVE_ON_RIGHT = 0x309;
+static const StringID STR_02EB_TOWN_NAMES = 0x30A;
+static const StringID STR_02EC = 0x30B;
+static const StringID STR_02ED_SELECT_STYLE_OF_TOWN_NAMES = 0x30C;
+static const StringID STR_02F4_AUTOSAVE = 0x30D;
+static const StringID STR_02F5 = 0x30E;
+static const StringID STR_02F6_SELECT_INTERVAL_BETWEEN = 0x30F;
+static const StringID STR_02F7_OFF = 0x310;
+static const StringID STR_02F8_EVERY_3_MONTHS = 0x311;
+static const StringID STR_02F9_EVERY_6_MONTHS = 0x312;
+static const StringID STR_02FA_EVERY_12_MONTHS = 0x313;
+static const StringID STR_02FB_START_A_NEW_GAME = 0x314;
+static const StringID STR_02FC_LOAD_A_SAVED_GAME = 0x315;
+static const StringID STR_02FE_CREATE_A_CUSTOMIZED_GAME = 0x316;
+static const StringID STR_02FF_SELECT_SINGLE_PLAYER_GAME = 0x317;
+static const StringID STR_0300_SELECT_MULTIPLAYER_GAME = 0x318;
+static const StringID STR_0301_DISPLAY_GAME_OPTIONS = 0x319;
+static const StringID STR_0302_DISPLAY_DIFFICULTY_OPTIONS = 0x31A;
+static const StringID STR_0303_START_A_NEW_GAME_USING = 0x31B;
+static const StringID STR_0304_QUIT = 0x31C;
+static const StringID STR_0305_QUIT_OPENTTD = 0x31D;
+static const StringID STR_0307_OPENTTD = 0x31E;
+static const StringID STR_030D_CAN_ONLY_BE_BUILT_IN_TOWNS = 0x31F;
+static const StringID STR_030E_SELECT_TEMPERATE_LANDSCAPE = 0x320;
+static const StringID STR_030F_SELECT_SUB_ARCTIC_LANDSCAPE = 0x321;
+static const StringID STR_0310_SELECT_SUB_TROPICAL_LANDSCAPE = 0x322;
+static const StringID STR_0311_SELECT_TOYLAND_LANDSCAPE = 0x323;
+static const StringID STR_0312_FUND_CONSTRUCTION_OF_NEW = 0x324;
+static const StringID STR_INDUSTRY_DIR = 0x325;
+static const StringID STR_0313_FUND_NEW_INDUSTRY = 0x326;
+static const StringID STR_0314_FUND_NEW_INDUSTRY = 0x327;
+static const StringID STR_JUST_STRING = 0x328;
+static const StringID STR_JUST_INT = 0x329;
+static const StringID STR_0316_CAN_ONLY_BE_BUILT_IN_TOWNS = 0x32A;
+static const StringID STR_0317_CAN_ONLY_BE_BUILT_IN_RAINFOREST = 0x32B;
+static const StringID STR_0318_CAN_ONLY_BE_BUILT_IN_DESERT = 0x32C;
+static const StringID STR_0319_PAUSED = 0x32D;
+static const StringID STR_031B_SCREENSHOT_SUCCESSFULLY = 0x32E;
+static const StringID STR_031C_SCREENSHOT_FAILED = 0x32F;
+static const StringID STR_0329_PURCHASE_LAND_FOR_FUTURE = 0x330;
+static const StringID STR_032F_AUTOSAVE = 0x331;
+static const StringID STR_SAVING_GAME = 0x332;
+static const StringID STR_SAVE_STILL_IN_PROGRESS = 0x333;
+static const StringID STR_0330_SELECT_EZY_STREET_STYLE = 0x334;
+static const StringID STR_6 = 0x335;
+static const StringID STR_7 = 0x336;
+static const StringID STR_TOWNNAME_ORIGINAL_ENGLISH = 0x337;
+static const StringID STR_TOWNNAME_FRENCH = 0x338;
+static const StringID STR_TOWNNAME_GERMAN = 0x339;
+static const StringID STR_TOWNNAME_ADDITIONAL_ENGLISH = 0x33A;
+static const StringID STR_TOWNNAME_LATIN_AMERICAN = 0x33B;
+static const StringID STR_TOWNNAME_SILLY = 0x33C;
+static const StringID STR_TOWNNAME_SWEDISH = 0x33D;
+static const StringID STR_TOWNNAME_DUTCH = 0x33E;
+static const StringID STR_TOWNNAME_FINNISH = 0x33F;
+static const StringID STR_TOWNNAME_POLISH = 0x340;
+static const StringID STR_TOWNNAME_SLOVAKISH = 0x341;
+static const StringID STR_TOWNNAME_NORWEGIAN = 0x342;
+static const StringID STR_TOWNNAME_HUNGARIAN = 0x343;
+static const StringID STR_TOWNNAME_AUSTRIAN = 0x344;
+static const StringID STR_TOWNNAME_ROMANIAN = 0x345;
+static const StringID STR_TOWNNAME_CZECH = 0x346;
+static const StringID STR_TOWNNAME_SWISS = 0x347;
+static const StringID STR_TOWNNAME_DANISH = 0x348;
+static const StringID STR_TOWNNAME_TURKISH = 0x349;
+static const StringID STR_TOWNNAME_ITALIAN = 0x34A;
+static const StringID STR_TOWNNAME_CATALAN = 0x34B;
+static const StringID STR_CURR_GBP = 0x34C;
+static const StringID STR_CURR_USD = 0x34D;
+static const StringID STR_CURR_EUR = 0x34E;
+static const StringID STR_CURR_YEN = 0x34F;
+static const StringID STR_CURR_ATS = 0x350;
+static const StringID STR_CURR_BEF = 0x351;
+static const StringID STR_CURR_CHF = 0x352;
+static const StringID STR_CURR_CZK = 0x353;
+static const StringID STR_CURR_DEM = 0x354;
+static const StringID STR_CURR_DKK = 0x355;
+static const StringID STR_CURR_ESP = 0x356;
+static const StringID STR_CURR_FIM = 0x357;
+static const StringID STR_CURR_FRF = 0x358;
+static const StringID STR_CURR_GRD = 0x359;
+static const StringID STR_CURR_HUF = 0x35A;
+static const StringID STR_CURR_ISK = 0x35B;
+static const StringID STR_CURR_ITL = 0x35C;
+static const StringID STR_CURR_NLG = 0x35D;
+static const StringID STR_CURR_NOK = 0x35E;
+static const StringID STR_CURR_PLN = 0x35F;
+static const StringID STR_CURR_ROL = 0x360;
+static const StringID STR_CURR_RUR = 0x361;
+static const StringID STR_CURR_SIT = 0x362;
+static const StringID STR_CURR_SEK = 0x363;
+static const StringID STR_CURR_YTL = 0x364;
+static const StringID STR_CURR_SKK = 0x365;
+static const StringID STR_CURR_BRR = 0x366;
+static const StringID STR_CURR_CUSTOM = 0x367;
+static const StringID STR_OPTIONS_LANG = 0x368;
+static const StringID STR_OPTIONS_LANG_CBO = 0x369;
+static const StringID STR_OPTIONS_LANG_TIP = 0x36A;
+static const StringID STR_OPTIONS_FULLSCREEN = 0x36B;
+static const StringID STR_OPTIONS_FULLSCREEN_TIP = 0x36C;
+static const StringID STR_FULLSCREEN_FAILED = 0x36D;
+static const StringID STR_OPTIONS_RES = 0x36E;
+static const StringID STR_OPTIONS_RES_CBO = 0x36F;
+static const StringID STR_OPTIONS_RES_TIP = 0x370;
+static const StringID STR_OPTIONS_SCREENSHOT_FORMAT = 0x371;
+static const StringID STR_OPTIONS_SCREENSHOT_FORMAT_CBO = 0x372;
+static const StringID STR_OPTIONS_SCREENSHOT_FORMAT_TIP = 0x373;
+static const StringID STR_AUTOSAVE_1_MONTH = 0x374;
+static const StringID STR_AUTOSAVE_FAILED = 0x375;
+static const StringID STR_MONTH_JAN = 0x376;
+static const StringID STR_MONTH_FEB = 0x377;
+static const StringID STR_MONTH_MAR = 0x378;
+static const StringID STR_MONTH_APR = 0x379;
+static const StringID STR_MONTH_MAY = 0x37A;
+static const StringID STR_MONTH_JUN = 0x37B;
+static const StringID STR_MONTH_JUL = 0x37C;
+static const StringID STR_MONTH_AUG = 0x37D;
+static const StringID STR_MONTH_SEP = 0x37E;
+static const StringID STR_MONTH_OCT = 0x37F;
+static const StringID STR_MONTH_NOV = 0x380;
+static const StringID STR_MONTH_DEC = 0x381;
+static const StringID STR_HEADING_FOR_STATION = 0x382;
+static const StringID STR_HEADING_FOR_STATION_VEL = 0x383;
+static const StringID STR_NO_ORDERS = 0x384;
+static const StringID STR_NO_ORDERS_VEL = 0x385;
+static const StringID STR_PASSENGERS = 0x386;
+static const StringID STR_BAGS = 0x387;
+static const StringID STR_TONS = 0x388;
+static const StringID STR_LITERS = 0x389;
+static const StringID STR_ITEMS = 0x38A;
+static const StringID STR_CRATES = 0x38B;
+static const StringID STR_RES_OTHER = 0x38C;
+static const StringID STR_NOTHING = 0x38D;
+static const StringID STR_SMALL_RIGHT_ARROW = 0x38E;
+static const StringID STR_CANT_SHARE_ORDER_LIST = 0x38F;
+static const StringID STR_CANT_COPY_ORDER_LIST = 0x390;
+static const StringID STR_END_OF_SHARED_ORDERS = 0x391;
+static const StringID STR_TRAIN_IS_LOST = 0x392;
+static const StringID STR_TRAIN_IS_UNPROFITABLE = 0x393;
+static const StringID STR_EURO_INTRODUCE = 0x394;
+static const StringID STR_TRAIN_HAS_TOO_FEW_ORDERS = 0x395;
+static const StringID STR_TRAIN_HAS_VOID_ORDER = 0x396;
+static const StringID STR_TRAIN_HAS_DUPLICATE_ENTRY = 0x397;
+static const StringID STR_TRAIN_HAS_INVALID_ENTRY = 0x398;
+static const StringID STR_ROADVEHICLE_HAS_TOO_FEW_ORDERS = 0x399;
+static const StringID STR_ROADVEHICLE_HAS_VOID_ORDER = 0x39A;
+static const StringID STR_ROADVEHICLE_HAS_DUPLICATE_ENTRY = 0x39B;
+static const StringID STR_ROADVEHICLE_HAS_INVALID_ENTRY = 0x39C;
+static const StringID STR_SHIP_HAS_TOO_FEW_ORDERS = 0x39D;
+static const StringID STR_SHIP_HAS_VOID_ORDER = 0x39E;
+static const StringID STR_SHIP_HAS_DUPLICATE_ENTRY = 0x39F;
+static const StringID STR_SHIP_HAS_INVALID_ENTRY = 0x3A0;
+static const StringID STR_AIRCRAFT_HAS_TOO_FEW_ORDERS = 0x3A1;
+static const StringID STR_AIRCRAFT_HAS_VOID_ORDER = 0x3A2;
+static const StringID STR_AIRCRAFT_HAS_DUPLICATE_ENTRY = 0x3A3;
+static const StringID STR_AIRCRAFT_HAS_INVALID_ENTRY = 0x3A4;
+static const StringID STR_TRAIN_AUTORENEW_FAILED = 0x3A5;
+static const StringID STR_ROADVEHICLE_AUTORENEW_FAILED = 0x3A6;
+static const StringID STR_SHIP_AUTORENEW_FAILED = 0x3A7;
+static const StringID STR_AIRCRAFT_AUTORENEW_FAILED = 0x3A8;
+static const StringID STR_TRAIN_TOO_LONG_AFTER_REPLACEMENT = 0x3A9;
+static const StringID STR_CONFIG_PATCHES = 0x3AA;
+static const StringID STR_CONFIG_PATCHES_TIP = 0x3AB;
+static const StringID STR_CONFIG_PATCHES_CAPTION = 0x3AC;
+static const StringID STR_CONFIG_PATCHES_OFF = 0x3AD;
+static const StringID STR_CONFIG_PATCHES_ON = 0x3AE;
+static const StringID STR_CONFIG_PATCHES_VEHICLESPEED = 0x3AF;
+static const StringID STR_CONFIG_PATCHES_BUILDONSLOPES = 0x3B0;
+static const StringID STR_CONFIG_PATCHES_AUTOSLOPE = 0x3B1;
+static const StringID STR_CONFIG_PATCHES_CATCHMENT = 0x3B2;
+static const StringID STR_CONFIG_PATCHES_EXTRADYNAMITE = 0x3B3;
+static const StringID STR_CONFIG_PATCHES_MAMMOTHTRAINS = 0x3B4;
+static const StringID STR_CONFIG_PATCHES_REALISTICACCEL = 0x3B5;
+static const StringID STR_CONFIG_PATCHES_FORBID_90_DEG = 0x3B6;
+static const StringID STR_CONFIG_PATCHES_JOINSTATIONS = 0x3B7;
+static const StringID STR_CONFIG_PATCHES_FULLLOADANY = 0x3B8;
+static const StringID STR_CONFIG_PATCHES_IMPROVEDLOAD = 0x3B9;
+static const StringID STR_CONFIG_PATCHES_GRADUAL_LOADING = 0x3BA;
+static const StringID STR_CONFIG_PATCHES_INFLATION = 0x3BB;
+static const StringID STR_CONFIG_PATCHES_SELECTGOODS = 0x3BC;
+static const StringID STR_CONFIG_PATCHES_LONGBRIDGES = 0x3BD;
+static const StringID STR_CONFIG_PATCHES_GOTODEPOT = 0x3BE;
+static const StringID STR_CONFIG_PATCHES_RAW_INDUSTRY_CONSTRUCTION_METHOD = 0x3BF;
+static const StringID STR_CONFIG_PATCHES_RAW_INDUSTRY_CONSTRUCTION_METHOD_NONE = 0x3C0;
+static const StringID STR_CONFIG_PATCHES_RAW_INDUSTRY_CONSTRUCTION_METHOD_NORMAL = 0x3C1;
+static const StringID STR_CONFIG_PATCHES_RAW_INDUSTRY_CONSTRUCTION_METHOD_PROSPECTING = 0x3C2;
+static const StringID STR_CONFIG_PATCHES_MULTIPINDTOWN = 0x3C3;
+static const StringID STR_CONFIG_PATCHES_SAMEINDCLOSE = 0x3C4;
+static const StringID STR_CONFIG_PATCHES_LONGDATE = 0x3C5;
+static const StringID STR_CONFIG_PATCHES_SIGNALSIDE = 0x3C6;
+static const StringID STR_CONFIG_PATCHES_SHOWFINANCES = 0x3C7;
+static const StringID STR_CONFIG_PATCHES_NEW_NONSTOP = 0x3C8;
+static const StringID STR_CONFIG_PATCHES_ROADVEH_QUEUE = 0x3C9;
+static const StringID STR_CONFIG_PATCHES_AUTOSCROLL = 0x3CA;
+static const StringID STR_CONFIG_PATCHES_BRIBE = 0x3CB;
+static const StringID STR_CONFIG_PATCHES_ALLOW_EXCLUSIVE = 0x3CC;
+static const StringID STR_CONFIG_PATCHES_ALLOW_GIVE_MONEY = 0x3CD;
+static const StringID STR_CONFIG_PATCHES_NONUNIFORM_STATIONS = 0x3CE;
+static const StringID STR_CONFIG_PATCHES_FREIGHT_TRAINS = 0x3CF;
+static const StringID STR_CONFIG_PATCHES_PLANE_SPEED = 0x3D0;
+static const StringID STR_CONFIG_PATCHES_STOP_ON_TOWN_ROAD = 0x3D1;
+static const StringID STR_CONFIG_PATCHES_ADJACENT_STATIONS = 0x3D2;
+static const StringID STR_CONFIG_PATCHES_SMALL_AIRPORTS = 0x3D3;
+static const StringID STR_CONFIG_PATCHES_WARN_LOST_TRAIN = 0x3D4;
+static const StringID STR_CONFIG_PATCHES_ORDER_REVIEW = 0x3D5;
+static const StringID STR_CONFIG_PATCHES_ORDER_REVIEW_OFF = 0x3D6;
+static const StringID STR_CONFIG_PATCHES_ORDER_REVIEW_EXDEPOT = 0x3D7;
+static const StringID STR_CONFIG_PATCHES_ORDER_REVIEW_ON = 0x3D8;
+static const StringID STR_CONFIG_PATCHES_WARN_INCOME_LESS = 0x3D9;
+static const StringID STR_CONFIG_PATCHES_NEVER_EXPIRE_VEHICLES = 0x3DA;
+static const StringID STR_CONFIG_PATCHES_AUTORENEW_VEHICLE = 0x3DB;
+static const StringID STR_CONFIG_PATCHES_AUTORENEW_MONTHS = 0x3DC;
+static const StringID STR_CONFIG_PATCHES_AUTORENEW_MONEY = 0x3DD;
+static const StringID STR_CONFIG_PATCHES_ERRMSG_DURATION = 0x3DE;
+static const StringID STR_CONFIG_PATCHES_POPULATION_IN_LABEL = 0x3DF;
+static const StringID STR_CONFIG_PATCHES_INVISIBLE_TREES = 0x3E0;
+static const StringID STR_CONFIG_PATCHES_LAND_GENERATOR = 0x3E1;
+static const StringID STR_CONFIG_PATCHES_LAND_GENERATOR_ORIGINAL = 0x3E2;
+static const StringID STR_CONFIG_PATCHES_LAND_GENERATOR_TERRA_GENESIS = 0x3E3;
+static const StringID STR_CONFIG_PATCHES_OIL_REF_EDGE_DISTANCE = 0x3E4;
+static const StringID STR_CONFIG_PATCHES_SNOWLINE_HEIGHT = 0x3E5;
+static const StringID STR_CONFIG_PATCHES_ROUGHNESS_OF_TERRAIN = 0x3E6;
+static const StringID STR_CONFIG_PATCHES_ROUGHNESS_OF_TERRAIN_VERY_SMOOTH = 0x3E7;
+static const StringID STR_CONFIG_PATCHES_ROUGHNESS_OF_TERRAIN_SMOOTH = 0x3E8;
+static const StringID STR_CONFIG_PATCHES_ROUGHNESS_OF_TERRAIN_ROUGH = 0x3E9;
+static const StringID STR_CONFIG_PATCHES_ROUGHNESS_OF_TERRAIN_VERY_ROUGH = 0x3EA;
+static const StringID STR_CONFIG_PATCHES_TREE_PLACER = 0x3EB;
+static const StringID STR_CONFIG_PATCHES_TREE_PLACER_NONE = 0x3EC;
+static const StringID STR_CONFIG_PATCHES_TREE_PLACER_ORIGINAL = 0x3ED;
+static const StringID STR_CONFIG_PATCHES_TREE_PLACER_IMPROVED = 0x3EE;
+static const StringID STR_CONFIG_PATCHES_HEIGHTMAP_ROTATION = 0x3EF;
+static const StringID STR_CONFIG_PATCHES_HEIGHTMAP_ROTATION_COUNTER_CLOCKWISE = 0x3F0;
+static const StringID STR_CONFIG_PATCHES_HEIGHTMAP_ROTATION_CLOCKWISE = 0x3F1;
+static const StringID STR_CONFIG_PATCHES_SE_FLAT_WORLD_HEIGHT = 0x3F2;
+static const StringID STR_CONFIG_PATCHES_STATION_SPREAD = 0x3F3;
+static const StringID STR_CONFIG_PATCHES_SERVICEATHELIPAD = 0x3F4;
+static const StringID STR_CONFIG_PATCHES_LINK_TERRAFORM_TOOLBAR = 0x3F5;
+static const StringID STR_CONFIG_PATCHES_REVERSE_SCROLLING = 0x3F6;
+static const StringID STR_CONFIG_PATCHES_SMOOTH_SCROLLING = 0x3F7;
+static const StringID STR_CONFIG_PATCHES_MEASURE_TOOLTIP = 0x3F8;
+static const StringID STR_CONFIG_PATCHES_LIVERIES = 0x3F9;
+static const StringID STR_CONFIG_PATCHES_LIVERIES_NONE = 0x3FA;
+static const StringID STR_CONFIG_PATCHES_LIVERIES_OWN = 0x3FB;
+static const StringID STR_CONFIG_PATCHES_LIVERIES_ALL = 0x3FC;
+static const StringID STR_CONFIG_PATCHES_PREFER_TEAMCHAT = 0x3FD;
+static const StringID STR_CONFIG_PATCHES_SCROLLWHEEL_SCROLLING = 0x3FE;
+static const StringID STR_CONFIG_PATCHES_SCROLLWHEEL_ZOOM = 0x3FF;
+static const StringID STR_CONFIG_PATCHES_SCROLLWHEEL_SCROLL = 0x400;
+static const StringID STR_CONFIG_PATCHES_SCROLLWHEEL_OFF = 0x401;
+static const StringID STR_CONFIG_PATCHES_SCROLLWHEEL_MULTIPLIER = 0x402;
+static const StringID STR_CONFIG_PATCHES_RIGHT_MOUSE_BTN_EMU = 0x403;
+static const StringID STR_CONFIG_PATCHES_RIGHT_MOUSE_BTN_EMU_COMMAND = 0x404;
+static const StringID STR_CONFIG_PATCHES_RIGHT_MOUSE_BTN_EMU_CONTROL = 0x405;
+static const StringID STR_CONFIG_PATCHES_RIGHT_MOUSE_BTN_EMU_OFF = 0x406;
+static const StringID STR_CONFIG_PATCHES_PAUSE_ON_NEW_GAME = 0x407;
+static const StringID STR_CONFIG_PATCHES_ADVANCED_VEHICLE_LISTS = 0x408;
+static const StringID STR_CONFIG_PATCHES_ADVANCED_VEHICLE_LISTS_OFF = 0x409;
+static const StringID STR_CONFIG_PATCHES_ADVANCED_VEHICLE_LISTS_OWN = 0x40A;
+static const StringID STR_CONFIG_PATCHES_ADVANCED_VEHICLE_LISTS_ALL = 0x40B;
+static const StringID STR_CONFIG_PATCHES_LOADING_INDICATORS = 0x40C;
+static const StringID STR_CONFIG_PATCHES_LOADING_INDICATORS_OFF = 0x40D;
+static const StringID STR_CONFIG_PATCHES_LOADING_INDICATORS_OWN = 0x40E;
+static const StringID STR_CONFIG_PATCHES_LOADING_INDICATORS_ALL = 0x40F;
+static const StringID STR_CONFIG_PATCHES_TIMETABLE_ALLOW = 0x410;
+static const StringID STR_CONFIG_PATCHES_TIMETABLE_IN_TICKS = 0x411;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE = 0x412;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_RAIL = 0x413;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_ELRAIL = 0x414;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_MONORAIL = 0x415;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_MAGLEV = 0x416;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_FIRST = 0x417;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_LAST = 0x418;
+static const StringID STR_CONFIG_PATCHES_DEFAULT_RAIL_TYPE_MOST_USED = 0x419;
+static const StringID STR_CONFIG_PATCHES_ALWAYS_BUILD_INFRASTRUCTURE = 0x41A;
+static const StringID STR_CONFIG_PATCHES_MAX_TRAINS = 0x41B;
+static const StringID STR_CONFIG_PATCHES_MAX_ROADVEH = 0x41C;
+static const StringID STR_CONFIG_PATCHES_MAX_AIRCRAFT = 0x41D;
+static const StringID STR_CONFIG_PATCHES_MAX_SHIPS = 0x41E;
+static const StringID STR_CONFIG_PATCHES_AI_BUILDS_TRAINS = 0x41F;
+static const StringID STR_CONFIG_PATCHES_AI_BUILDS_ROADVEH = 0x420;
+static const StringID STR_CONFIG_PATCHES_AI_BUILDS_AIRCRAFT = 0x421;
+static const StringID STR_CONFIG_PATCHES_AI_BUILDS_SHIPS = 0x422;
+static const StringID STR_CONFIG_PATCHES_AINEW_ACTIVE = 0x423;
+static const StringID STR_CONFIG_PATCHES_AI_IN_MULTIPLAYER = 0x424;
+static const StringID STR_CONFIG_PATCHES_SERVINT_TRAINS = 0x425;
+static const StringID STR_CONFIG_PATCHES_SERVINT_TRAINS_DISABLED = 0x426;
+static const StringID STR_CONFIG_PATCHES_SERVINT_ROADVEH = 0x427;
+static const StringID STR_CONFIG_PATCHES_SERVINT_ROADVEH_DISABLED = 0x428;
+static const StringID STR_CONFIG_PATCHES_SERVINT_AIRCRAFT = 0x429;
+static const StringID STR_CONFIG_PATCHES_SERVINT_AIRCRAFT_DISABLED = 0x42A;
+static const StringID STR_CONFIG_PATCHES_SERVINT_SHIPS = 0x42B;
+static const StringID STR_CONFIG_PATCHES_SERVINT_SHIPS_DISABLED = 0x42C;
+static const StringID STR_CONFIG_PATCHES_NOSERVICE = 0x42D;
+static const StringID STR_CONFIG_PATCHES_WAGONSPEEDLIMITS = 0x42E;
+static const StringID STR_CONFIG_PATCHES_DISABLE_ELRAILS = 0x42F;
+static const StringID STR_CONFIG_PATCHES_COLORED_NEWS_YEAR = 0x430;
+static const StringID STR_CONFIG_PATCHES_STARTING_YEAR = 0x431;
+static const StringID STR_CONFIG_PATCHES_ENDING_YEAR = 0x432;
+static const StringID STR_CONFIG_PATCHES_SMOOTH_ECONOMY = 0x433;
+static const StringID STR_CONFIG_PATCHES_ALLOW_SHARES = 0x434;
+static const StringID STR_CONFIG_PATCHES_DRAG_SIGNALS_DENSITY = 0x435;
+static const StringID STR_CONFIG_PATCHES_SEMAPHORE_BUILD_BEFORE_DATE = 0x436;
+static const StringID STR_CONFIG_PATCHES_ENABLE_SIGNAL_GUI = 0x437;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_INVALID = 0x438;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT = 0x439;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_NO_ROADS = 0x43A;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_DEFAULT = 0x43B;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_BETTER_ROADS = 0x43C;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_2X2_GRID = 0x43D;
+static const StringID STR_CONFIG_PATCHES_TOWN_LAYOUT_3X3_GRID = 0x43E;
+static const StringID STR_CONFIG_PATCHES_TOOLBAR_POS = 0x43F;
+static const StringID STR_CONFIG_PATCHES_TOOLBAR_POS_LEFT = 0x440;
+static const StringID STR_CONFIG_PATCHES_TOOLBAR_POS_CENTER = 0x441;
+static const StringID STR_CONFIG_PATCHES_TOOLBAR_POS_RIGHT = 0x442;
+static const StringID STR_CONFIG_PATCHES_SNAP_RADIUS = 0x443;
+static const StringID STR_CONFIG_PATCHES_SNAP_RADIUS_DISABLED = 0x444;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH = 0x445;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH_NONE = 0x446;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH_SLOW = 0x447;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH_NORMAL = 0x448;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH_FAST = 0x449;
+static const StringID STR_CONFIG_PATCHES_TOWN_GROWTH_VERY_FAST = 0x44A;
+static const StringID STR_CONFIG_PATCHES_LARGER_TOWNS = 0x44B;
+static const StringID STR_CONFIG_PATCHES_LARGER_TOWNS_DISABLED = 0x44C;
+static const StringID STR_CONFIG_PATCHES_CITY_SIZE_MULTIPLIER = 0x44D;
+static const StringID STR_CONFIG_MODIFIED_ROAD_REBUILD = 0x44E;
+static const StringID STR_CONFIG_PATCHES_GUI = 0x44F;
+static const StringID STR_CONFIG_PATCHES_CONSTRUCTION = 0x450;
+static const StringID STR_CONFIG_PATCHES_VEHICLES = 0x451;
+static const StringID STR_CONFIG_PATCHES_STATIONS = 0x452;
+static const StringID STR_CONFIG_PATCHES_ECONOMY = 0x453;
+static const StringID STR_CONFIG_PATCHES_AI = 0x454;
+static const StringID STR_CONFIG_PATCHES_DISABLED = 0x455;
+static const StringID STR_CONFIG_PATCHES_INT32 = 0x456;
+static const StringID STR_CONFIG_PATCHES_CURRENCY = 0x457;
+static const StringID STR_CONFIG_PATCHES_QUERY_CAPT = 0x458;
+static const StringID STR_CONFIG_PATCHES_SERVICE_INTERVAL_INCOMPATIBLE = 0x459;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_TRAINS = 0x45A;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_TRAINS_NTP = 0x45B;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_TRAINS_NPF = 0x45C;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_TRAINS_YAPF = 0x45D;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_ROADVEH = 0x45E;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_ROADVEH_OPF = 0x45F;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_ROADVEH_NPF = 0x460;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_ROADVEH_YAPF = 0x461;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_SHIPS = 0x462;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_SHIPS_OPF = 0x463;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_SHIPS_NPF = 0x464;
+static const StringID STR_CONFIG_PATCHES_PATHFINDER_FOR_SHIPS_YAPF = 0x465;
+static const StringID STR_TEMPERATE_LANDSCAPE = 0x466;
+static const StringID STR_SUB_ARCTIC_LANDSCAPE = 0x467;
+static const StringID STR_SUB_TROPICAL_LANDSCAPE = 0x468;
+static const StringID STR_TOYLAND_LANDSCAPE = 0x469;
+static const StringID STR_CHEATS = 0x46A;
+static const StringID STR_CHEATS_TIP = 0x46B;
+static const StringID STR_CHEATS_WARNING = 0x46C;
+static const StringID STR_CHEAT_MONEY = 0x46D;
+static const StringID STR_CHEAT_CHANGE_PLAYER = 0x46E;
+static const StringID STR_CHEAT_EXTRA_DYNAMITE = 0x46F;
+static const StringID STR_CHEAT_CROSSINGTUNNELS = 0x470;
+static const StringID STR_CHEAT_BUILD_IN_PAUSE = 0x471;
+static const StringID STR_CHEAT_NO_JETCRASH = 0x472;
+static const StringID STR_CHEAT_SWITCH_CLIMATE = 0x473;
+static const StringID STR_CHEAT_CHANGE_DATE = 0x474;
+static const StringID STR_CHEAT_SETUP_PROD = 0x475;
+static const StringID STR_HEADING_FOR_WAYPOINT = 0x476;
+static const StringID STR_HEADING_FOR_WAYPOINT_VEL = 0x477;
+static const StringID STR_GO_TO_WAYPOINT = 0x478;
+static const StringID STR_GO_NON_STOP_TO_WAYPOINT = 0x479;
+static const StringID STR_WAYPOINTNAME_CITY = 0x47A;
+static const StringID STR_WAYPOINTNAME_CITY_SERIAL = 0x47B;
+static const StringID STR_LANDINFO_WAYPOINT = 0x47C;
+static const StringID STR_WAYPOINT = 0x47D;
+static const StringID STR_WAYPOINT_GRAPHICS_TIP = 0x47E;
+static const StringID STR_WAYPOINT_VIEWPORT = 0x47F;
+static const StringID STR_WAYPOINT_VIEWPORT_TINY = 0x480;
+static const StringID STR_WAYPOINT_RAW = 0x481;
+static const StringID STR_EDIT_WAYPOINT_NAME = 0x482;
+static const StringID STR_CANT_CHANGE_WAYPOINT_NAME = 0x483;
+static const StringID STR_CONVERT_RAIL_TO_WAYPOINT_TIP = 0x484;
+static const StringID STR_CANT_BUILD_TRAIN_WAYPOINT = 0x485;
+static const StringID STR_CANT_REMOVE_TRAIN_WAYPOINT = 0x486;
+static const StringID STR_BUILD_AUTORAIL_TIP = 0x487;
+static const StringID STR_NO_TOWN_IN_SCENARIO = 0x488;
+static const StringID STR_GENERATE_RANDOM_LANDSCAPE = 0x489;
+static const StringID STR_MANY_RANDOM_TOWNS = 0x48A;
+static const StringID STR_RANDOM_TOWNS_TIP = 0x48B;
+static const StringID STR_MANY_RANDOM_INDUSTRIES = 0x48C;
+static const StringID STR_RANDOM_INDUSTRIES_TIP = 0x48D;
+static const StringID STR_CAN_T_GENERATE_INDUSTRIES = 0x48E;
+static const StringID STR_LANDSCAPING_TOOLBAR_TIP = 0x48F;
+static const StringID STR_LANDSCAPING_TOOLBAR = 0x490;
+static const StringID STR_LEVEL_LAND_TOOLTIP = 0x491;
+static const StringID STR_TREES_RANDOM_TYPE = 0x492;
+static const StringID STR_TREES_RANDOM_TYPE_TIP = 0x493;
+static const StringID STR_CANT_BUILD_CANALS = 0x494;
+static const StringID STR_BUILD_CANALS_TIP = 0x495;
+static const StringID STR_LANDINFO_CANAL = 0x496;
+static const StringID STR_CANT_BUILD_LOCKS = 0x497;
+static const StringID STR_BUILD_LOCKS_TIP = 0x498;
+static const StringID STR_LANDINFO_LOCK = 0x499;
+static const StringID STR_BUOY_IS_IN_USE = 0x49A;
+static const StringID STR_LANDINFO_COORDS = 0x49B;
+static const StringID STR_CANT_REMOVE_PART_OF_STATION = 0x49C;
+static const StringID STR_CANT_CONVERT_RAIL = 0x49D;
+static const StringID STR_CONVERT_RAIL_TIP = 0x49E;
+static const StringID STR_DRAG_WHOLE_TRAIN_TO_SELL_TIP = 0x49F;
+static const StringID STR_DRAG_DROP = 0x4A0;
+static const StringID STR_STATION_DRAG_DROP = 0x4A1;
+static const StringID STR_SELECT_STATION_CLASS_TIP = 0x4A2;
+static const StringID STR_SELECT_STATION_TYPE_TIP = 0x4A3;
+static const StringID STR_FAST_FORWARD = 0x4A4;
+static const StringID STR_MESSAGE_HISTORY = 0x4A5;
+static const StringID STR_MESSAGE_HISTORY_TIP = 0x4A6;
+static const StringID STR_MESSAGES_DISABLE_ALL = 0x4A7;
+static const StringID STR_MESSAGES_ENABLE_ALL = 0x4A8;
+static const StringID STR_CONSTRUCT_COAL_MINE_TIP = 0x4A9;
+static const StringID STR_CONSTRUCT_FOREST_TIP = 0x4AA;
+static const StringID STR_CONSTRUCT_OIL_RIG_TIP = 0x4AB;
+static const StringID STR_CONSTRUCT_FARM_TIP = 0x4AC;
+static const StringID STR_CONSTRUCT_COPPER_ORE_MINE_TIP = 0x4AD;
+static const StringID STR_CONSTRUCT_OIL_WELLS_TIP = 0x4AE;
+static const StringID STR_CONSTRUCT_GOLD_MINE_TIP = 0x4AF;
+static const StringID STR_CONSTRUCT_DIAMOND_MINE_TIP = 0x4B0;
+static const StringID STR_CONSTRUCT_IRON_ORE_MINE_TIP = 0x4B1;
+static const StringID STR_CONSTRUCT_FRUIT_PLANTATION_TIP = 0x4B2;
+static const StringID STR_CONSTRUCT_RUBBER_PLANTATION_TIP = 0x4B3;
+static const StringID STR_CONSTRUCT_WATER_SUPPLY_TIP = 0x4B4;
+static const StringID STR_CONSTRUCT_COTTON_CANDY_TIP = 0x4B5;
+static const StringID STR_CONSTRUCT_BATTERY_FARM_TIP = 0x4B6;
+static const StringID STR_CONSTRUCT_COLA_WELLS_TIP = 0x4B7;
+static const StringID STR_CONSTRUCT_PLASTIC_FOUNTAINS_TIP = 0x4B8;
+static const StringID STR_CONSTRUCT_BUBBLE_GENERATOR_TIP = 0x4B9;
+static const StringID STR_CONSTRUCT_TOFFEE_QUARRY_TIP = 0x4BA;
+static const StringID STR_CONSTRUCT_SUGAR_MINE_TIP = 0x4BB;
+static const StringID STR_INDUSTRYDIR_CAPTION = 0x4BC;
+static const StringID STR_INDUSTRYDIR_ITEM = 0x4BD;
+static const StringID STR_INDUSTRYDIR_ITEM_TWO = 0x4BE;
+static const StringID STR_INDUSTRYDIR_ITEM_NOPROD = 0x4BF;
+static const StringID STR_INDUSTRYDIR_LIST_CAPTION = 0x4C0;
+static const StringID STR_INDUSTRY_TOO_CLOSE = 0x4C1;
+static const StringID STR_RAIL_REFIT_VEHICLE_TO_CARRY = 0x4C2;
+static const StringID STR_RAIL_REFIT_VEHICLE = 0x4C3;
+static const StringID STR_RAIL_SELECT_TYPE_OF_CARGO_FOR = 0x4C4;
+static const StringID STR_RAIL_REFIT_TO_CARRY_HIGHLIGHTED = 0x4C5;
+static const StringID STR_RAIL_CAN_T_REFIT_VEHICLE = 0x4C6;
+static const StringID STR_CONFIG_PATCHES_SERVINT_ISPERCENT = 0x4C7;
+static const StringID STR_CONFIG_GAME_PRODUCTION = 0x4C8;
+static const StringID TEMP_AI_IN_PROGRESS = 0x4C9;
+static const StringID TEMP_AI_ACTIVATED = 0x4CA;
+static const StringID TEMP_AI_MULTIPLAYER = 0x4CB;
+static const StringID STR_NETWORK_MULTIPLAYER = 0x4CC;
+static const StringID STR_NETWORK_PLAYER_NAME = 0x4CD;
+static const StringID STR_NETWORK_ENTER_NAME_TIP = 0x4CE;
+static const StringID STR_NETWORK_CONNECTION = 0x4CF;
+static const StringID STR_NETWORK_CONNECTION_TIP = 0x4D0;
+static const StringID STR_NETWORK_START_SERVER = 0x4D1;
+static const StringID STR_NETWORK_START_SERVER_TIP = 0x4D2;
+static const StringID STR_NETWORK_GAME_NAME = 0x4D3;
+static const StringID STR_NETWORK_GAME_NAME_TIP = 0x4D4;
+static const StringID STR_NETWORK_INFO_ICONS_TIP = 0x4D5;
+static const StringID STR_NETWORK_CLICK_GAME_TO_SELECT = 0x4D6;
+static const StringID STR_NETWORK_FIND_SERVER = 0x4D7;
+static const StringID STR_NETWORK_FIND_SERVER_TIP = 0x4D8;
+static const StringID STR_NETWORK_ADD_SERVER = 0x4D9;
+static const StringID STR_NETWORK_ADD_SERVER_TIP = 0x4DA;
+static const StringID STR_NETWORK_ENTER_IP = 0x4DB;
+static const StringID STR_NETWORK_GENERAL_ONLINE = 0x4DC;
+static const StringID STR_NETWORK_CLIENTS_CAPTION = 0x4DD;
+static const StringID STR_NETWORK_CLIENTS_CAPTION_TIP = 0x4DE;
+static const StringID STR_NETWORK_GAME_INFO = 0x4DF;
+static const StringID STR_ORANGE = 0x4E0;
+static const StringID STR_NETWORK_CLIENTS = 0x4E1;
+static const StringID STR_NETWORK_LANGUAGE = 0x4E2;
+static const StringID STR_NETWORK_TILESET = 0x4E3;
+static const StringID STR_NETWORK_MAP_SIZE = 0x4E4;
+static const StringID STR_NETWORK_SERVER_VERSION = 0x4E5;
+static const StringID STR_NETWORK_SERVER_ADDRESS = 0x4E6;
+static const StringID STR_NETWORK_START_DATE = 0x4E7;
+static const StringID STR_NETWORK_CURRENT_DATE = 0x4E8;
+static const StringID STR_NETWORK_PASSWORD = 0x4E9;
+static const StringID STR_NETWORK_SERVER_OFFLINE = 0x4EA;
+static const StringID STR_NETWORK_SERVER_FULL = 0x4EB;
+static const StringID STR_NETWORK_VERSION_MISMATCH = 0x4EC;
+static const StringID STR_NETWORK_GRF_MISMATCH = 0x4ED;
+static const StringID STR_NETWORK_JOIN_GAME = 0x4EE;
+static const StringID STR_NETWORK_START_GAME_WINDOW = 0x4EF;
+static const StringID STR_NETWORK_NEW_GAME_NAME = 0x4F0;
+static const StringID STR_NETWORK_NEW_GAME_NAME_TIP = 0x4F1;
+static const StringID STR_NETWORK_SET_PASSWORD = 0x4F2;
+static const StringID STR_NETWORK_PASSWORD_TIP = 0x4F3;
+static const StringID STR_NETWORK_SELECT_MAP = 0x4F4;
+static const StringID STR_NETWORK_SELECT_MAP_TIP = 0x4F5;
+static const StringID STR_NETWORK_LAN_INTERNET_COMBO = 0x4F6;
+static const StringID STR_NETWORK_LAN = 0x4F7;
+static const StringID STR_NETWORK_INTERNET = 0x4F8;
+static const StringID STR_NETWORK_LAN_INTERNET = 0x4F9;
+static const StringID STR_NETWORK_INTERNET_ADVERTISE = 0x4FA;
+static const StringID STR_NETWORK_CLIENTS_SELECT = 0x4FB;
+static const StringID STR_NETWORK_NUMBER_OF_CLIENTS = 0x4FC;
+static const StringID STR_NETWORK_NUMBER_OF_CLIENTS_TIP = 0x4FD;
+static const StringID STR_NETWORK_COMPANIES_SELECT = 0x4FE;
+static const StringID STR_NETWORK_NUMBER_OF_COMPANIES = 0x4FF;
+static const StringID STR_NETWORK_NUMBER_OF_COMPANIES_TIP = 0x500;
+static const StringID STR_NETWORK_SPECTATORS_SELECT = 0x501;
+static const StringID STR_NETWORK_NUMBER_OF_SPECTATORS = 0x502;
+static const StringID STR_NETWORK_NUMBER_OF_SPECTATORS_TIP = 0x503;
+static const StringID STR_NETWORK_LANGUAGE_SPOKEN = 0x504;
+static const StringID STR_NETWORK_LANGUAGE_TIP = 0x505;
+static const StringID STR_NETWORK_LANGUAGE_COMBO = 0x506;
+static const StringID STR_NETWORK_START_GAME = 0x507;
+static const StringID STR_NETWORK_START_GAME_TIP = 0x508;
+static const StringID STR_NETWORK_LOAD_GAME = 0x509;
+static const StringID STR_NETWORK_LOAD_GAME_TIP = 0x50A;
+static const StringID STR_NETWORK_LANG_ANY = 0x50B;
+static const StringID STR_NETWORK_LANG_ENGLISH = 0x50C;
+static const StringID STR_NETWORK_LANG_GERMAN = 0x50D;
+static const StringID STR_NETWORK_LANG_FRENCH = 0x50E;
+static const StringID STR_NETWORK_LANG_BRAZILIAN = 0x50F;
+static const StringID STR_NETWORK_LANG_BULGARIAN = 0x510;
+static const StringID STR_NETWORK_LANG_CHINESE = 0x511;
+static const StringID STR_NETWORK_LANG_CZECH = 0x512;
+static const StringID STR_NETWORK_LANG_DANISH = 0x513;
+static const StringID STR_NETWORK_LANG_DUTCH = 0x514;
+static const StringID STR_NETWORK_LANG_ESPERANTO = 0x515;
+static const StringID STR_NETWORK_LANG_FINNISH = 0x516;
+static const StringID STR_NETWORK_LANG_HUNGARIAN = 0x517;
+static const StringID STR_NETWORK_LANG_ICELANDIC = 0x518;
+static const StringID STR_NETWORK_LANG_ITALIAN = 0x519;
+static const StringID STR_NETWORK_LANG_JAPANESE = 0x51A;
+static const StringID STR_NETWORK_LANG_KOREAN = 0x51B;
+static const StringID STR_NETWORK_LANG_LITHUANIAN = 0x51C;
+static const StringID STR_NETWORK_LANG_NORWEGIAN = 0x51D;
+static const StringID STR_NETWORK_LANG_POLISH = 0x51E;
+static const StringID STR_NETWORK_LANG_PORTUGUESE = 0x51F;
+static const StringID STR_NETWORK_LANG_ROMANIAN = 0x520;
+static const StringID STR_NETWORK_LANG_RUSSIAN = 0x521;
+static const StringID STR_NETWORK_LANG_SLOVAK = 0x522;
+static const StringID STR_NETWORK_LANG_SLOVENIAN = 0x523;
+static const StringID STR_NETWORK_LANG_SPANISH = 0x524;
+static const StringID STR_NETWORK_LANG_SWEDISH = 0x525;
+static const StringID STR_NETWORK_LANG_TURKISH = 0x526;
+static const StringID STR_NETWORK_LANG_UKRAINIAN = 0x527;
+static const StringID STR_NETWORK_GAME_LOBBY = 0x528;
+static const StringID STR_NETWORK_PREPARE_TO_JOIN = 0x529;
+static const StringID STR_NETWORK_COMPANY_LIST_TIP = 0x52A;
+static const StringID STR_NETWORK_NEW_COMPANY = 0x52B;
+static const StringID STR_NETWORK_NEW_COMPANY_TIP = 0x52C;
+static const StringID STR_NETWORK_SPECTATE_GAME = 0x52D;
+static const StringID STR_NETWORK_SPECTATE_GAME_TIP = 0x52E;
+static const StringID STR_NETWORK_JOIN_COMPANY = 0x52F;
+static const StringID STR_NETWORK_JOIN_COMPANY_TIP = 0x530;
+static const StringID STR_NETWORK_REFRESH = 0x531;
+static const StringID STR_NETWORK_REFRESH_TIP = 0x532;
+static const StringID STR_NETWORK_COMPANY_INFO = 0x533;
+static const StringID STR_NETWORK_COMPANY_NAME = 0x534;
+static const StringID STR_NETWORK_INAUGURATION_YEAR = 0x535;
+static const StringID STR_NETWORK_VALUE = 0x536;
+static const StringID STR_NETWORK_CURRENT_BALANCE = 0x537;
+static const StringID STR_NETWORK_LAST_YEARS_INCOME = 0x538;
+static const StringID STR_NETWORK_PERFORMANCE = 0x539;
+static const StringID STR_NETWORK_VEHICLES = 0x53A;
+static const StringID STR_NETWORK_STATIONS = 0x53B;
+static const StringID STR_NETWORK_PLAYERS = 0x53C;
+static const StringID STR_NETWORK_CONNECTING = 0x53D;
+static const StringID STR_NETWORK_CONNECTING_1 = 0x53E;
+static const StringID STR_NETWORK_CONNECTING_2 = 0x53F;
+static const StringID STR_NETWORK_CONNECTING_3 = 0x540;
+static const StringID STR_NETWORK_CONNECTING_4 = 0x541;
+static const StringID STR_NETWORK_CONNECTING_5 = 0x542;
+static const StringID STR_NETWORK_CONNECTING_6 = 0x543;
+static const StringID STR_NETWORK_CONNECTING_SPECIAL_1 = 0x544;
+static const StringID STR_NETWORK_CONNECTING_SPECIAL_2 = 0x545;
+static const StringID STR_NETWORK_CONNECTING_WAITING = 0x546;
+static const StringID STR_NETWORK_CONNECTING_DOWNLOADING = 0x547;
+static const StringID STR_NETWORK_DISCONNECT = 0x548;
+static const StringID STR_NETWORK_GIVE_MONEY_CAPTION = 0x549;
+static const StringID STR_NETWORK_NEED_GAME_PASSWORD_CAPTION = 0x54A;
+static const StringID STR_NETWORK_NEED_COMPANY_PASSWORD_CAPTION = 0x54B;
+static const StringID STR_NETWORK_CLIENT_LIST = 0x54C;
+static const StringID STR_NETWORK_ERR_NOTAVAILABLE = 0x54D;
+static const StringID STR_NETWORK_ERR_NOSERVER = 0x54E;
+static const StringID STR_NETWORK_ERR_NOCONNECTION = 0x54F;
+static const StringID STR_NETWORK_ERR_NEWGRF_MISMATCH = 0x550;
+static const StringID STR_NETWORK_ERR_DESYNC = 0x551;
+static const StringID STR_NETWORK_ERR_LOSTCONNECTION = 0x552;
+static const StringID STR_NETWORK_ERR_SAVEGAMEERROR = 0x553;
+static const StringID STR_NETWORK_ERR_SERVER_START = 0x554;
+static const StringID STR_NETWORK_ERR_CLIENT_START = 0x555;
+static const StringID STR_NETWORK_ERR_TIMEOUT = 0x556;
+static const StringID STR_NETWORK_ERR_SERVER_ERROR = 0x557;
+static const StringID STR_NETWORK_ERR_WRONG_REVISION = 0x558;
+static const StringID STR_NETWORK_ERR_WRONG_PASSWORD = 0x559;
+static const StringID STR_NETWORK_ERR_SERVER_FULL = 0x55A;
+static const StringID STR_NETWORK_ERR_SERVER_BANNED = 0x55B;
+static const StringID STR_NETWORK_ERR_KICKED = 0x55C;
+static const StringID STR_NETWORK_ERR_CHEATER = 0x55D;
+static const StringID STR_NETWORK_ERR_LEFT = 0x55E;
+static const StringID STR_NETWORK_ERR_CLIENT_GENERAL = 0x55F;
+static const StringID STR_NETWORK_ERR_CLIENT_DESYNC = 0x560;
+static const StringID STR_NETWORK_ERR_CLIENT_SAVEGAME = 0x561;
+static const StringID STR_NETWORK_ERR_CLIENT_CONNECTION_LOST = 0x562;
+static const StringID STR_NETWORK_ERR_CLIENT_PROTOCOL_ERROR = 0x563;
+static const StringID STR_NETWORK_ERR_CLIENT_NEWGRF_MISMATCH = 0x564;
+static const StringID STR_NETWORK_ERR_CLIENT_NOT_AUTHORIZED = 0x565;
+static const StringID STR_NETWORK_ERR_CLIENT_NOT_EXPECTED = 0x566;
+static const StringID STR_NETWORK_ERR_CLIENT_WRONG_REVISION = 0x567;
+static const StringID STR_NETWORK_ERR_CLIENT_NAME_IN_USE = 0x568;
+static const StringID STR_NETWORK_ERR_CLIENT_WRONG_PASSWORD = 0x569;
+static const StringID STR_NETWORK_ERR_CLIENT_PLAYER_MISMATCH = 0x56A;
+static const StringID STR_NETWORK_ERR_CLIENT_KICKED = 0x56B;
+static const StringID STR_NETWORK_ERR_CLIENT_CHEATER = 0x56C;
+static const StringID STR_NETWORK_ERR_CLIENT_SERVER_FULL = 0x56D;
+static const StringID STR_NETWORK_CLIENT_JOINED = 0x56E;
+static const StringID STR_NETWORK_GIVE_MONEY = 0x56F;
+static const StringID STR_NETWORK_GAVE_MONEY_AWAY = 0x570;
+static const StringID STR_NETWORK_CHAT_COMPANY_CAPTION = 0x571;
+static const StringID STR_NETWORK_CHAT_COMPANY = 0x572;
+static const StringID STR_NETWORK_CHAT_TO_COMPANY = 0x573;
+static const StringID STR_NETWORK_CHAT_CLIENT_CAPTION = 0x574;
+static const StringID STR_NETWORK_CHAT_CLIENT = 0x575;
+static const StringID STR_NETWORK_CHAT_TO_CLIENT = 0x576;
+static const StringID STR_NETWORK_CHAT_ALL_CAPTION = 0x577;
+static const StringID STR_NETWORK_CHAT_ALL = 0x578;
+static const StringID STR_NETWORK_NAME_CHANGE = 0x579;
+static const StringID STR_NETWORK_SERVER_SHUTDOWN = 0x57A;
+static const StringID STR_NETWORK_SERVER_REBOOT = 0x57B;
+static const StringID STR_NETWORK_SERVER = 0x57C;
+static const StringID STR_NETWORK_CLIENT = 0x57D;
+static const StringID STR_NETWORK_SPECTATORS = 0x57E;
+static const StringID STR_NETWORK_CLIENTLIST_NONE = 0x57F;
+static const StringID STR_NETWORK_CLIENTLIST_KICK = 0x580;
+static const StringID STR_NETWORK_CLIENTLIST_GIVE_MONEY = 0x581;
+static const StringID STR_NETWORK_CLIENTLIST_SPEAK_TO_ALL = 0x582;
+static const StringID STR_NETWORK_CLIENTLIST_SPEAK_TO_COMPANY = 0x583;
+static const StringID STR_NETWORK_CLIENTLIST_SPEAK_TO_CLIENT = 0x584;
+static const StringID STR_NETWORK_SEND = 0x585;
+static const StringID STR_CONFIG_PATCHES_MAP_X = 0x586;
+static const StringID STR_CONFIG_PATCHES_MAP_Y = 0x587;
+static const StringID STR_PNGMAP_ERROR = 0x588;
+static const StringID STR_PNGMAP_ERR_FILE_NOT_FOUND = 0x589;
+static const StringID STR_PNGMAP_ERR_IMAGE_TYPE = 0x58A;
+static const StringID STR_PNGMAP_ERR_MISC = 0x58B;
+static const StringID STR_BMPMAP_ERROR = 0x58C;
+static const StringID STR_BMPMAP_ERR_IMAGE_TYPE = 0x58D;
+
+static const StringID STR_0800_COST = 0x800;
+static const StringID STR_0801_COST = 0x801;
+static const StringID STR_0802_INCOME = 0x802;
+static const StringID STR_0803_INCOME = 0x803;
+static const StringID STR_FEEDER_TINY = 0x804;
+static const StringID STR_FEEDER = 0x805;
+static const StringID STR_0805_ESTIMATED_COST = 0x806;
+static const StringID STR_0807_ESTIMATED_INCOME = 0x807;
+static const StringID STR_0808_CAN_T_RAISE_LAND_HERE = 0x808;
+static const StringID STR_0809_CAN_T_LOWER_LAND_HERE = 0x809;
+static const StringID STR_080A_ROCKS = 0x80A;
+static const StringID STR_080B_ROUGH_LAND = 0x80B;
+static const StringID STR_080C_BARE_LAND = 0x80C;
+static const StringID STR_080D_GRASS = 0x80D;
+static const StringID STR_080E_FIELDS = 0x80E;
+static const StringID STR_080F_SNOW_COVERED_LAND = 0x80F;
+static const StringID STR_0810_DESERT = 0x810;
+
+static const StringID STR_1000_LAND_SLOPED_IN_WRONG_DIRECTION = 0x1000;
+static const StringID STR_1001_IMPOSSIBLE_TRACK_COMBINATION = 0x1001;
+static const StringID STR_1002_EXCAVATION_WOULD_DAMAGE = 0x1002;
+static const StringID STR_1003_ALREADY_AT_SEA_LEVEL = 0x1003;
+static const StringID STR_1004_TOO_HIGH = 0x1004;
+static const StringID STR_1005_NO_SUITABLE_RAILROAD_TRACK = 0x1005;
+static const StringID STR_1007_ALREADY_BUILT = 0x1006;
+static const StringID STR_1008_MUST_REMOVE_RAILROAD_TRACK = 0x1007;
+static const StringID STR_ERR_CROSSING_ON_ONEWAY_ROAD = 0x1008;
+static const StringID STR_100A_RAILROAD_CONSTRUCTION = 0x1009;
+static const StringID STR_TITLE_ELRAIL_CONSTRUCTION = 0x100A;
+static const StringID STR_100B_MONORAIL_CONSTRUCTION = 0x100B;
+static const StringID STR_100C_MAGLEV_CONSTRUCTION = 0x100C;
+static const StringID STR_100D_SELECT_RAIL_BRIDGE = 0x100D;
+static const StringID STR_100E_CAN_T_BUILD_TRAIN_DEPOT = 0x100E;
+static const StringID STR_100F_CAN_T_BUILD_RAILROAD_STATION = 0x100F;
+static const StringID STR_1010_CAN_T_BUILD_SIGNALS_HERE = 0x1010;
+static const StringID STR_1011_CAN_T_BUILD_RAILROAD_TRACK = 0x1011;
+static const StringID STR_1012_CAN_T_REMOVE_RAILROAD_TRACK = 0x1012;
+static const StringID STR_1013_CAN_T_REMOVE_SIGNALS_FROM = 0x1013;
+static const StringID STR_1014_TRAIN_DEPOT_ORIENTATION = 0x1014;
+static const StringID STR_1015_RAILROAD_CONSTRUCTION = 0x1015;
+static const StringID STR_TOOLB_ELRAIL_CONSTRUCTION = 0x1016;
+static const StringID STR_1016_MONORAIL_CONSTRUCTION = 0x1017;
+static const StringID STR_1017_MAGLEV_CONSTRUCTION = 0x1018;
+static const StringID STR_1018_BUILD_RAILROAD_TRACK = 0x1019;
+static const StringID STR_1019_BUILD_TRAIN_DEPOT_FOR_BUILDING = 0x101A;
+static const StringID STR_101A_BUILD_RAILROAD_STATION = 0x101B;
+static const StringID STR_101B_BUILD_RAILROAD_SIGNALS = 0x101C;
+static const StringID STR_101C_BUILD_RAILROAD_BRIDGE = 0x101D;
+static const StringID STR_101D_BUILD_RAILROAD_TUNNEL = 0x101E;
+static const StringID STR_101E_TOGGLE_BUILD_REMOVE_FOR = 0x101F;
+static const StringID STR_101F_BRIDGE_SELECTION_CLICK = 0x1020;
+static const StringID STR_1020_SELECT_RAILROAD_DEPOT_ORIENTATIO = 0x1021;
+static const StringID STR_1021_RAILROAD_TRACK = 0x1022;
+static const StringID STR_1023_RAILROAD_TRAIN_DEPOT = 0x1023;
+static const StringID STR_1024_AREA_IS_OWNED_BY_ANOTHER = 0x1024;
+static const StringID STR_RAILROAD_TRACK_WITH_NORMAL_SIGNALS = 0x1025;
+static const StringID STR_RAILROAD_TRACK_WITH_PRESIGNALS = 0x1026;
+static const StringID STR_RAILROAD_TRACK_WITH_EXITSIGNALS = 0x1027;
+static const StringID STR_RAILROAD_TRACK_WITH_COMBOSIGNALS = 0x1028;
+static const StringID STR_RAILROAD_TRACK_WITH_NORMAL_PRESIGNALS = 0x1029;
+static const StringID STR_RAILROAD_TRACK_WITH_NORMAL_EXITSIGNALS = 0x102A;
+static const StringID STR_RAILROAD_TRACK_WITH_NORMAL_COMBOSIGNALS = 0x102B;
+static const StringID STR_RAILROAD_TRACK_WITH_PRE_EXITSIGNALS = 0x102C;
+static const StringID STR_RAILROAD_TRACK_WITH_PRE_COMBOSIGNALS = 0x102D;
+static const StringID STR_RAILROAD_TRACK_WITH_EXIT_COMBOSIGNALS = 0x102E;
+static const StringID STR_MUST_REMOVE_RAILWAY_STATION_FIRST = 0x102F;
+
+static const StringID STR_1801_MUST_REMOVE_ROAD_FIRST = 0x1800;
+static const StringID STR_ROAD_WORKS_IN_PROGRESS = 0x1801;
+static const StringID STR_1802_ROAD_CONSTRUCTION = 0x1802;
+static const StringID STR_WHITE_TRAMWAY_CONSTRUCTION = 0x1803;
+static const StringID STR_1803_SELECT_ROAD_BRIDGE = 0x1804;
+static const StringID STR_ERR_ONEWAY_ROADS_CAN_T_HAVE_JUNCTION = 0x1805;
+static const StringID STR_1804_CAN_T_BUILD_ROAD_HERE = 0x1806;
+static const StringID STR_CAN_T_BUILD_TRAMWAY_HERE = 0x1807;
+static const StringID STR_1805_CAN_T_REMOVE_ROAD_FROM = 0x1808;
+static const StringID STR_CAN_T_REMOVE_TRAMWAY_FROM = 0x1809;
+static const StringID STR_1806_ROAD_DEPOT_ORIENTATION = 0x180A;
+static const StringID STR_TRAM_DEPOT_ORIENTATION = 0x180B;
+static const StringID STR_1807_CAN_T_BUILD_ROAD_VEHICLE = 0x180C;
+static const StringID STR_CAN_T_BUILD_TRAM_VEHICLE = 0x180D;
+static const StringID STR_1808_CAN_T_BUILD_BUS_STATION = 0x180E;
+static const StringID STR_1809_CAN_T_BUILD_TRUCK_STATION = 0x180F;
+static const StringID STR_CAN_T_BUILD_PASSENGER_TRAM_STATION = 0x1810;
+static const StringID STR_CAN_T_BUILD_CARGO_TRAM_STATION = 0x1811;
+static const StringID STR_180A_ROAD_CONSTRUCTION = 0x1812;
+static const StringID STR_TRAMWAY_CONSTRUCTION = 0x1813;
+static const StringID STR_180B_BUILD_ROAD_SECTION = 0x1814;
+static const StringID STR_BUILD_AUTOROAD_TIP = 0x1815;
+static const StringID STR_BUILD_TRAMWAY_SECTION = 0x1816;
+static const StringID STR_BUILD_AUTOTRAM_TIP = 0x1817;
+static const StringID STR_180C_BUILD_ROAD_VEHICLE_DEPOT = 0x1818;
+static const StringID STR_BUILD_TRAM_VEHICLE_DEPOT = 0x1819;
+static const StringID STR_180D_BUILD_BUS_STATION = 0x181A;
+static const StringID STR_180E_BUILD_TRUCK_LOADING_BAY = 0x181B;
+static const StringID STR_BUILD_PASSENGER_TRAM_STATION = 0x181C;
+static const StringID STR_BUILD_CARGO_TRAM_STATION = 0x181D;
+static const StringID STR_180F_BUILD_ROAD_BRIDGE = 0x181E;
+static const StringID STR_BUILD_TRAMWAY_BRIDGE = 0x181F;
+static const StringID STR_1810_BUILD_ROAD_TUNNEL = 0x1820;
+static const StringID STR_BUILD_TRAMWAY_TUNNEL = 0x1821;
+static const StringID STR_TOGGLE_ONE_WAY_ROAD = 0x1822;
+static const StringID STR_1811_TOGGLE_BUILD_REMOVE_FOR = 0x1823;
+static const StringID STR_TOGGLE_BUILD_REMOVE_FOR_TRAMWAYS = 0x1824;
+static const StringID STR_1813_SELECT_ROAD_VEHICLE_DEPOT = 0x1825;
+static const StringID STR_SELECT_TRAM_VEHICLE_DEPOT = 0x1826;
+static const StringID STR_1814_ROAD = 0x1827;
+static const StringID STR_1815_ROAD_WITH_STREETLIGHTS = 0x1828;
+static const StringID STR_1816_TREE_LINED_ROAD = 0x1829;
+static const StringID STR_1817_ROAD_VEHICLE_DEPOT = 0x182A;
+static const StringID STR_1818_ROAD_RAIL_LEVEL_CROSSING = 0x182B;
+static const StringID STR_CAN_T_REMOVE_BUS_STATION = 0x182C;
+static const StringID STR_CAN_T_REMOVE_TRUCK_STATION = 0x182D;
+static const StringID STR_CAN_T_REMOVE_PASSENGER_TRAM_STATION = 0x182E;
+static const StringID STR_CAN_T_REMOVE_CARGO_TRAM_STATION = 0x182F;
+
+static const StringID STR_2000_TOWNS = 0x2000;
+static const StringID STR_TOWN_LABEL_POP = 0x2001;
+static const StringID STR_TOWN_LABEL = 0x2002;
+static const StringID STR_TOWN_LABEL_TINY_BLACK = 0x2003;
+static const StringID STR_TOWN_LABEL_TINY_WHITE = 0x2004;
+static const StringID STR_2002 = 0x2005;
+static const StringID STR_2002_WHITE = 0x2006;
+static const StringID STR_2004_BUILDING_MUST_BE_DEMOLISHED = 0x2007;
+static const StringID STR_2005 = 0x2008;
+static const StringID STR_CITY = 0x2009;
+static const StringID STR_2006_POPULATION = 0x200A;
+static const StringID STR_2007_RENAME_TOWN = 0x200B;
+static const StringID STR_2008_CAN_T_RENAME_TOWN = 0x200C;
+static const StringID STR_2009_LOCAL_AUTHORITY_REFUSES = 0x200D;
+static const StringID STR_200A_TOWN_NAMES_CLICK_ON_NAME = 0x200E;
+static const StringID STR_200B_CENTER_THE_MAIN_VIEW_ON = 0x200F;
+static const StringID STR_200C_CHANGE_TOWN_NAME = 0x2010;
+static const StringID STR_200D_PASSENGERS_LAST_MONTH_MAX = 0x2011;
+static const StringID STR_200E_MAIL_LAST_MONTH_MAX = 0x2012;
+static const StringID STR_200F_TALL_OFFICE_BLOCK = 0x2013;
+static const StringID STR_2010_OFFICE_BLOCK = 0x2014;
+static const StringID STR_2011_SMALL_BLOCK_OF_FLATS = 0x2015;
+static const StringID STR_2012_CHURCH = 0x2016;
+static const StringID STR_2013_LARGE_OFFICE_BLOCK = 0x2017;
+static const StringID STR_2014_TOWN_HOUSES = 0x2018;
+static const StringID STR_2015_HOTEL = 0x2019;
+static const StringID STR_2016_STATUE = 0x201A;
+static const StringID STR_2017_FOUNTAIN = 0x201B;
+static const StringID STR_2018_PARK = 0x201C;
+static const StringID STR_2019_OFFICE_BLOCK = 0x201D;
+static const StringID STR_201A_SHOPS_AND_OFFICES = 0x201E;
+static const StringID STR_201B_MODERN_OFFICE_BUILDING = 0x201F;
+static const StringID STR_201C_WAREHOUSE = 0x2020;
+static const StringID STR_201D_OFFICE_BLOCK = 0x2021;
+static const StringID STR_201E_STADIUM = 0x2022;
+static const StringID STR_201F_OLD_HOUSES = 0x2023;
+static const StringID STR_2020_LOCAL_AUTHORITY = 0x2024;
+static const StringID STR_2021_SHOW_INFORMATION_ON_LOCAL = 0x2025;
+static const StringID STR_2022_LOCAL_AUTHORITY = 0x2026;
+static const StringID STR_2023_TRANSPORT_COMPANY_RATINGS = 0x2027;
+static const StringID STR_2024 = 0x2028;
+static const StringID STR_2025_SUBSIDIES = 0x2029;
+static const StringID STR_2026_SUBSIDIES_ON_OFFER_FOR = 0x202A;
+static const StringID STR_2027_FROM_TO = 0x202B;
+static const StringID STR_2028_BY = 0x202C;
+static const StringID STR_202A_NONE = 0x202D;
+static const StringID STR_202B_SERVICES_ALREADY_SUBSIDISED = 0x202E;
+static const StringID STR_202C_FROM_TO = 0x202F;
+static const StringID STR_202D_UNTIL = 0x2030;
+static const StringID STR_202E_OFFER_OF_SUBSIDY_EXPIRED = 0x2031;
+static const StringID STR_202F_SUBSIDY_WITHDRAWN_SERVICE = 0x2032;
+static const StringID STR_2030_SERVICE_SUBSIDY_OFFERED = 0x2033;
+static const StringID STR_2031_SERVICE_SUBSIDY_AWARDED = 0x2034;
+static const StringID STR_2032_SERVICE_SUBSIDY_AWARDED = 0x2035;
+static const StringID STR_2033_SERVICE_SUBSIDY_AWARDED = 0x2036;
+static const StringID STR_2034_SERVICE_SUBSIDY_AWARDED = 0x2037;
+static const StringID STR_2035_LOCAL_AUTHORITY_REFUSES = 0x2038;
+static const StringID STR_2036_COTTAGES = 0x2039;
+static const StringID STR_2037_HOUSES = 0x203A;
+static const StringID STR_2038_FLATS = 0x203B;
+static const StringID STR_2039_TALL_OFFICE_BLOCK = 0x203C;
+static const StringID STR_203A_SHOPS_AND_OFFICES = 0x203D;
+static const StringID STR_203B_SHOPS_AND_OFFICES = 0x203E;
+static const StringID STR_203C_THEATER = 0x203F;
+static const StringID STR_203D_STADIUM = 0x2040;
+static const StringID STR_203E_OFFICES = 0x2041;
+static const StringID STR_203F_HOUSES = 0x2042;
+static const StringID STR_2040_CINEMA = 0x2043;
+static const StringID STR_2041_SHOPPING_MALL = 0x2044;
+static const StringID STR_2042_DO_IT = 0x2045;
+static const StringID STR_2043_LIST_OF_THINGS_TO_DO_AT = 0x2046;
+static const StringID STR_2044_CARRY_OUT_THE_HIGHLIGHTED = 0x2047;
+static const StringID STR_2045_ACTIONS_AVAILABLE = 0x2048;
+static const StringID STR_2046_SMALL_ADVERTISING_CAMPAIGN = 0x2049;
+static const StringID STR_2047_MEDIUM_ADVERTISING_CAMPAIGN = 0x204A;
+static const StringID STR_2048_LARGE_ADVERTISING_CAMPAIGN = 0x204B;
+static const StringID STR_2049_FUND_LOCAL_ROAD_RECONSTRUCTION = 0x204C;
+static const StringID STR_204A_BUILD_STATUE_OF_COMPANY = 0x204D;
+static const StringID STR_204B_FUND_NEW_BUILDINGS = 0x204E;
+static const StringID STR_204C_BUY_EXCLUSIVE_TRANSPORT = 0x204F;
+static const StringID STR_TOWN_BRIBE_THE_LOCAL_AUTHORITY = 0x2050;
+static const StringID STR_204D_INITIATE_A_SMALL_LOCAL = 0x2051;
+static const StringID STR_204E_INITIATE_A_MEDIUM_LOCAL = 0x2052;
+static const StringID STR_204F_INITIATE_A_LARGE_LOCAL = 0x2053;
+static const StringID STR_2050_FUND_THE_RECONSTRUCTION = 0x2054;
+static const StringID STR_2051_BUILD_A_STATUE_IN_HONOR = 0x2055;
+static const StringID STR_2052_FUND_THE_CONSTRUCTION_OF = 0x2056;
+static const StringID STR_2053_BUY_1_YEAR_S_EXCLUSIVE = 0x2057;
+static const StringID STR_TOWN_BRIBE_THE_LOCAL_AUTHORITY_DESC = 0x2058;
+static const StringID STR_2055_TRAFFIC_CHAOS_IN_ROAD_REBUILDING = 0x2059;
+static const StringID STR_2056 = 0x205A;
+static const StringID STR_2057 = 0x205B;
+static const StringID STR_2058_UNDER_CONSTRUCTION = 0x205C;
+static const StringID STR_2059_IGLOO = 0x205D;
+static const StringID STR_205A_TEPEES = 0x205E;
+static const StringID STR_205B_TEAPOT_HOUSE = 0x205F;
+static const StringID STR_205C_PIGGY_BANK = 0x2060;
+static const StringID STR_INDUSTRY = 0x2061;
+static const StringID STR_TOWN = 0x2062;
+static const StringID STR_INDUSTRY_FORMAT = 0x2063;
+static const StringID STR_STATION = 0x2064;
+
+static const StringID STR_LANDSCAPING = 0x2800;
+static const StringID STR_2800_PLANT_TREES = 0x2801;
+static const StringID STR_2801_PLACE_SIGN = 0x2802;
+static const StringID STR_2802_TREES = 0x2803;
+static const StringID STR_2803_TREE_ALREADY_HERE = 0x2804;
+static const StringID STR_2804_SITE_UNSUITABLE = 0x2805;
+static const StringID STR_2805_CAN_T_PLANT_TREE_HERE = 0x2806;
+static const StringID STR_2806 = 0x2807;
+static const StringID STR_2808_TOO_MANY_SIGNS = 0x2808;
+static const StringID STR_2809_CAN_T_PLACE_SIGN_HERE = 0x2809;
+static const StringID STR_280A_SIGN = 0x280A;
+static const StringID STR_280B_EDIT_SIGN_TEXT = 0x280B;
+static const StringID STR_280C_CAN_T_CHANGE_SIGN_NAME = 0x280C;
+static const StringID STR_280D_SELECT_TREE_TYPE_TO_PLANT = 0x280D;
+static const StringID STR_280E_TREES = 0x280E;
+static const StringID STR_280F_RAINFOREST = 0x280F;
+static const StringID STR_2810_CACTUS_PLANTS = 0x2810;
+
+static const StringID STR_3000_RAIL_STATION_SELECTION = 0x3000;
+static const StringID STR_3001_AIRPORT_SELECTION = 0x3001;
+static const StringID STR_3002_ORIENTATION = 0x3002;
+static const StringID STR_3003_NUMBER_OF_TRACKS = 0x3003;
+static const StringID STR_3004_PLATFORM_LENGTH = 0x3004;
+static const StringID STR_3005_TOO_CLOSE_TO_ANOTHER_RAILROAD = 0x3005;
+static const StringID STR_3006_ADJOINS_MORE_THAN_ONE_EXISTING = 0x3006;
+static const StringID STR_3007_TOO_MANY_STATIONS_LOADING = 0x3007;
+static const StringID STR_3008_TOO_MANY_STATIONS_LOADING = 0x3008;
+static const StringID STR_TOO_MANY_BUS_STOPS = 0x3009;
+static const StringID STR_TOO_MANY_TRUCK_STOPS = 0x300A;
+static const StringID STR_3009_TOO_CLOSE_TO_ANOTHER_STATION = 0x300B;
+static const StringID STR_300A_0 = 0x300C;
+static const StringID STR_300B_MUST_DEMOLISH_RAILROAD = 0x300D;
+static const StringID STR_300D_TOO_CLOSE_TO_ANOTHER_AIRPORT = 0x300E;
+static const StringID STR_300E_MUST_DEMOLISH_AIRPORT_FIRST = 0x300F;
+static const StringID STR_3030_RENAME_STATION_LOADING = 0x3010;
+static const StringID STR_3031_CAN_T_RENAME_STATION = 0x3011;
+static const StringID STR_3032_RATINGS = 0x3012;
+static const StringID STR_3033_ACCEPTS = 0x3013;
+static const StringID STR_3034_LOCAL_RATING_OF_TRANSPORT = 0x3014;
+static const StringID STR_3035_APPALLING = 0x3015;
+static const StringID STR_3036_VERY_POOR = 0x3016;
+static const StringID STR_3037_POOR = 0x3017;
+static const StringID STR_3038_MEDIOCRE = 0x3018;
+static const StringID STR_3039_GOOD = 0x3019;
+static const StringID STR_303A_VERY_GOOD = 0x301A;
+static const StringID STR_303B_EXCELLENT = 0x301B;
+static const StringID STR_303C_OUTSTANDING = 0x301C;
+static const StringID STR_303D = 0x301D;
+static const StringID STR_303E_NO_LONGER_ACCEPTS = 0x301E;
+static const StringID STR_303F_NO_LONGER_ACCEPTS_OR = 0x301F;
+static const StringID STR_3040_NOW_ACCEPTS = 0x3020;
+static const StringID STR_3041_NOW_ACCEPTS_AND = 0x3021;
+static const StringID STR_3042_BUS_STATION_ORIENTATION = 0x3022;
+static const StringID STR_3043_TRUCK_STATION_ORIENT = 0x3023;
+static const StringID STR_PASSENGER_TRAM_STATION_ORIENTATION = 0x3024;
+static const StringID STR_CARGO_TRAM_STATION_ORIENT = 0x3025;
+static const StringID STR_3046_MUST_DEMOLISH_BUS_STATION = 0x3026;
+static const StringID STR_3047_MUST_DEMOLISH_TRUCK_STATION = 0x3027;
+static const StringID STR_MUST_DEMOLISH_PASSENGER_TRAM_STATION = 0x3028;
+static const StringID STR_MUST_DEMOLISH_CARGO_TRAM_STATION = 0x3029;
+static const StringID STR_3048_STATIONS = 0x302A;
+static const StringID STR_3049_0 = 0x302B;
+static const StringID STR_304A_NONE = 0x302C;
+static const StringID STR_304B_SITE_UNSUITABLE = 0x302D;
+static const StringID STR_304C_TOO_CLOSE_TO_ANOTHER_DOCK = 0x302E;
+static const StringID STR_304D_MUST_DEMOLISH_DOCK_FIRST = 0x302F;
+static const StringID STR_304E_SELECT_RAILROAD_STATION = 0x3030;
+static const StringID STR_304F_SELECT_NUMBER_OF_PLATFORMS = 0x3031;
+static const StringID STR_3050_SELECT_LENGTH_OF_RAILROAD = 0x3032;
+static const StringID STR_3051_SELECT_BUS_STATION_ORIENTATION = 0x3033;
+static const StringID STR_3052_SELECT_TRUCK_LOADING_BAY = 0x3034;
+static const StringID STR_SELECT_PASSENGER_TRAM_STATION_ORIENTATION = 0x3035;
+static const StringID STR_SELECT_CARGO_TRAM_STATION_ORIENTATION = 0x3036;
+static const StringID STR_3053_CENTER_MAIN_VIEW_ON_STATION = 0x3037;
+static const StringID STR_3054_SHOW_STATION_RATINGS = 0x3038;
+static const StringID STR_3055_CHANGE_NAME_OF_STATION = 0x3039;
+static const StringID STR_3056_SHOW_LIST_OF_ACCEPTED_CARGO = 0x303A;
+static const StringID STR_3057_STATION_NAMES_CLICK_ON = 0x303B;
+static const StringID STR_3058_SELECT_SIZE_TYPE_OF_AIRPORT = 0x303C;
+static const StringID STR_305C_0 = 0x303D;
+static const StringID STR_STATION_SIGN_TINY = 0x303E;
+static const StringID STR_305E_RAILROAD_STATION = 0x303F;
+static const StringID STR_305F_AIRCRAFT_HANGAR = 0x3040;
+static const StringID STR_3060_AIRPORT = 0x3041;
+static const StringID STR_3061_TRUCK_LOADING_AREA = 0x3042;
+static const StringID STR_3062_BUS_STATION = 0x3043;
+static const StringID STR_3063_SHIP_DOCK = 0x3044;
+static const StringID STR_3064_HIGHLIGHT_COVERAGE_AREA = 0x3045;
+static const StringID STR_3065_DON_T_HIGHLIGHT_COVERAGE = 0x3046;
+static const StringID STR_3066_COVERAGE_AREA_HIGHLIGHT = 0x3047;
+static const StringID STR_3068_DOCK = 0x3048;
+static const StringID STR_3069_BUOY = 0x3049;
+static const StringID STR_306A_BUOY_IN_THE_WAY = 0x304A;
+static const StringID STR_306C_STATION_TOO_SPREAD_OUT = 0x304B;
+static const StringID STR_NONUNIFORM_STATIONS_DISALLOWED = 0x304C;
+static const StringID STR_USE_CTRL_TO_SELECT_MORE = 0x304D;
+static const StringID STR_UNDEFINED = 0x304E;
+static const StringID STR_STAT_CLASS_DFLT = 0x304F;
+static const StringID STR_STAT_CLASS_WAYP = 0x3050;
+
+static const StringID STR_3800_SHIP_DEPOT_ORIENTATION = 0x3800;
+static const StringID STR_3801_MUST_BE_BUILT_ON_WATER = 0x3801;
+static const StringID STR_3802_CAN_T_BUILD_SHIP_DEPOT = 0x3802;
+static const StringID STR_3803_SELECT_SHIP_DEPOT_ORIENTATION = 0x3803;
+static const StringID STR_3804_WATER = 0x3804;
+static const StringID STR_3805_COAST_OR_RIVERBANK = 0x3805;
+static const StringID STR_3806_SHIP_DEPOT = 0x3806;
+static const StringID STR_3807_CAN_T_BUILD_ON_WATER = 0x3807;
+static const StringID STR_MUST_DEMOLISH_CANAL_FIRST = 0x3808;
+
+static const StringID STR_4000_SAVE_GAME = 0x4000;
+static const StringID STR_4001_LOAD_GAME = 0x4001;
+static const StringID STR_4002_SAVE = 0x4002;
+static const StringID STR_4003_DELETE = 0x4003;
+static const StringID STR_4004 = 0x4004;
+static const StringID STR_4005_BYTES_FREE = 0x4005;
+static const StringID STR_4006_UNABLE_TO_READ_DRIVE = 0x4006;
+static const StringID STR_4007_GAME_SAVE_FAILED = 0x4007;
+static const StringID STR_4008_UNABLE_TO_DELETE_FILE = 0x4008;
+static const StringID STR_4009_GAME_LOAD_FAILED = 0x4009;
+static const StringID STR_GAME_SAVELOAD_ERROR_BROKEN_INTERNAL_ERROR = 0x400A;
+static const StringID STR_GAME_SAVELOAD_ERROR_BROKEN_SAVEGAME = 0x400B;
+static const StringID STR_GAME_SAVELOAD_ERROR_TOO_NEW_SAVEGAME = 0x400C;
+static const StringID STR_GAME_SAVELOAD_ERROR_FILE_NOT_READABLE = 0x400D;
+static const StringID STR_GAME_SAVELOAD_ERROR_FILE_NOT_WRITEABLE = 0x400E;
+static const StringID STR_400A_LIST_OF_DRIVES_DIRECTORIES = 0x400F;
+static const StringID STR_400B_CURRENTLY_SELECTED_NAME = 0x4010;
+static const StringID STR_400C_DELETE_THE_CURRENTLY_SELECTED = 0x4011;
+static const StringID STR_400D_SAVE_THE_CURRENT_GAME_USING = 0x4012;
+static const StringID STR_400E_SELECT_NEW_GAME_TYPE = 0x4013;
+static const StringID STR_400F_SELECT_SCENARIO_GREEN_PRE = 0x4014;
+static const StringID STR_4010_GENERATE_RANDOM_NEW_GAME = 0x4015;
+static const StringID STR_LOAD_HEIGHTMAP = 0x4016;
+static const StringID STR_SAVELOAD_SAVE_HEIGHTMAP = 0x4017;
+
+static const StringID STR_4800_IN_THE_WAY = 0x4800;
+static const StringID STR_4801 = 0x4801;
+static const StringID STR_4802_COAL_MINE = 0x4802;
+static const StringID STR_4803_POWER_STATION = 0x4803;
+static const StringID STR_4804_SAWMILL = 0x4804;
+static const StringID STR_4805_FOREST = 0x4805;
+static const StringID STR_4806_OIL_REFINERY = 0x4806;
+static const StringID STR_4807_OIL_RIG = 0x4807;
+static const StringID STR_4808_FACTORY = 0x4808;
+static const StringID STR_4809_PRINTING_WORKS = 0x4809;
+static const StringID STR_480A_STEEL_MILL = 0x480A;
+static const StringID STR_480B_FARM = 0x480B;
+static const StringID STR_480C_COPPER_ORE_MINE = 0x480C;
+static const StringID STR_480D_OIL_WELLS = 0x480D;
+static const StringID STR_480E_BANK = 0x480E;
+static const StringID STR_480F_FOOD_PROCESSING_PLANT = 0x480F;
+static const StringID STR_4810_PAPER_MILL = 0x4810;
+static const StringID STR_4811_GOLD_MINE = 0x4811;
+static const StringID STR_4812_BANK = 0x4812;
+static const StringID STR_4813_DIAMOND_MINE = 0x4813;
+static const StringID STR_4814_IRON_ORE_MINE = 0x4814;
+static const StringID STR_4815_FRUIT_PLANTATION = 0x4815;
+static const StringID STR_4816_RUBBER_PLANTATION = 0x4816;
+static const StringID STR_4817_WATER_SUPPLY = 0x4817;
+static const StringID STR_4818_WATER_TOWER = 0x4818;
+static const StringID STR_4819_FACTORY = 0x4819;
+static const StringID STR_481A_FARM = 0x481A;
+static const StringID STR_481B_LUMBER_MILL = 0x481B;
+static const StringID STR_481C_COTTON_CANDY_FOREST = 0x481C;
+static const StringID STR_481D_CANDY_FACTORY = 0x481D;
+static const StringID STR_481E_BATTERY_FARM = 0x481E;
+static const StringID STR_481F_COLA_WELLS = 0x481F;
+static const StringID STR_4820_TOY_SHOP = 0x4820;
+static const StringID STR_4821_TOY_FACTORY = 0x4821;
+static const StringID STR_4822_PLASTIC_FOUNTAINS = 0x4822;
+static const StringID STR_4823_FIZZY_DRINK_FACTORY = 0x4823;
+static const StringID STR_4824_BUBBLE_GENERATOR = 0x4824;
+static const StringID STR_4825_TOFFEE_QUARRY = 0x4825;
+static const StringID STR_4826_SUGAR_MINE = 0x4826;
+static const StringID STR_4827_REQUIRES = 0x4827;
+static const StringID STR_4828_REQUIRES = 0x4828;
+static const StringID STR_4829_REQUIRES = 0x4829;
+static const StringID STR_INDUSTRY_WINDOW_WAITING_FOR_PROCESSING = 0x482A;
+static const StringID STR_INDUSTRY_WINDOW_WAITING_STOCKPILE_CARGO = 0x482B;
+static const StringID STR_4827_PRODUCES = 0x482C;
+static const StringID STR_4828_PRODUCES = 0x482D;
+static const StringID STR_482A_PRODUCTION_LAST_MONTH = 0x482E;
+static const StringID STR_482B_TRANSPORTED = 0x482F;
+static const StringID STR_482C_CENTER_THE_MAIN_VIEW_ON = 0x4830;
+static const StringID STR_482D_NEW_UNDER_CONSTRUCTION = 0x4831;
+static const StringID STR_482E_NEW_BEING_PLANTED_NEAR = 0x4832;
+static const StringID STR_482F_COST = 0x4833;
+static const StringID STR_4830_CAN_T_CONSTRUCT_THIS_INDUSTRY = 0x4834;
+static const StringID STR_4831_FOREST_CAN_ONLY_BE_PLANTED = 0x4835;
+static const StringID STR_4832_ANNOUNCES_IMMINENT_CLOSURE = 0x4836;
+static const StringID STR_4833_SUPPLY_PROBLEMS_CAUSE_TO = 0x4837;
+static const StringID STR_4834_LACK_OF_NEARBY_TREES_CAUSES = 0x4838;
+static const StringID STR_4835_INCREASES_PRODUCTION = 0x4839;
+static const StringID STR_4836_NEW_COAL_SEAM_FOUND_AT = 0x483A;
+static const StringID STR_4837_NEW_OIL_RESERVES_FOUND = 0x483B;
+static const StringID STR_4838_IMPROVED_FARMING_METHODS = 0x483C;
+static const StringID STR_4839_PRODUCTION_DOWN_BY_50 = 0x483D;
+static const StringID STR_483A_INSECT_INFESTATION_CAUSES = 0x483E;
+static const StringID STR_483B_CAN_ONLY_BE_POSITIONED = 0x483F;
+static const StringID STR_INDUSTRY_PROD_GOUP = 0x4840;
+static const StringID STR_INDUSTRY_PROD_GODOWN = 0x4841;
+
+static const StringID STR_5000_TRAIN_IN_TUNNEL = 0x5000;
+static const StringID STR_5001_ROAD_VEHICLE_IN_TUNNEL = 0x5001;
+static const StringID STR_5003_ANOTHER_TUNNEL_IN_THE_WAY = 0x5002;
+static const StringID STR_5005_UNABLE_TO_EXCAVATE_LAND = 0x5003;
+static const StringID STR_5006_MUST_DEMOLISH_TUNNEL_FIRST = 0x5004;
+static const StringID STR_5007_MUST_DEMOLISH_BRIDGE_FIRST = 0x5005;
+static const StringID STR_5008_CANNOT_START_AND_END_ON = 0x5006;
+static const StringID STR_BRIDGEHEADS_NOT_SAME_HEIGHT = 0x5007;
+static const StringID STR_BRIDGE_TOO_LOW_FOR_TERRAIN = 0x5008;
+static const StringID STR_500A_START_AND_END_MUST_BE_IN = 0x5009;
+static const StringID STR_500B_SITE_UNSUITABLE_FOR_TUNNEL = 0x500A;
+static const StringID STR_500D = 0x500B;
+static const StringID STR_500E_SUSPENSION_STEEL = 0x500C;
+static const StringID STR_500F_GIRDER_STEEL = 0x500D;
+static const StringID STR_5010_CANTILEVER_STEEL = 0x500E;
+static const StringID STR_5011_SUSPENSION_CONCRETE = 0x500F;
+static const StringID STR_5012_WOODEN = 0x5010;
+static const StringID STR_5013_CONCRETE = 0x5011;
+static const StringID STR_5014_TUBULAR_STEEL = 0x5012;
+static const StringID STR_BRIDGE_TUBULAR_SILICON = 0x5013;
+static const StringID STR_5015_CAN_T_BUILD_BRIDGE_HERE = 0x5014;
+static const StringID STR_5016_CAN_T_BUILD_TUNNEL_HERE = 0x5015;
+static const StringID STR_5017_RAILROAD_TUNNEL = 0x5016;
+static const StringID STR_5018_ROAD_TUNNEL = 0x5017;
+static const StringID STR_501B_STEEL_SUSPENSION_RAIL_BRIDGE = 0x5018;
+static const StringID STR_501C_STEEL_GIRDER_RAIL_BRIDGE = 0x5019;
+static const StringID STR_501D_STEEL_CANTILEVER_RAIL_BRIDGE = 0x501A;
+static const StringID STR_501E_REINFORCED_CONCRETE_SUSPENSION = 0x501B;
+static const StringID STR_501F_WOODEN_RAIL_BRIDGE = 0x501C;
+static const StringID STR_5020_CONCRETE_RAIL_BRIDGE = 0x501D;
+static const StringID STR_5021_STEEL_SUSPENSION_ROAD_BRIDGE = 0x501E;
+static const StringID STR_5022_STEEL_GIRDER_ROAD_BRIDGE = 0x501F;
+static const StringID STR_5023_STEEL_CANTILEVER_ROAD_BRIDGE = 0x5020;
+static const StringID STR_5024_REINFORCED_CONCRETE_SUSPENSION = 0x5021;
+static const StringID STR_5025_WOODEN_ROAD_BRIDGE = 0x5022;
+static const StringID STR_5026_CONCRETE_ROAD_BRIDGE = 0x5023;
+static const StringID STR_5027_TUBULAR_RAIL_BRIDGE = 0x5024;
+static const StringID STR_5028_TUBULAR_ROAD_BRIDGE = 0x5025;
+
+static const StringID STR_5800_OBJECT_IN_THE_WAY = 0x5800;
+static const StringID STR_5801_TRANSMITTER = 0x5801;
+static const StringID STR_5802_LIGHTHOUSE = 0x5802;
+static const StringID STR_5803_COMPANY_HEADQUARTERS = 0x5803;
+static const StringID STR_5804_COMPANY_HEADQUARTERS_IN = 0x5804;
+static const StringID STR_5805_COMPANY_OWNED_LAND = 0x5805;
+static const StringID STR_5806_CAN_T_PURCHASE_THIS_LAND = 0x5806;
+static const StringID STR_5807_YOU_ALREADY_OWN_IT = 0x5807;
+
+static const StringID STR_SV_EMPTY = 0x6000;
+static const StringID STR_SV_UNNAMED = 0x6001;
+static const StringID STR_SV_TRAIN_NAME = 0x6002;
+static const StringID STR_SV_ROADVEH_NAME = 0x6003;
+static const StringID STR_SV_SHIP_NAME = 0x6004;
+static const StringID STR_SV_AIRCRAFT_NAME = 0x6005;
+static const StringID STR_SV_STNAME = 0x6006;
+static const StringID STR_SV_STNAME_NORTH = 0x6007;
+static const StringID STR_SV_STNAME_SOUTH = 0x6008;
+static const StringID STR_SV_STNAME_EAST = 0x6009;
+static const StringID STR_SV_STNAME_WEST = 0x600A;
+static const StringID STR_SV_STNAME_CENTRAL = 0x600B;
+static const StringID STR_SV_STNAME_TRANSFER = 0x600C;
+static const StringID STR_SV_STNAME_HALT = 0x600D;
+static const StringID STR_SV_STNAME_VALLEY = 0x600E;
+static const StringID STR_SV_STNAME_HEIGHTS = 0x600F;
+static const StringID STR_SV_STNAME_WOODS = 0x6010;
+static const StringID STR_SV_STNAME_LAKESIDE = 0x6011;
+static const StringID STR_SV_STNAME_EXCHANGE = 0x6012;
+static const StringID STR_SV_STNAME_AIRPORT = 0x6013;
+static const StringID STR_SV_STNAME_OILFIELD = 0x6014;
+static const StringID STR_SV_STNAME_MINES = 0x6015;
+static const StringID STR_SV_STNAME_DOCKS = 0x6016;
+static const StringID STR_SV_STNAME_BUOY_1 = 0x6017;
+static const StringID STR_SV_STNAME_BUOY_2 = 0x6018;
+static const StringID STR_SV_STNAME_BUOY_3 = 0x6019;
+static const StringID STR_SV_STNAME_BUOY_4 = 0x601A;
+static const StringID STR_SV_STNAME_BUOY_5 = 0x601B;
+static const StringID STR_SV_STNAME_BUOY_6 = 0x601C;
+static const StringID STR_SV_STNAME_BUOY_7 = 0x601D;
+static const StringID STR_SV_STNAME_BUOY_8 = 0x601E;
+static const StringID STR_SV_STNAME_BUOY_9 = 0x601F;
+static const StringID STR_SV_STNAME_ANNEXE = 0x6020;
+static const StringID STR_SV_STNAME_SIDINGS = 0x6021;
+static const StringID STR_SV_STNAME_BRANCH = 0x6022;
+static const StringID STR_SV_STNAME_UPPER = 0x6023;
+static const StringID STR_SV_STNAME_LOWER = 0x6024;
+static const StringID STR_SV_STNAME_HELIPORT = 0x6025;
+static const StringID STR_SV_STNAME_FOREST = 0x6026;
+static const StringID STR_SV_STNAME_FALLBACK = 0x6027;
+
+static const StringID STR_6800_DIFFICULTY_LEVEL = 0x6800;
+static const StringID STR_OPTIONS_SAVE_CHANGES = 0x6801;
+static const StringID STR_6801_EASY = 0x6802;
+static const StringID STR_6802_MEDIUM = 0x6803;
+static const StringID STR_6803_HARD = 0x6804;
+static const StringID STR_6804_CUSTOM = 0x6805;
+static const StringID STR_6805_MAXIMUM_NO_COMPETITORS = 0x6806;
+static const StringID STR_6806_COMPETITOR_START_TIME = 0x6807;
+static const StringID STR_6807_NO_OF_TOWNS = 0x6808;
+static const StringID STR_6808_NO_OF_INDUSTRIES = 0x6809;
+static const StringID STR_6809_MAXIMUM_INITIAL_LOAN_000 = 0x680A;
+static const StringID STR_680A_INITIAL_INTEREST_RATE = 0x680B;
+static const StringID STR_680B_VEHICLE_RUNNING_COSTS = 0x680C;
+static const StringID STR_680C_CONSTRUCTION_SPEED_OF_COMPETITOR = 0x680D;
+static const StringID STR_680D_INTELLIGENCE_OF_COMPETITORS = 0x680E;
+static const StringID STR_680E_VEHICLE_BREAKDOWNS = 0x680F;
+static const StringID STR_680F_SUBSIDY_MULTIPLIER = 0x6810;
+static const StringID STR_6810_COST_OF_CONSTRUCTION = 0x6811;
+static const StringID STR_6811_TERRAIN_TYPE = 0x6812;
+static const StringID STR_6812_QUANTITY_OF_SEA_LAKES = 0x6813;
+static const StringID STR_6813_ECONOMY = 0x6814;
+static const StringID STR_6814_TRAIN_REVERSING = 0x6815;
+static const StringID STR_6815_DISASTERS = 0x6816;
+static const StringID STR_CITY_APPROVAL = 0x6817;
+static const StringID STR_NONE = 0x6818;
+static const StringID STR_NUM_VERY_LOW = 0x6819;
+static const StringID STR_6816_LOW = 0x681A;
+static const StringID STR_6817_NORMAL = 0x681B;
+static const StringID STR_6818_HIGH = 0x681C;
+static const StringID STR_6819 = 0x681D;
+static const StringID STR_681A = 0x681E;
+static const StringID STR_681B_VERY_SLOW = 0x681F;
+static const StringID STR_681C_SLOW = 0x6820;
+static const StringID STR_681D_MEDIUM = 0x6821;
+static const StringID STR_681E_FAST = 0x6822;
+static const StringID STR_681F_VERY_FAST = 0x6823;
+static const StringID STR_VERY_LOW = 0x6824;
+static const StringID STR_6820_LOW = 0x6825;
+static const StringID STR_6821_MEDIUM = 0x6826;
+static const StringID STR_6822_HIGH = 0x6827;
+static const StringID STR_6823_NONE = 0x6828;
+static const StringID STR_6824_REDUCED = 0x6829;
+static const StringID STR_6825_NORMAL = 0x682A;
+static const StringID STR_6826_X1_5 = 0x682B;
+static const StringID STR_6827_X2 = 0x682C;
+static const StringID STR_6828_X3 = 0x682D;
+static const StringID STR_6829_X4 = 0x682E;
+static const StringID STR_682A_VERY_FLAT = 0x682F;
+static const StringID STR_682B_FLAT = 0x6830;
+static const StringID STR_682C_HILLY = 0x6831;
+static const StringID STR_682D_MOUNTAINOUS = 0x6832;
+static const StringID STR_682E_STEADY = 0x6833;
+static const StringID STR_682F_FLUCTUATING = 0x6834;
+static const StringID STR_6830_IMMEDIATE = 0x6835;
+static const StringID STR_6831_3_MONTHS_AFTER_PLAYER = 0x6836;
+static const StringID STR_6832_6_MONTHS_AFTER_PLAYER = 0x6837;
+static const StringID STR_6833_9_MONTHS_AFTER_PLAYER = 0x6838;
+static const StringID STR_6834_AT_END_OF_LINE_AND_AT_STATIONS = 0x6839;
+static const StringID STR_6835_AT_END_OF_LINE_ONLY = 0x683A;
+static const StringID STR_6836_OFF = 0x683B;
+static const StringID STR_6837_ON = 0x683C;
+static const StringID STR_6838_SHOW_HI_SCORE_CHART = 0x683D;
+static const StringID STR_PERMISSIVE = 0x683E;
+static const StringID STR_TOLERANT = 0x683F;
+static const StringID STR_HOSTILE = 0x6840;
+
+static const StringID STR_7000 = 0x7000;
+static const StringID STR_7001 = 0x7001;
+static const StringID STR_7002_PLAYER = 0x7002;
+static const StringID STR_7004_NEW_FACE = 0x7003;
+static const StringID STR_7005_COLOR_SCHEME = 0x7004;
+static const StringID STR_7006_COLOR_SCHEME = 0x7005;
+static const StringID STR_7007_NEW_COLOR_SCHEME = 0x7006;
+static const StringID STR_7008_COMPANY_NAME = 0x7007;
+static const StringID STR_7009_PRESIDENT_NAME = 0x7008;
+static const StringID STR_700A_COMPANY_NAME = 0x7009;
+static const StringID STR_700B_PRESIDENT_S_NAME = 0x700A;
+static const StringID STR_700C_CAN_T_CHANGE_COMPANY_NAME = 0x700B;
+static const StringID STR_700D_CAN_T_CHANGE_PRESIDENT = 0x700C;
+static const StringID STR_700E_FINANCES = 0x700D;
+static const StringID STR_700F_EXPENDITURE_INCOME = 0x700E;
+static const StringID STR_7010 = 0x700F;
+static const StringID STR_7011_CONSTRUCTION = 0x7010;
+static const StringID STR_7012_NEW_VEHICLES = 0x7011;
+static const StringID STR_7013_TRAIN_RUNNING_COSTS = 0x7012;
+static const StringID STR_7014_ROAD_VEH_RUNNING_COSTS = 0x7013;
+static const StringID STR_7015_AIRCRAFT_RUNNING_COSTS = 0x7014;
+static const StringID STR_7016_SHIP_RUNNING_COSTS = 0x7015;
+static const StringID STR_7017_PROPERTY_MAINTENANCE = 0x7016;
+static const StringID STR_7018_TRAIN_INCOME = 0x7017;
+static const StringID STR_7019_ROAD_VEHICLES_INCOME = 0x7018;
+static const StringID STR_701A_AIRCRAFT_INCOME = 0x7019;
+static const StringID STR_701B_SHIP_INCOME = 0x701A;
+static const StringID STR_701C_LOAN_INTEREST = 0x701B;
+static const StringID STR_701D_OTHER = 0x701C;
+static const StringID STR_701E = 0x701D;
+static const StringID STR_701F = 0x701E;
+static const StringID STR_7020_TOTAL = 0x701F;
+static const StringID STR_7021 = 0x7020;
+static const StringID STR_7022_INCOME_GRAPH = 0x7021;
+static const StringID STR_CURRCOMPACT = 0x7022;
+static const StringID STR_7024 = 0x7023;
+static const StringID STR_7025_OPERATING_PROFIT_GRAPH = 0x7024;
+static const StringID STR_7026_BANK_BALANCE = 0x7025;
+static const StringID STR_7027_LOAN = 0x7026;
+static const StringID STR_MAX_LOAN = 0x7027;
+static const StringID STR_7028 = 0x7028;
+static const StringID STR_7029_BORROW = 0x7029;
+static const StringID STR_702A_REPAY = 0x702A;
+static const StringID STR_702B_MAXIMUM_PERMITTED_LOAN = 0x702B;
+static const StringID STR_702C_CAN_T_BORROW_ANY_MORE_MONEY = 0x702C;
+static const StringID STR_702D_LOAN_ALREADY_REPAYED = 0x702D;
+static const StringID STR_702E_REQUIRED = 0x702E;
+static const StringID STR_702F_CAN_T_REPAY_LOAN = 0x702F;
+static const StringID STR_INSUFFICIENT_FUNDS = 0x7030;
+static const StringID STR_7030_SELECT_NEW_FACE_FOR_PRESIDENT = 0x7031;
+static const StringID STR_7031_CHANGE_THE_COMPANY_VEHICLE = 0x7032;
+static const StringID STR_7032_CHANGE_THE_PRESIDENT_S = 0x7033;
+static const StringID STR_7033_CHANGE_THE_COMPANY_NAME = 0x7034;
+static const StringID STR_7034_CLICK_ON_SELECTED_NEW_COLOR = 0x7035;
+static const StringID STR_7035_INCREASE_SIZE_OF_LOAN = 0x7036;
+static const StringID STR_7036_REPAY_PART_OF_LOAN = 0x7037;
+static const StringID STR_7037_PRESIDENT = 0x7038;
+static const StringID STR_7038_INAUGURATED = 0x7039;
+static const StringID STR_7039_VEHICLES = 0x703A;
+static const StringID STR_TRAINS = 0x703B;
+static const StringID STR_ROAD_VEHICLES = 0x703C;
+static const StringID STR_AIRCRAFT = 0x703D;
+static const StringID STR_SHIPS = 0x703E;
+static const StringID STR_7042_NONE = 0x703F;
+static const StringID STR_7043_FACE_SELECTION = 0x7040;
+static const StringID STR_7044_MALE = 0x7041;
+static const StringID STR_7045_FEMALE = 0x7042;
+static const StringID STR_7046_NEW_FACE = 0x7043;
+static const StringID STR_7047_CANCEL_NEW_FACE_SELECTION = 0x7044;
+static const StringID STR_7048_ACCEPT_NEW_FACE_SELECTION = 0x7045;
+static const StringID STR_7049_SELECT_MALE_FACES = 0x7046;
+static const StringID STR_704A_SELECT_FEMALE_FACES = 0x7047;
+static const StringID STR_704B_GENERATE_RANDOM_NEW_FACE = 0x7048;
+static const StringID STR_704C_KEY = 0x7049;
+static const StringID STR_704D_SHOW_KEY_TO_GRAPHS = 0x704A;
+static const StringID STR_704E_KEY_TO_COMPANY_GRAPHS = 0x704B;
+static const StringID STR_704F_CLICK_HERE_TO_TOGGLE_COMPANY = 0x704C;
+static const StringID STR_7050_UNITS_OF_CARGO_DELIVERED = 0x704D;
+static const StringID STR_7051_COMPANY_PERFORMANCE_RATINGS = 0x704E;
+static const StringID STR_7052_COMPANY_VALUES = 0x704F;
+static const StringID STR_7053_COMPANY_LEAGUE_TABLE = 0x7050;
+static const StringID STR_7054 = 0x7051;
+static const StringID STR_7055 = 0x7052;
+static const StringID STR_7056_TRANSPORT_COMPANY_IN_TROUBLE = 0x7053;
+static const StringID STR_7057_WILL_BE_SOLD_OFF_OR_DECLARED = 0x7054;
+static const StringID STR_7058_PRESIDENT = 0x7055;
+static const StringID STR_7059_TRANSPORT_COMPANY_MERGER = 0x7056;
+static const StringID STR_705A_HAS_BEEN_SOLD_TO_FOR = 0x7057;
+static const StringID STR_705B_WE_ARE_LOOKING_FOR_A_TRANSPORT = 0x7058;
+static const StringID STR_705C_BANKRUPT = 0x7059;
+static const StringID STR_705D_HAS_BEEN_CLOSED_DOWN_BY = 0x705A;
+static const StringID STR_705E_NEW_TRANSPORT_COMPANY_LAUNCHED = 0x705B;
+static const StringID STR_705F_STARTS_CONSTRUCTION_NEAR = 0x705C;
+static const StringID STR_7060_CAN_T_BUY_COMPANY = 0x705D;
+static const StringID STR_7061_CARGO_PAYMENT_RATES = 0x705E;
+static const StringID STR_7062_DAYS_IN_TRANSIT = 0x705F;
+static const StringID STR_7063_PAYMENT_FOR_DELIVERING = 0x7060;
+static const StringID STR_7064_TOGGLE_GRAPH_FOR_CARGO = 0x7061;
+static const StringID STR_7065 = 0x7062;
+static const StringID STR_7066_ENGINEER = 0x7063;
+static const StringID STR_7067_TRAFFIC_MANAGER = 0x7064;
+static const StringID STR_7068_TRANSPORT_COORDINATOR = 0x7065;
+static const StringID STR_7069_ROUTE_SUPERVISOR = 0x7066;
+static const StringID STR_706A_DIRECTOR = 0x7067;
+static const StringID STR_706B_CHIEF_EXECUTIVE = 0x7068;
+static const StringID STR_706C_CHAIRMAN = 0x7069;
+static const StringID STR_706D_PRESIDENT = 0x706A;
+static const StringID STR_706E_TYCOON = 0x706B;
+static const StringID STR_706F_BUILD_HQ = 0x706C;
+static const StringID STR_7070_BUILD_COMPANY_HEADQUARTERS = 0x706D;
+static const StringID STR_RELOCATE_COMPANY_HEADQUARTERS = 0x706E;
+static const StringID STR_7071_CAN_T_BUILD_COMPANY_HEADQUARTERS = 0x706F;
+static const StringID STR_7072_VIEW_HQ = 0x7070;
+static const StringID STR_RELOCATE_HQ = 0x7071;
+static const StringID STR_COMPANY_PASSWORD = 0x7072;
+static const StringID STR_COMPANY_PASSWORD_TOOLTIP = 0x7073;
+static const StringID STR_SET_COMPANY_PASSWORD = 0x7074;
+static const StringID STR_COMPANY_PASSWORD_CANCEL = 0x7075;
+static const StringID STR_COMPANY_PASSWORD_OK = 0x7076;
+static const StringID STR_COMPANY_PASSWORD_CAPTION = 0x7077;
+static const StringID STR_MAKE_DEFAULT_COMPANY_PASSWORD = 0x7078;
+static const StringID STR_MAKE_DEFAULT_COMPANY_PASSWORD_TIP = 0x7079;
+static const StringID STR_7073_WORLD_RECESSION_FINANCIAL = 0x707A;
+static const StringID STR_7074_RECESSION_OVER_UPTURN_IN = 0x707B;
+static const StringID STR_7075_TOGGLE_LARGE_SMALL_WINDOW = 0x707C;
+static const StringID STR_7076_COMPANY_VALUE = 0x707D;
+static const StringID STR_7077_BUY_25_SHARE_IN_COMPANY = 0x707E;
+static const StringID STR_7078_SELL_25_SHARE_IN_COMPANY = 0x707F;
+static const StringID STR_7079_BUY_25_SHARE_IN_THIS_COMPANY = 0x7080;
+static const StringID STR_707A_SELL_25_SHARE_IN_THIS_COMPANY = 0x7081;
+static const StringID STR_707B_CAN_T_BUY_25_SHARE_IN_THIS = 0x7082;
+static const StringID STR_707C_CAN_T_SELL_25_SHARE_IN = 0x7083;
+static const StringID STR_707D_OWNED_BY = 0x7084;
+static const StringID STR_707F_HAS_BEEN_TAKEN_OVER_BY = 0x7085;
+static const StringID STR_PROTECTED = 0x7086;
+static const StringID STR_LIVERY_DEFAULT = 0x7087;
+static const StringID STR_LIVERY_STEAM = 0x7088;
+static const StringID STR_LIVERY_DIESEL = 0x7089;
+static const StringID STR_LIVERY_ELECTRIC = 0x708A;
+static const StringID STR_LIVERY_MONORAIL = 0x708B;
+static const StringID STR_LIVERY_MAGLEV = 0x708C;
+static const StringID STR_LIVERY_DMU = 0x708D;
+static const StringID STR_LIVERY_EMU = 0x708E;
+static const StringID STR_LIVERY_PASSENGER_WAGON_STEAM = 0x708F;
+static const StringID STR_LIVERY_PASSENGER_WAGON_DIESEL = 0x7090;
+static const StringID STR_LIVERY_PASSENGER_WAGON_ELECTRIC = 0x7091;
+static const StringID STR_LIVERY_PASSENGER_WAGON_MONORAIL = 0x7092;
+static const StringID STR_LIVERY_PASSENGER_WAGON_MAGLEV = 0x7093;
+static const StringID STR_LIVERY_FREIGHT_WAGON = 0x7094;
+static const StringID STR_LIVERY_BUS = 0x7095;
+static const StringID STR_LIVERY_TRUCK = 0x7096;
+static const StringID STR_LIVERY_PASSENGER_SHIP = 0x7097;
+static const StringID STR_LIVERY_FREIGHT_SHIP = 0x7098;
+static const StringID STR_LIVERY_HELICOPTER = 0x7099;
+static const StringID STR_LIVERY_SMALL_PLANE = 0x709A;
+static const StringID STR_LIVERY_LARGE_PLANE = 0x709B;
+static const StringID STR_LIVERY_PASSENGER_TRAM = 0x709C;
+static const StringID STR_LIVERY_FREIGHT_TRAM = 0x709D;
+static const StringID STR_LIVERY_GENERAL_TIP = 0x709E;
+static const StringID STR_LIVERY_TRAIN_TIP = 0x709F;
+static const StringID STR_LIVERY_ROADVEH_TIP = 0x70A0;
+static const StringID STR_LIVERY_SHIP_TIP = 0x70A1;
+static const StringID STR_LIVERY_AIRCRAFT_TIP = 0x70A2;
+static const StringID STR_LIVERY_PRIMARY_TIP = 0x70A3;
+static const StringID STR_LIVERY_SECONDARY_TIP = 0x70A4;
+static const StringID STR_LIVERY_PANEL_TIP = 0x70A5;
+
+static const StringID STR_8000_KIRBY_PAUL_TANK_STEAM = 0x8000;
+static const StringID STR_8001_MJS_250_DIESEL = 0x8001;
+static const StringID STR_8002_PLODDYPHUT_CHOO_CHOO = 0x8002;
+static const StringID STR_8003_POWERNAUT_CHOO_CHOO = 0x8003;
+static const StringID STR_8004_MIGHTYMOVER_CHOO_CHOO = 0x8004;
+static const StringID STR_8005_PLODDYPHUT_DIESEL = 0x8005;
+static const StringID STR_8006_POWERNAUT_DIESEL = 0x8006;
+static const StringID STR_8007_WILLS_2_8_0_STEAM = 0x8007;
+static const StringID STR_8008_CHANEY_JUBILEE_STEAM = 0x8008;
+static const StringID STR_8009_GINZU_A4_STEAM = 0x8009;
+static const StringID STR_800A_SH_8P_STEAM = 0x800A;
+static const StringID STR_800B_MANLEY_MOREL_DMU_DIESEL = 0x800B;
+static const StringID STR_800C_DASH_DIESEL = 0x800C;
+static const StringID STR_800D_SH_HENDRY_25_DIESEL = 0x800D;
+static const StringID STR_800E_UU_37_DIESEL = 0x800E;
+static const StringID STR_800F_FLOSS_47_DIESEL = 0x800F;
+static const StringID STR_8010_CS_4000_DIESEL = 0x8010;
+static const StringID STR_8011_CS_2400_DIESEL = 0x8011;
+static const StringID STR_8012_CENTENNIAL_DIESEL = 0x8012;
+static const StringID STR_8013_KELLING_3100_DIESEL = 0x8013;
+static const StringID STR_8014_TURNER_TURBO_DIESEL = 0x8014;
+static const StringID STR_8015_MJS_1000_DIESEL = 0x8015;
+static const StringID STR_8016_SH_125_DIESEL = 0x8016;
+static const StringID STR_8017_SH_30_ELECTRIC = 0x8017;
+static const StringID STR_8018_SH_40_ELECTRIC = 0x8018;
+static const StringID STR_8019_T_I_M_ELECTRIC = 0x8019;
+static const StringID STR_801A_ASIASTAR_ELECTRIC = 0x801A;
+static const StringID STR_801B_PASSENGER_CAR = 0x801B;
+static const StringID STR_801C_MAIL_VAN = 0x801C;
+static const StringID STR_801D_COAL_CAR = 0x801D;
+static const StringID STR_801E_OIL_TANKER = 0x801E;
+static const StringID STR_801F_LIVESTOCK_VAN = 0x801F;
+static const StringID STR_8020_GOODS_VAN = 0x8020;
+static const StringID STR_8021_GRAIN_HOPPER = 0x8021;
+static const StringID STR_8022_WOOD_TRUCK = 0x8022;
+static const StringID STR_8023_IRON_ORE_HOPPER = 0x8023;
+static const StringID STR_8024_STEEL_TRUCK = 0x8024;
+static const StringID STR_8025_ARMORED_VAN = 0x8025;
+static const StringID STR_8026_FOOD_VAN = 0x8026;
+static const StringID STR_8027_PAPER_TRUCK = 0x8027;
+static const StringID STR_8028_COPPER_ORE_HOPPER = 0x8028;
+static const StringID STR_8029_WATER_TANKER = 0x8029;
+static const StringID STR_802A_FRUIT_TRUCK = 0x802A;
+static const StringID STR_802B_RUBBER_TRUCK = 0x802B;
+static const StringID STR_802C_SUGAR_TRUCK = 0x802C;
+static const StringID STR_802D_COTTON_CANDY_HOPPER = 0x802D;
+static const StringID STR_802E_TOFFEE_HOPPER = 0x802E;
+static const StringID STR_802F_BUBBLE_VAN = 0x802F;
+static const StringID STR_8030_COLA_TANKER = 0x8030;
+static const StringID STR_8031_CANDY_VAN = 0x8031;
+static const StringID STR_8032_TOY_VAN = 0x8032;
+static const StringID STR_8033_BATTERY_TRUCK = 0x8033;
+static const StringID STR_8034_FIZZY_DRINK_TRUCK = 0x8034;
+static const StringID STR_8035_PLASTIC_TRUCK = 0x8035;
+static const StringID STR_8036_X2001_ELECTRIC = 0x8036;
+static const StringID STR_8037_MILLENNIUM_Z1_ELECTRIC = 0x8037;
+static const StringID STR_8038_WIZZOWOW_Z99 = 0x8038;
+static const StringID STR_8039_PASSENGER_CAR = 0x8039;
+static const StringID STR_803A_MAIL_VAN = 0x803A;
+static const StringID STR_803B_COAL_CAR = 0x803B;
+static const StringID STR_803C_OIL_TANKER = 0x803C;
+static const StringID STR_803D_LIVESTOCK_VAN = 0x803D;
+static const StringID STR_803E_GOODS_VAN = 0x803E;
+static const StringID STR_803F_GRAIN_HOPPER = 0x803F;
+static const StringID STR_8040_WOOD_TRUCK = 0x8040;
+static const StringID STR_8041_IRON_ORE_HOPPER = 0x8041;
+static const StringID STR_8042_STEEL_TRUCK = 0x8042;
+static const StringID STR_8043_ARMORED_VAN = 0x8043;
+static const StringID STR_8044_FOOD_VAN = 0x8044;
+static const StringID STR_8045_PAPER_TRUCK = 0x8045;
+static const StringID STR_8046_COPPER_ORE_HOPPER = 0x8046;
+static const StringID STR_8047_WATER_TANKER = 0x8047;
+static const StringID STR_8048_FRUIT_TRUCK = 0x8048;
+static const StringID STR_8049_RUBBER_TRUCK = 0x8049;
+static const StringID STR_804A_SUGAR_TRUCK = 0x804A;
+static const StringID STR_804B_COTTON_CANDY_HOPPER = 0x804B;
+static const StringID STR_804C_TOFFEE_HOPPER = 0x804C;
+static const StringID STR_804D_BUBBLE_VAN = 0x804D;
+static const StringID STR_804E_COLA_TANKER = 0x804E;
+static const StringID STR_804F_CANDY_VAN = 0x804F;
+static const StringID STR_8050_TOY_VAN = 0x8050;
+static const StringID STR_8051_BATTERY_TRUCK = 0x8051;
+static const StringID STR_8052_FIZZY_DRINK_TRUCK = 0x8052;
+static const StringID STR_8053_PLASTIC_TRUCK = 0x8053;
+static const StringID STR_8054_LEV1_LEVIATHAN_ELECTRIC = 0x8054;
+static const StringID STR_8055_LEV2_CYCLOPS_ELECTRIC = 0x8055;
+static const StringID STR_8056_LEV3_PEGASUS_ELECTRIC = 0x8056;
+static const StringID STR_8057_LEV4_CHIMAERA_ELECTRIC = 0x8057;
+static const StringID STR_8058_WIZZOWOW_ROCKETEER = 0x8058;
+static const StringID STR_8059_PASSENGER_CAR = 0x8059;
+static const StringID STR_805A_MAIL_VAN = 0x805A;
+static const StringID STR_805B_COAL_CAR = 0x805B;
+static const StringID STR_805C_OIL_TANKER = 0x805C;
+static const StringID STR_805D_LIVESTOCK_VAN = 0x805D;
+static const StringID STR_805E_GOODS_VAN = 0x805E;
+static const StringID STR_805F_GRAIN_HOPPER = 0x805F;
+static const StringID STR_8060_WOOD_TRUCK = 0x8060;
+static const StringID STR_8061_IRON_ORE_HOPPER = 0x8061;
+static const StringID STR_8062_STEEL_TRUCK = 0x8062;
+static const StringID STR_8063_ARMORED_VAN = 0x8063;
+static const StringID STR_8064_FOOD_VAN = 0x8064;
+static const StringID STR_8065_PAPER_TRUCK = 0x8065;
+static const StringID STR_8066_COPPER_ORE_HOPPER = 0x8066;
+static const StringID STR_8067_WATER_TANKER = 0x8067;
+static const StringID STR_8068_FRUIT_TRUCK = 0x8068;
+static const StringID STR_8069_RUBBER_TRUCK = 0x8069;
+static const StringID STR_806A_SUGAR_TRUCK = 0x806A;
+static const StringID STR_806B_COTTON_CANDY_HOPPER = 0x806B;
+static const StringID STR_806C_TOFFEE_HOPPER = 0x806C;
+static const StringID STR_806D_BUBBLE_VAN = 0x806D;
+static const StringID STR_806E_COLA_TANKER = 0x806E;
+static const StringID STR_806F_CANDY_VAN = 0x806F;
+static const StringID STR_8070_TOY_VAN = 0x8070;
+static const StringID STR_8071_BATTERY_TRUCK = 0x8071;
+static const StringID STR_8072_FIZZY_DRINK_TRUCK = 0x8072;
+static const StringID STR_8073_PLASTIC_TRUCK = 0x8073;
+static const StringID STR_8074_MPS_REGAL_BUS = 0x8074;
+static const StringID STR_8075_HEREFORD_LEOPARD_BUS = 0x8075;
+static const StringID STR_8076_FOSTER_BUS = 0x8076;
+static const StringID STR_8077_FOSTER_MKII_SUPERBUS = 0x8077;
+static const StringID STR_8078_PLODDYPHUT_MKI_BUS = 0x8078;
+static const StringID STR_8079_PLODDYPHUT_MKII_BUS = 0x8079;
+static const StringID STR_807A_PLODDYPHUT_MKIII_BUS = 0x807A;
+static const StringID STR_807B_BALOGH_COAL_TRUCK = 0x807B;
+static const StringID STR_807C_UHL_COAL_TRUCK = 0x807C;
+static const StringID STR_807D_DW_COAL_TRUCK = 0x807D;
+static const StringID STR_807E_MPS_MAIL_TRUCK = 0x807E;
+static const StringID STR_807F_REYNARD_MAIL_TRUCK = 0x807F;
+static const StringID STR_8080_PERRY_MAIL_TRUCK = 0x8080;
+static const StringID STR_8081_MIGHTYMOVER_MAIL_TRUCK = 0x8081;
+static const StringID STR_8082_POWERNAUGHT_MAIL_TRUCK = 0x8082;
+static const StringID STR_8083_WIZZOWOW_MAIL_TRUCK = 0x8083;
+static const StringID STR_8084_WITCOMBE_OIL_TANKER = 0x8084;
+static const StringID STR_8085_FOSTER_OIL_TANKER = 0x8085;
+static const StringID STR_8086_PERRY_OIL_TANKER = 0x8086;
+static const StringID STR_8087_TALBOTT_LIVESTOCK_VAN = 0x8087;
+static const StringID STR_8088_UHL_LIVESTOCK_VAN = 0x8088;
+static const StringID STR_8089_FOSTER_LIVESTOCK_VAN = 0x8089;
+static const StringID STR_808A_BALOGH_GOODS_TRUCK = 0x808A;
+static const StringID STR_808B_CRAIGHEAD_GOODS_TRUCK = 0x808B;
+static const StringID STR_808C_GOSS_GOODS_TRUCK = 0x808C;
+static const StringID STR_808D_HEREFORD_GRAIN_TRUCK = 0x808D;
+static const StringID STR_808E_THOMAS_GRAIN_TRUCK = 0x808E;
+static const StringID STR_808F_GOSS_GRAIN_TRUCK = 0x808F;
+static const StringID STR_8090_WITCOMBE_WOOD_TRUCK = 0x8090;
+static const StringID STR_8091_FOSTER_WOOD_TRUCK = 0x8091;
+static const StringID STR_8092_MORELAND_WOOD_TRUCK = 0x8092;
+static const StringID STR_8093_MPS_IRON_ORE_TRUCK = 0x8093;
+static const StringID STR_8094_UHL_IRON_ORE_TRUCK = 0x8094;
+static const StringID STR_8095_CHIPPY_IRON_ORE_TRUCK = 0x8095;
+static const StringID STR_8096_BALOGH_STEEL_TRUCK = 0x8096;
+static const StringID STR_8097_UHL_STEEL_TRUCK = 0x8097;
+static const StringID STR_8098_KELLING_STEEL_TRUCK = 0x8098;
+static const StringID STR_8099_BALOGH_ARMORED_TRUCK = 0x8099;
+static const StringID STR_809A_UHL_ARMORED_TRUCK = 0x809A;
+static const StringID STR_809B_FOSTER_ARMORED_TRUCK = 0x809B;
+static const StringID STR_809C_FOSTER_FOOD_VAN = 0x809C;
+static const StringID STR_809D_PERRY_FOOD_VAN = 0x809D;
+static const StringID STR_809E_CHIPPY_FOOD_VAN = 0x809E;
+static const StringID STR_809F_UHL_PAPER_TRUCK = 0x809F;
+static const StringID STR_80A0_BALOGH_PAPER_TRUCK = 0x80A0;
+static const StringID STR_80A1_MPS_PAPER_TRUCK = 0x80A1;
+static const StringID STR_80A2_MPS_COPPER_ORE_TRUCK = 0x80A2;
+static const StringID STR_80A3_UHL_COPPER_ORE_TRUCK = 0x80A3;
+static const StringID STR_80A4_GOSS_COPPER_ORE_TRUCK = 0x80A4;
+static const StringID STR_80A5_UHL_WATER_TANKER = 0x80A5;
+static const StringID STR_80A6_BALOGH_WATER_TANKER = 0x80A6;
+static const StringID STR_80A7_MPS_WATER_TANKER = 0x80A7;
+static const StringID STR_80A8_BALOGH_FRUIT_TRUCK = 0x80A8;
+static const StringID STR_80A9_UHL_FRUIT_TRUCK = 0x80A9;
+static const StringID STR_80AA_KELLING_FRUIT_TRUCK = 0x80AA;
+static const StringID STR_80AB_BALOGH_RUBBER_TRUCK = 0x80AB;
+static const StringID STR_80AC_UHL_RUBBER_TRUCK = 0x80AC;
+static const StringID STR_80AD_RMT_RUBBER_TRUCK = 0x80AD;
+static const StringID STR_80AE_MIGHTYMOVER_SUGAR_TRUCK = 0x80AE;
+static const StringID STR_80AF_POWERNAUGHT_SUGAR_TRUCK = 0x80AF;
+static const StringID STR_80B0_WIZZOWOW_SUGAR_TRUCK = 0x80B0;
+static const StringID STR_80B1_MIGHTYMOVER_COLA_TRUCK = 0x80B1;
+static const StringID STR_80B2_POWERNAUGHT_COLA_TRUCK = 0x80B2;
+static const StringID STR_80B3_WIZZOWOW_COLA_TRUCK = 0x80B3;
+static const StringID STR_80B4_MIGHTYMOVER_COTTON_CANDY = 0x80B4;
+static const StringID STR_80B5_POWERNAUGHT_COTTON_CANDY = 0x80B5;
+static const StringID STR_80B6_WIZZOWOW_COTTON_CANDY_TRUCK = 0x80B6;
+static const StringID STR_80B7_MIGHTYMOVER_TOFFEE_TRUCK = 0x80B7;
+static const StringID STR_80B8_POWERNAUGHT_TOFFEE_TRUCK = 0x80B8;
+static const StringID STR_80B9_WIZZOWOW_TOFFEE_TRUCK = 0x80B9;
+static const StringID STR_80BA_MIGHTYMOVER_TOY_VAN = 0x80BA;
+static const StringID STR_80BB_POWERNAUGHT_TOY_VAN = 0x80BB;
+static const StringID STR_80BC_WIZZOWOW_TOY_VAN = 0x80BC;
+static const StringID STR_80BD_MIGHTYMOVER_CANDY_TRUCK = 0x80BD;
+static const StringID STR_80BE_POWERNAUGHT_CANDY_TRUCK = 0x80BE;
+static const StringID STR_80BF_WIZZOWOW_CANDY_TRUCK = 0x80BF;
+static const StringID STR_80C0_MIGHTYMOVER_BATTERY_TRUCK = 0x80C0;
+static const StringID STR_80C1_POWERNAUGHT_BATTERY_TRUCK = 0x80C1;
+static const StringID STR_80C2_WIZZOWOW_BATTERY_TRUCK = 0x80C2;
+static const StringID STR_80C3_MIGHTYMOVER_FIZZY_DRINK = 0x80C3;
+static const StringID STR_80C4_POWERNAUGHT_FIZZY_DRINK = 0x80C4;
+static const StringID STR_80C5_WIZZOWOW_FIZZY_DRINK_TRUCK = 0x80C5;
+static const StringID STR_80C6_MIGHTYMOVER_PLASTIC_TRUCK = 0x80C6;
+static const StringID STR_80C7_POWERNAUGHT_PLASTIC_TRUCK = 0x80C7;
+static const StringID STR_80C8_WIZZOWOW_PLASTIC_TRUCK = 0x80C8;
+static const StringID STR_80C9_MIGHTYMOVER_BUBBLE_TRUCK = 0x80C9;
+static const StringID STR_80CA_POWERNAUGHT_BUBBLE_TRUCK = 0x80CA;
+static const StringID STR_80CB_WIZZOWOW_BUBBLE_TRUCK = 0x80CB;
+static const StringID STR_80CC_MPS_OIL_TANKER = 0x80CC;
+static const StringID STR_80CD_CS_INC_OIL_TANKER = 0x80CD;
+static const StringID STR_80CE_MPS_PASSENGER_FERRY = 0x80CE;
+static const StringID STR_80CF_FFP_PASSENGER_FERRY = 0x80CF;
+static const StringID STR_80D0_BAKEWELL_300_HOVERCRAFT = 0x80D0;
+static const StringID STR_80D1_CHUGGER_CHUG_PASSENGER = 0x80D1;
+static const StringID STR_80D2_SHIVERSHAKE_PASSENGER_FERRY = 0x80D2;
+static const StringID STR_80D3_YATE_CARGO_SHIP = 0x80D3;
+static const StringID STR_80D4_BAKEWELL_CARGO_SHIP = 0x80D4;
+static const StringID STR_80D5_MIGHTYMOVER_CARGO_SHIP = 0x80D5;
+static const StringID STR_80D6_POWERNAUT_CARGO_SHIP = 0x80D6;
+static const StringID STR_80D7_SAMPSON_U52 = 0x80D7;
+static const StringID STR_80D8_COLEMAN_COUNT = 0x80D8;
+static const StringID STR_80D9_FFP_DART = 0x80D9;
+static const StringID STR_80DA_YATE_HAUGAN = 0x80DA;
+static const StringID STR_80DB_BAKEWELL_COTSWALD_LB_3 = 0x80DB;
+static const StringID STR_80DC_BAKEWELL_LUCKETT_LB_8 = 0x80DC;
+static const StringID STR_80DD_BAKEWELL_LUCKETT_LB_9 = 0x80DD;
+static const StringID STR_80DE_BAKEWELL_LUCKETT_LB80 = 0x80DE;
+static const StringID STR_80DF_BAKEWELL_LUCKETT_LB_10 = 0x80DF;
+static const StringID STR_80E0_BAKEWELL_LUCKETT_LB_11 = 0x80E0;
+static const StringID STR_80E1_YATE_AEROSPACE_YAC_1_11 = 0x80E1;
+static const StringID STR_80E2_DARWIN_100 = 0x80E2;
+static const StringID STR_80E3_DARWIN_200 = 0x80E3;
+static const StringID STR_80E4_DARWIN_300 = 0x80E4;
+static const StringID STR_80E5_DARWIN_400 = 0x80E5;
+static const StringID STR_80E6_DARWIN_500 = 0x80E6;
+static const StringID STR_80E7_DARWIN_600 = 0x80E7;
+static const StringID STR_80E8_GURU_GALAXY = 0x80E8;
+static const StringID STR_80E9_AIRTAXI_A21 = 0x80E9;
+static const StringID STR_80EA_AIRTAXI_A31 = 0x80EA;
+static const StringID STR_80EB_AIRTAXI_A32 = 0x80EB;
+static const StringID STR_80EC_AIRTAXI_A33 = 0x80EC;
+static const StringID STR_80ED_YATE_AEROSPACE_YAE46 = 0x80ED;
+static const StringID STR_80EE_DINGER_100 = 0x80EE;
+static const StringID STR_80EF_AIRTAXI_A34_1000 = 0x80EF;
+static const StringID STR_80F0_YATE_Z_SHUTTLE = 0x80F0;
+static const StringID STR_80F1_KELLING_K1 = 0x80F1;
+static const StringID STR_80F2_KELLING_K6 = 0x80F2;
+static const StringID STR_80F3_KELLING_K7 = 0x80F3;
+static const StringID STR_80F4_DARWIN_700 = 0x80F4;
+static const StringID STR_80F5_FFP_HYPERDART_2 = 0x80F5;
+static const StringID STR_80F6_DINGER_200 = 0x80F6;
+static const StringID STR_80F7_DINGER_1000 = 0x80F7;
+static const StringID STR_80F8_PLODDYPHUT_100 = 0x80F8;
+static const StringID STR_80F9_PLODDYPHUT_500 = 0x80F9;
+static const StringID STR_80FA_FLASHBANG_X1 = 0x80FA;
+static const StringID STR_80FB_JUGGERPLANE_M1 = 0x80FB;
+static const StringID STR_80FC_FLASHBANG_WIZZER = 0x80FC;
+static const StringID STR_80FD_TRICARIO_HELICOPTER = 0x80FD;
+static const StringID STR_80FE_GURU_X2_HELICOPTER = 0x80FE;
+static const StringID STR_80FF_POWERNAUT_HELICOPTER = 0x80FF;
+static const StringID STR_8100_MESSAGE_FROM_VEHICLE_MANUFACTURE = 0x8100;
+static const StringID STR_8101_WE_HAVE_JUST_DESIGNED_A = 0x8101;
+static const StringID STR_8102_RAILROAD_LOCOMOTIVE = 0x8102;
+static const StringID STR_8103_ROAD_VEHICLE = 0x8103;
+static const StringID STR_8104_AIRCRAFT = 0x8104;
+static const StringID STR_8105_SHIP = 0x8105;
+static const StringID STR_8106_MONORAIL_LOCOMOTIVE = 0x8106;
+static const StringID STR_8107_MAGLEV_LOCOMOTIVE = 0x8107;
+
+static const StringID STR_8800_TRAIN_DEPOT = 0x8800;
+static const StringID STR_8801_CITIZENS_CELEBRATE_FIRST = 0x8801;
+static const StringID STR_8802_DETAILS = 0x8802;
+static const StringID STR_8803_TRAIN_IN_THE_WAY = 0x8803;
+static const StringID STR_8804 = 0x8804;
+static const StringID STR_8805 = 0x8805;
+static const StringID STR_8806_GO_TO = 0x8806;
+static const StringID STR_GO_TO_TRANSFER = 0x8807;
+static const StringID STR_8807_GO_TO_UNLOAD = 0x8808;
+static const StringID STR_GO_TO_TRANSFER_UNLOAD = 0x8809;
+static const StringID STR_8808_GO_TO_LOAD = 0x880A;
+static const StringID STR_GO_TO_TRANSFER_LOAD = 0x880B;
+static const StringID STR_880A_GO_NON_STOP_TO = 0x880C;
+static const StringID STR_GO_TO_NON_STOP_TRANSFER = 0x880D;
+static const StringID STR_880B_GO_NON_STOP_TO_UNLOAD = 0x880E;
+static const StringID STR_GO_TO_NON_STOP_TRANSFER_UNLOAD = 0x880F;
+static const StringID STR_880C_GO_NON_STOP_TO_LOAD = 0x8810;
+static const StringID STR_GO_TO_NON_STOP_TRANSFER_LOAD = 0x8811;
+static const StringID STR_GO_TO_TRAIN_DEPOT = 0x8812;
+static const StringID STR_SERVICE_AT_TRAIN_DEPOT = 0x8813;
+static const StringID STR_880F_GO_NON_STOP_TO_TRAIN_DEPOT = 0x8814;
+static const StringID STR_SERVICE_NON_STOP_AT_TRAIN_DEPOT = 0x8815;
+static const StringID STR_TIMETABLE_GO_TO = 0x8816;
+static const StringID STR_TIMETABLE_TRAVEL_NOT_TIMETABLED = 0x8817;
+static const StringID STR_TIMETABLE_TRAVEL_FOR = 0x8818;
+static const StringID STR_TIMETABLE_STAY_FOR = 0x8819;
+static const StringID STR_TIMETABLE_DAYS = 0x881A;
+static const StringID STR_TIMETABLE_TICKS = 0x881B;
+static const StringID STR_HEADING_FOR_TRAIN_DEPOT = 0x881C;
+static const StringID STR_HEADING_FOR_TRAIN_DEPOT_VEL = 0x881D;
+static const StringID STR_HEADING_FOR_TRAIN_DEPOT_SERVICE = 0x881E;
+static const StringID STR_HEADING_FOR_TRAIN_DEPOT_SERVICE_VEL = 0x881F;
+static const StringID STR_INVALID_ORDER = 0x8820;
+static const StringID STR_UNKNOWN_DESTINATION = 0x8821;
+static const StringID STR_8812_EMPTY = 0x8822;
+static const StringID STR_8813_FROM = 0x8823;
+static const StringID STR_FROM_MULT = 0x8824;
+static const StringID STR_8814_TRAIN_IS_WAITING_IN_DEPOT = 0x8825;
+static const StringID STR_8815_NEW_VEHICLES = 0x8826;
+static const StringID STR_8816 = 0x8827;
+static const StringID STR_8819_TRAIN_TOO_LONG = 0x8828;
+static const StringID STR_881A_TRAINS_CAN_ONLY_BE_ALTERED = 0x8829;
+static const StringID STR_881B_TRAINS = 0x882A;
+static const StringID STR_881C_NEW_RAIL_VEHICLES = 0x882B;
+static const StringID STR_NEW_ELRAIL_VEHICLES = 0x882C;
+static const StringID STR_881D_NEW_MONORAIL_VEHICLES = 0x882D;
+static const StringID STR_881E_NEW_MAGLEV_VEHICLES = 0x882E;
+static const StringID STR_ALL_AVAIL_RAIL_VEHICLES = 0x882F;
+static const StringID STR_881F_BUILD_VEHICLE = 0x8830;
+static const StringID STR_CLONE_ROAD_VEHICLE = 0x8831;
+static const StringID STR_CLONE_ROAD_VEHICLE_INFO = 0x8832;
+static const StringID STR_CLONE_ROAD_VEHICLE_DEPOT_INFO = 0x8833;
+static const StringID STR_CLONE_TRAIN = 0x8834;
+static const StringID STR_CLONE_TRAIN_INFO = 0x8835;
+static const StringID STR_CLONE_TRAIN_DEPOT_INFO = 0x8836;
+static const StringID STR_8820_RENAME = 0x8837;
+static const StringID STR_8823_SKIP = 0x8838;
+static const StringID STR_8824_DELETE = 0x8839;
+static const StringID STR_8825_NON_STOP = 0x883A;
+static const StringID STR_8826_GO_TO = 0x883B;
+static const StringID STR_8827_FULL_LOAD = 0x883C;
+static const StringID STR_8828_UNLOAD = 0x883D;
+static const StringID STR_REFIT = 0x883E;
+static const StringID STR_REFIT_TIP = 0x883F;
+static const StringID STR_REFIT_ORDER = 0x8840;
+static const StringID STR_TIMETABLE_VIEW = 0x8841;
+static const StringID STR_TIMETABLE_VIEW_TOOLTIP = 0x8842;
+static const StringID STR_8829_ORDERS = 0x8843;
+static const StringID STR_882A_END_OF_ORDERS = 0x8844;
+static const StringID STR_FULLLOAD_OR_SERVICE = 0x8845;
+static const StringID STR_SERVICE = 0x8846;
+static const StringID STR_882B_CAN_T_BUILD_RAILROAD_VEHICLE = 0x8847;
+static const StringID STR_882C_BUILT_VALUE = 0x8848;
+static const StringID STR_882D_VALUE = 0x8849;
+static const StringID STR_882E = 0x884A;
+static const StringID STR_882F_LOADING_UNLOADING = 0x884B;
+static const StringID STR_TRAIN_MUST_BE_STOPPED = 0x884C;
+static const StringID STR_8830_CAN_T_SEND_TRAIN_TO_DEPOT = 0x884D;
+static const StringID STR_8831_NO_MORE_SPACE_FOR_ORDERS = 0x884E;
+static const StringID STR_8832_TOO_MANY_ORDERS = 0x884F;
+static const StringID STR_8833_CAN_T_INSERT_NEW_ORDER = 0x8850;
+static const StringID STR_8834_CAN_T_DELETE_THIS_ORDER = 0x8851;
+static const StringID STR_8835_CAN_T_MODIFY_THIS_ORDER = 0x8852;
+static const StringID STR_CAN_T_MOVE_THIS_ORDER = 0x8853;
+static const StringID STR_CAN_T_SKIP_ORDER = 0x8854;
+static const StringID STR_CAN_T_SKIP_TO_ORDER = 0x8855;
+static const StringID STR_8837_CAN_T_MOVE_VEHICLE = 0x8856;
+static const StringID STR_REAR_ENGINE_FOLLOW_FRONT_ERROR = 0x8857;
+static const StringID STR_8838_N_A = 0x8858;
+static const StringID STR_8839_CAN_T_SELL_RAILROAD_VEHICLE = 0x8859;
+static const StringID STR_883A_UNABLE_TO_FIND_ROUTE_TO = 0x885A;
+static const StringID STR_883B_CAN_T_STOP_START_TRAIN = 0x885B;
+static const StringID STR_883C_SERVICING_INTERVAL_DAYS = 0x885C;
+static const StringID STR_SERVICING_INTERVAL_PERCENT = 0x885D;
+static const StringID STR_883D_TRAINS_CLICK_ON_TRAIN_FOR = 0x885E;
+static const StringID STR_883E_BUILD_NEW_TRAINS_REQUIRES = 0x885F;
+static const StringID STR_883F_TRAINS_CLICK_ON_TRAIN_FOR = 0x8860;
+static const StringID STR_8840_BUILD_NEW_TRAIN_VEHICLE = 0x8861;
+static const StringID STR_8841_DRAG_TRAIN_VEHICLE_TO_HERE = 0x8862;
+static const StringID STR_8842_CENTER_MAIN_VIEW_ON_TRAIN = 0x8863;
+static const StringID STR_8843_TRAIN_VEHICLE_SELECTION = 0x8864;
+static const StringID STR_8844_BUILD_THE_HIGHLIGHTED_TRAIN = 0x8865;
+static const StringID STR_8845_RENAME_TRAIN_VEHICLE_TYPE = 0x8866;
+static const StringID STR_8846_CURRENT_TRAIN_ACTION_CLICK = 0x8867;
+static const StringID STR_8847_SHOW_TRAIN_S_ORDERS = 0x8868;
+static const StringID STR_8848_CENTER_MAIN_VIEW_ON_TRAIN = 0x8869;
+static const StringID STR_8849_SEND_TRAIN_TO_DEPOT = 0x886A;
+static const StringID STR_884A_FORCE_TRAIN_TO_PROCEED = 0x886B;
+static const StringID STR_884B_REVERSE_DIRECTION_OF_TRAIN = 0x886C;
+static const StringID STR_884C_SHOW_TRAIN_DETAILS = 0x886D;
+static const StringID STR_884D_INCREASE_SERVICING_INTERVAL = 0x886E;
+static const StringID STR_884E_DECREASE_SERVICING_INTERVAL = 0x886F;
+static const StringID STR_884F_SHOW_DETAILS_OF_CARGO_CARRIED = 0x8870;
+static const StringID STR_8850_SHOW_DETAILS_OF_TRAIN_VEHICLES = 0x8871;
+static const StringID STR_8851_SHOW_CAPACITIES_OF_EACH = 0x8872;
+static const StringID STR_SHOW_TOTAL_CARGO = 0x8873;
+static const StringID STR_8852_ORDERS_LIST_CLICK_ON_ORDER = 0x8874;
+static const StringID STR_8853_SKIP_THE_CURRENT_ORDER = 0x8875;
+static const StringID STR_8854_DELETE_THE_HIGHLIGHTED = 0x8876;
+static const StringID STR_8855_MAKE_THE_HIGHLIGHTED_ORDER = 0x8877;
+static const StringID STR_8856_INSERT_A_NEW_ORDER_BEFORE = 0x8878;
+static const StringID STR_8857_MAKE_THE_HIGHLIGHTED_ORDER = 0x8879;
+static const StringID STR_8858_MAKE_THE_HIGHLIGHTED_ORDER = 0x887A;
+static const StringID STR_TIMETABLE_TOOLTIP = 0x887B;
+static const StringID STR_TIMETABLE_WAIT_TIME_TOOLTIP = 0x887C;
+static const StringID STR_TIMETABLE_CLEAR_TIME_TOOLTIP = 0x887D;
+static const StringID STR_TIMETABLE_RESET_LATENESS_TOOLTIP = 0x887E;
+static const StringID STR_SERVICE_HINT = 0x887F;
+static const StringID STR_VEHICLE_INFO_COST_WEIGHT_SPEED_POWER = 0x8880;
+static const StringID STR_885C_BROKEN_DOWN = 0x8881;
+static const StringID STR_885D_AGE_RUNNING_COST_YR = 0x8882;
+static const StringID STR_VEHICLE_INFO_WEIGHT_POWER_MAX_SPEED = 0x8883;
+static const StringID STR_VEHICLE_INFO_WEIGHT_POWER_MAX_SPEED_MAX_TE = 0x8884;
+static const StringID STR_885F_PROFIT_THIS_YEAR_LAST_YEAR = 0x8885;
+static const StringID STR_8860_RELIABILITY_BREAKDOWNS = 0x8886;
+static const StringID STR_8861_STOPPED = 0x8887;
+static const StringID STR_8862_CAN_T_MAKE_TRAIN_PASS_SIGNAL = 0x8888;
+static const StringID STR_8863_CRASHED = 0x8889;
+static const StringID STR_8865_NAME_TRAIN = 0x888A;
+static const StringID STR_8866_CAN_T_NAME_TRAIN = 0x888B;
+static const StringID STR_8867_NAME_TRAIN = 0x888C;
+static const StringID STR_8868_TRAIN_CRASH_DIE_IN_FIREBALL = 0x888D;
+static const StringID STR_8869_CAN_T_REVERSE_DIRECTION = 0x888E;
+static const StringID STR_886A_RENAME_TRAIN_VEHICLE_TYPE = 0x888F;
+static const StringID STR_886B_CAN_T_RENAME_TRAIN_VEHICLE = 0x8890;
+static const StringID STR_MAKE_THE_HIGHLIGHTED_ORDER = 0x8891;
+static const StringID STR_TRANSFER = 0x8892;
+static const StringID STR_CLEAR_TIME = 0x8893;
+static const StringID STR_RESET_LATENESS = 0x8894;
+static const StringID STR_TRAIN_STOPPING = 0x8895;
+static const StringID STR_TRAIN_STOPPING_VEL = 0x8896;
+static const StringID STR_INCOMPATIBLE_RAIL_TYPES = 0x8897;
+static const StringID STR_TRAIN_NO_POWER = 0x8898;
+static const StringID STR_TRAIN_START_NO_CATENARY = 0x8899;
+static const StringID STR_NEW_VEHICLE_NOW_AVAILABLE = 0x889A;
+static const StringID STR_NEW_VEHICLE_TYPE = 0x889B;
+static const StringID STR_NEW_VEHICLE_NOW_AVAILABLE_WITH_TYPE = 0x889C;
+static const StringID STR_CAN_T_SELL_DESTROYED_VEHICLE = 0x889D;
+static const StringID STR_CAN_T_REFIT_DESTROYED_VEHICLE = 0x889E;
+static const StringID STR_CAN_T_TIMETABLE_VEHICLE = 0x889F;
+static const StringID STR_TIMETABLE_ONLY_WAIT_AT_STATIONS = 0x88A0;
+static const StringID STR_TIMETABLE_NOT_STOPPING_HERE = 0x88A1;
+static const StringID STR_TIMETABLE_CHANGE_TIME = 0x88A2;
+static const StringID STR_TIMETABLE_STATUS_ON_TIME = 0x88A3;
+static const StringID STR_TIMETABLE_STATUS_LATE = 0x88A4;
+static const StringID STR_TIMETABLE_STATUS_EARLY = 0x88A5;
+static const StringID STR_TIMETABLE_TOTAL_TIME = 0x88A6;
+static const StringID STR_TIMETABLE_TOTAL_TIME_INCOMPLETE = 0x88A7;
+static const StringID STR_TIMETABLE_AUTOFILL = 0x88A8;
+static const StringID STR_TIMETABLE_AUTOFILL_TOOLTIP = 0x88A9;
+
+static const StringID STR_9000_ROAD_VEHICLE_IN_THE_WAY = 0x9000;
+static const StringID STR_9001_ROAD_VEHICLES = 0x9001;
+static const StringID STR_9002 = 0x9002;
+static const StringID STR_9003_ROAD_VEHICLE_DEPOT = 0x9003;
+static const StringID STR_9004_NEW_VEHICLES = 0x9004;
+static const StringID STR_9006_NEW_ROAD_VEHICLES = 0x9005;
+static const StringID STR_9007_BUILD_VEHICLE = 0x9006;
+static const StringID STR_9009_CAN_T_BUILD_ROAD_VEHICLE = 0x9007;
+static const StringID STR_900C_DETAILS = 0x9008;
+static const StringID STR_900D_AGE_RUNNING_COST_YR = 0x9009;
+static const StringID STR_900E_MAX_SPEED = 0x900A;
+static const StringID STR_900F_PROFIT_THIS_YEAR_LAST_YEAR = 0x900B;
+static const StringID STR_9010_RELIABILITY_BREAKDOWNS = 0x900C;
+static const StringID STR_9011_BUILT_VALUE = 0x900D;
+static const StringID STR_9012_CAPACITY = 0x900E;
+static const StringID STR_9013_MUST_BE_STOPPED_INSIDE = 0x900F;
+static const StringID STR_9014_CAN_T_SELL_ROAD_VEHICLE = 0x9010;
+static const StringID STR_9015_CAN_T_STOP_START_ROAD_VEHICLE = 0x9011;
+static const StringID STR_9016_ROAD_VEHICLE_IS_WAITING = 0x9012;
+static const StringID STR_HEADING_FOR_ROAD_DEPOT = 0x9013;
+static const StringID STR_HEADING_FOR_ROAD_DEPOT_VEL = 0x9014;
+static const StringID STR_HEADING_FOR_ROAD_DEPOT_SERVICE = 0x9015;
+static const StringID STR_HEADING_FOR_ROAD_DEPOT_SERVICE_VEL = 0x9016;
+static const StringID STR_9018_CAN_T_SEND_VEHICLE_TO_DEPOT = 0x9017;
+static const StringID STR_9019_UNABLE_TO_FIND_LOCAL_DEPOT = 0x9018;
+static const StringID STR_901A_ROAD_VEHICLES_CLICK_ON = 0x9019;
+static const StringID STR_901B_BUILD_NEW_ROAD_VEHICLES = 0x901A;
+static const StringID STR_901C_CURRENT_VEHICLE_ACTION = 0x901B;
+static const StringID STR_901D_SHOW_VEHICLE_S_ORDERS = 0x901C;
+static const StringID STR_901E_CENTER_MAIN_VIEW_ON_VEHICLE = 0x901D;
+static const StringID STR_901F_SEND_VEHICLE_TO_DEPOT = 0x901E;
+static const StringID STR_9020_FORCE_VEHICLE_TO_TURN_AROUND = 0x901F;
+static const StringID STR_9021_SHOW_ROAD_VEHICLE_DETAILS = 0x9020;
+static const StringID STR_9022_VEHICLES_CLICK_ON_VEHICLE = 0x9021;
+static const StringID STR_9023_BUILD_NEW_ROAD_VEHICLE = 0x9022;
+static const StringID STR_9024_DRAG_ROAD_VEHICLE_TO_HERE = 0x9023;
+static const StringID STR_9025_CENTER_MAIN_VIEW_ON_ROAD = 0x9024;
+static const StringID STR_9026_ROAD_VEHICLE_SELECTION = 0x9025;
+static const StringID STR_9027_BUILD_THE_HIGHLIGHTED_ROAD = 0x9026;
+static const StringID STR_902A_COST_SPEED_RUNNING_COST = 0x9027;
+static const StringID STR_ARTICULATED_RV_CAPACITY = 0x9028;
+static const StringID STR_BARE_CARGO = 0x9029;
+static const StringID STR_902C_NAME_ROAD_VEHICLE = 0x902A;
+static const StringID STR_902D_CAN_T_NAME_ROAD_VEHICLE = 0x902B;
+static const StringID STR_902E_NAME_ROAD_VEHICLE = 0x902C;
+static const StringID STR_902F_CITIZENS_CELEBRATE_FIRST = 0x902D;
+static const StringID STR_9030_CITIZENS_CELEBRATE_FIRST = 0x902E;
+static const StringID STR_CITIZENS_CELEBRATE_FIRST_PASSENGER_TRAM = 0x902F;
+static const StringID STR_CITIZENS_CELEBRATE_FIRST_CARGO_TRAM = 0x9030;
+static const StringID STR_9031_ROAD_VEHICLE_CRASH_DRIVER = 0x9031;
+static const StringID STR_9032_ROAD_VEHICLE_CRASH_DIE = 0x9032;
+static const StringID STR_9033_CAN_T_MAKE_VEHICLE_TURN = 0x9033;
+static const StringID STR_ONLY_TURN_SINGLE_UNIT = 0x9034;
+static const StringID STR_9034_RENAME = 0x9035;
+static const StringID STR_9035_RENAME_ROAD_VEHICLE_TYPE = 0x9036;
+static const StringID STR_9036_RENAME_ROAD_VEHICLE_TYPE = 0x9037;
+static const StringID STR_9037_CAN_T_RENAME_ROAD_VEHICLE = 0x9038;
+static const StringID STR_GO_TO_ROADVEH_DEPOT = 0x9039;
+static const StringID STR_SERVICE_AT_ROADVEH_DEPOT = 0x903A;
+static const StringID STR_REFIT_ROAD_VEHICLE_TO_CARRY = 0x903B;
+static const StringID STR_REFIT_ROAD_VEHICLE = 0x903C;
+static const StringID STR_REFIT_ROAD_VEHICLE_TO_CARRY_HIGHLIGHTED = 0x903D;
+static const StringID STR_REFIT_ROAD_VEHICLE_CAN_T = 0x903E;
+static const StringID STR_ROAD_SELECT_TYPE_OF_CARGO_FOR = 0x903F;
+
+static const StringID STR_9800_DOCK_CONSTRUCTION = 0x9800;
+static const StringID STR_9801_DOCK_CONSTRUCTION = 0x9801;
+static const StringID STR_9802_CAN_T_BUILD_DOCK_HERE = 0x9802;
+static const StringID STR_9803_SHIP_DEPOT = 0x9803;
+static const StringID STR_9804_NEW_SHIPS = 0x9804;
+static const StringID STR_9805_SHIPS = 0x9805;
+static const StringID STR_9808_NEW_SHIPS = 0x9806;
+static const StringID STR_9809_BUILD_SHIP = 0x9807;
+static const StringID STR_CLONE_SHIP = 0x9808;
+static const StringID STR_CLONE_SHIP_INFO = 0x9809;
+static const StringID STR_CLONE_SHIP_DEPOT_INFO = 0x980A;
+static const StringID STR_980B_SHIP_MUST_BE_STOPPED_IN = 0x980B;
+static const StringID STR_980C_CAN_T_SELL_SHIP = 0x980C;
+static const StringID STR_980D_CAN_T_BUILD_SHIP = 0x980D;
+static const StringID STR_980E_SHIP_IN_THE_WAY = 0x980E;
+static const StringID STR_980F = 0x980F;
+static const StringID STR_9811_DETAILS = 0x9810;
+static const StringID STR_9812_AGE_RUNNING_COST_YR = 0x9811;
+static const StringID STR_9813_MAX_SPEED = 0x9812;
+static const StringID STR_9814_PROFIT_THIS_YEAR_LAST_YEAR = 0x9813;
+static const StringID STR_9815_RELIABILITY_BREAKDOWNS = 0x9814;
+static const StringID STR_9816_BUILT_VALUE = 0x9815;
+static const StringID STR_9817_CAPACITY = 0x9816;
+static const StringID STR_9818_CAN_T_STOP_START_SHIP = 0x9817;
+static const StringID STR_9819_CAN_T_SEND_SHIP_TO_DEPOT = 0x9818;
+static const StringID STR_981A_UNABLE_TO_FIND_LOCAL_DEPOT = 0x9819;
+static const StringID STR_HEADING_FOR_SHIP_DEPOT = 0x981A;
+static const StringID STR_HEADING_FOR_SHIP_DEPOT_VEL = 0x981B;
+static const StringID STR_HEADING_FOR_SHIP_DEPOT_SERVICE = 0x981C;
+static const StringID STR_HEADING_FOR_SHIP_DEPOT_SERVICE_VEL = 0x981D;
+static const StringID STR_981C_SHIP_IS_WAITING_IN_DEPOT = 0x981E;
+static const StringID STR_981D_BUILD_SHIP_DOCK = 0x981F;
+static const StringID STR_981E_BUILD_SHIP_DEPOT_FOR_BUILDING = 0x9820;
+static const StringID STR_981F_SHIPS_CLICK_ON_SHIP_FOR = 0x9821;
+static const StringID STR_9820_BUILD_NEW_SHIP = 0x9822;
+static const StringID STR_9821_DRAG_SHIP_TO_HERE_TO_SELL = 0x9823;
+static const StringID STR_9822_CENTER_MAIN_VIEW_ON_SHIP = 0x9824;
+static const StringID STR_9823_SHIPS_CLICK_ON_SHIP_FOR = 0x9825;
+static const StringID STR_9824_BUILD_NEW_SHIPS_REQUIRES = 0x9826;
+static const StringID STR_9825_SHIP_SELECTION_LIST_CLICK = 0x9827;
+static const StringID STR_9826_BUILD_THE_HIGHLIGHTED_SHIP = 0x9828;
+static const StringID STR_9827_CURRENT_SHIP_ACTION_CLICK = 0x9829;
+static const StringID STR_9828_SHOW_SHIP_S_ORDERS = 0x982A;
+static const StringID STR_9829_CENTER_MAIN_VIEW_ON_SHIP = 0x982B;
+static const StringID STR_982A_SEND_SHIP_TO_DEPOT = 0x982C;
+static const StringID STR_982B_SHOW_SHIP_DETAILS = 0x982D;
+static const StringID STR_982E_COST_MAX_SPEED_CAPACITY = 0x982E;
+static const StringID STR_982F_NAME_SHIP = 0x982F;
+static const StringID STR_9831_NAME_SHIP = 0x9830;
+static const StringID STR_9832_CAN_T_NAME_SHIP = 0x9831;
+static const StringID STR_9833_CITIZENS_CELEBRATE_FIRST = 0x9832;
+static const StringID STR_9834_POSITION_BUOY_WHICH_CAN = 0x9833;
+static const StringID STR_9835_CAN_T_POSITION_BUOY_HERE = 0x9834;
+static const StringID STR_9836_RENAME = 0x9835;
+static const StringID STR_9837_RENAME_SHIP_TYPE = 0x9836;
+static const StringID STR_9838_RENAME_SHIP_TYPE = 0x9837;
+static const StringID STR_9839_CAN_T_RENAME_SHIP_TYPE = 0x9838;
+static const StringID STR_983A_REFIT_CARGO_SHIP_TO_CARRY = 0x9839;
+static const StringID STR_983B_REFIT = 0x983A;
+static const StringID STR_983C_REFIT_SHIP = 0x983B;
+static const StringID STR_983D_SELECT_TYPE_OF_CARGO_FOR = 0x983C;
+static const StringID STR_983E_REFIT_SHIP_TO_CARRY_HIGHLIGHTED = 0x983D;
+static const StringID STR_983F_SELECT_CARGO_TYPE_TO_CARRY = 0x983E;
+static const StringID STR_9840_NEW_CAPACITY_COST_OF_REFIT = 0x983F;
+static const StringID STR_9841_CAN_T_REFIT_SHIP = 0x9840;
+static const StringID STR_9842_REFITTABLE = 0x9841;
+static const StringID STR_GO_TO_SHIP_DEPOT = 0x9842;
+static const StringID SERVICE_AT_SHIP_DEPOT = 0x9843;
+
+static const StringID STR_A000_AIRPORTS = 0xA000;
+static const StringID STR_A001_CAN_T_BUILD_AIRPORT_HERE = 0xA001;
+static const StringID STR_A002_AIRCRAFT_HANGAR = 0xA002;
+static const StringID STR_A003_NEW_AIRCRAFT = 0xA003;
+static const StringID STR_CLONE_AIRCRAFT = 0xA004;
+static const StringID STR_CLONE_AIRCRAFT_INFO = 0xA005;
+static const StringID STR_CLONE_AIRCRAFT_INFO_HANGAR_WINDOW = 0xA006;
+static const StringID STR_A005_NEW_AIRCRAFT = 0xA007;
+static const StringID STR_A006_BUILD_AIRCRAFT = 0xA008;
+static const StringID STR_A008_CAN_T_BUILD_AIRCRAFT = 0xA009;
+static const StringID STR_A009_AIRCRAFT = 0xA00A;
+static const StringID STR_A00A = 0xA00B;
+static const StringID STR_A00B_ORDERS = 0xA00C;
+static const StringID STR_A00C_DETAILS = 0xA00D;
+static const StringID STR_A00D_AGE_RUNNING_COST_YR = 0xA00E;
+static const StringID STR_A00E_MAX_SPEED = 0xA00F;
+static const StringID STR_A00F_PROFIT_THIS_YEAR_LAST_YEAR = 0xA010;
+static const StringID STR_A010_RELIABILITY_BREAKDOWNS = 0xA011;
+static const StringID STR_A011_BUILT_VALUE = 0xA012;
+static const StringID STR_A012_CAN_T_SEND_AIRCRAFT_TO = 0xA013;
+static const StringID STR_HEADING_FOR_HANGAR = 0xA014;
+static const StringID STR_HEADING_FOR_HANGAR_VEL = 0xA015;
+static const StringID STR_HEADING_FOR_HANGAR_SERVICE = 0xA016;
+static const StringID STR_HEADING_FOR_HANGAR_SERVICE_VEL = 0xA017;
+static const StringID STR_A014_AIRCRAFT_IS_WAITING_IN = 0xA018;
+static const StringID STR_A015_AIRCRAFT_IN_THE_WAY = 0xA019;
+static const StringID STR_A016_CAN_T_STOP_START_AIRCRAFT = 0xA01A;
+static const StringID STR_A017_AIRCRAFT_IS_IN_FLIGHT = 0xA01B;
+static const StringID STR_A019_CAPACITY = 0xA01C;
+static const StringID STR_A01A_CAPACITY = 0xA01D;
+static const StringID STR_A01B_AIRCRAFT_MUST_BE_STOPPED = 0xA01E;
+static const StringID STR_A01C_CAN_T_SELL_AIRCRAFT = 0xA01F;
+static const StringID STR_A01D_AIRPORT_CONSTRUCTION = 0xA020;
+static const StringID STR_A01E_BUILD_AIRPORT = 0xA021;
+static const StringID STR_A01F_AIRCRAFT_CLICK_ON_AIRCRAFT = 0xA022;
+static const StringID STR_A020_BUILD_NEW_AIRCRAFT_REQUIRES = 0xA023;
+static const StringID STR_A021_AIRCRAFT_CLICK_ON_AIRCRAFT = 0xA024;
+static const StringID STR_A022_BUILD_NEW_AIRCRAFT = 0xA025;
+static const StringID STR_A023_DRAG_AIRCRAFT_TO_HERE_TO = 0xA026;
+static const StringID STR_A024_CENTER_MAIN_VIEW_ON_HANGAR = 0xA027;
+static const StringID STR_A025_AIRCRAFT_SELECTION_LIST = 0xA028;
+static const StringID STR_A026_BUILD_THE_HIGHLIGHTED_AIRCRAFT = 0xA029;
+static const StringID STR_A027_CURRENT_AIRCRAFT_ACTION = 0xA02A;
+static const StringID STR_A028_SHOW_AIRCRAFT_S_ORDERS = 0xA02B;
+static const StringID STR_A029_CENTER_MAIN_VIEW_ON_AIRCRAFT = 0xA02C;
+static const StringID STR_A02A_SEND_AIRCRAFT_TO_HANGAR = 0xA02D;
+static const StringID STR_A02B_SHOW_AIRCRAFT_DETAILS = 0xA02E;
+static const StringID STR_A02E_COST_MAX_SPEED_CAPACITY = 0xA02F;
+static const StringID STR_A030_NAME_AIRCRAFT = 0xA030;
+static const StringID STR_A031_CAN_T_NAME_AIRCRAFT = 0xA031;
+static const StringID STR_A032_NAME_AIRCRAFT = 0xA032;
+static const StringID STR_A033_CITIZENS_CELEBRATE_FIRST = 0xA033;
+static const StringID STR_A034_PLANE_CRASH_DIE_IN_FIREBALL = 0xA034;
+static const StringID STR_PLANE_CRASH_OUT_OF_FUEL = 0xA035;
+static const StringID STR_A036 = 0xA036;
+static const StringID STR_A037_RENAME = 0xA037;
+static const StringID STR_A038_RENAME_AIRCRAFT_TYPE = 0xA038;
+static const StringID STR_A039_RENAME_AIRCRAFT_TYPE = 0xA039;
+static const StringID STR_A03A_CAN_T_RENAME_AIRCRAFT_TYPE = 0xA03A;
+static const StringID STR_A03B_REFIT_AIRCRAFT_TO_CARRY = 0xA03B;
+static const StringID STR_A03C_REFIT = 0xA03C;
+static const StringID STR_A03D_REFIT_AIRCRAFT = 0xA03D;
+static const StringID STR_A03E_SELECT_TYPE_OF_CARGO_FOR = 0xA03E;
+static const StringID STR_A03F_REFIT_AIRCRAFT_TO_CARRY = 0xA03F;
+static const StringID STR_A040_SELECT_CARGO_TYPE_TO_CARRY = 0xA040;
+static const StringID STR_A041_NEW_CAPACITY_COST_OF_REFIT = 0xA041;
+static const StringID STR_A042_CAN_T_REFIT_AIRCRAFT = 0xA042;
+static const StringID STR_GO_TO_AIRPORT_HANGAR = 0xA043;
+static const StringID SERVICE_AT_AIRPORT_HANGAR = 0xA044;
+static const StringID STR_TIMETABLE_TITLE = 0xA045;
+
+static const StringID STR_B000_ZEPPELIN_DISASTER_AT = 0xB000;
+static const StringID STR_B001_ROAD_VEHICLE_DESTROYED = 0xB001;
+static const StringID STR_B002_OIL_REFINERY_EXPLOSION = 0xB002;
+static const StringID STR_B003_FACTORY_DESTROYED_IN_SUSPICIOUS = 0xB003;
+static const StringID STR_B004_UFO_LANDS_NEAR = 0xB004;
+static const StringID STR_B005_COAL_MINE_SUBSIDENCE_LEAVES = 0xB005;
+static const StringID STR_B006_FLOOD_VEHICLE_DESTROYED = 0xB006;
+static const StringID STR_BRIBE_FAILED = 0xB007;
+static const StringID STR_BRIBE_FAILED_2 = 0xB008;
+static const StringID STR_BUILD_DATE = 0xB009;
+static const StringID STR_PERFORMANCE_DETAIL = 0xB00A;
+static const StringID STR_PERFORMANCE_DETAIL_KEY = 0xB00B;
+static const StringID STR_PERFORMANCE_DETAIL_AMOUNT_CURRENCY = 0xB00C;
+static const StringID STR_PERFORMANCE_DETAIL_AMOUNT_INT = 0xB00D;
+static const StringID STR_PERFORMANCE_DETAIL_PERCENT = 0xB00E;
+static const StringID SET_PERFORMANCE_DETAIL_INT = 0xB00F;
+static const StringID STR_PERFORMANCE_DETAIL_VEHICLES = 0xB010;
+static const StringID STR_PERFORMANCE_DETAIL_STATIONS = 0xB011;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_PROFIT = 0xB012;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_INCOME = 0xB013;
+static const StringID STR_PERFORMANCE_DETAIL_MAX_INCOME = 0xB014;
+static const StringID STR_PERFORMANCE_DETAIL_DELIVERED = 0xB015;
+static const StringID STR_PERFORMANCE_DETAIL_CARGO = 0xB016;
+static const StringID STR_PERFORMANCE_DETAIL_MONEY = 0xB017;
+static const StringID STR_PERFORMANCE_DETAIL_LOAN = 0xB018;
+static const StringID STR_PERFORMANCE_DETAIL_TOTAL = 0xB019;
+static const StringID STR_PERFORMANCE_DETAIL_VEHICLES_TIP = 0xB01A;
+static const StringID STR_PERFORMANCE_DETAIL_STATIONS_TIP = 0xB01B;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_PROFIT_TIP = 0xB01C;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_INCOME_TIP = 0xB01D;
+static const StringID STR_PERFORMANCE_DETAIL_MAX_INCOME_TIP = 0xB01E;
+static const StringID STR_PERFORMANCE_DETAIL_DELIVERED_TIP = 0xB01F;
+static const StringID STR_PERFORMANCE_DETAIL_CARGO_TIP = 0xB020;
+static const StringID STR_PERFORMANCE_DETAIL_MONEY_TIP = 0xB021;
+static const StringID STR_PERFORMANCE_DETAIL_LOAN_TIP = 0xB022;
+static const StringID STR_PERFORMANCE_DETAIL_TOTAL_TIP = 0xB023;
+static const StringID STR_NEWGRF_SETTINGS_BUTTON = 0xB024;
+static const StringID STR_NEWGRF_SETTINGS_CAPTION = 0xB025;
+static const StringID STR_NEWGRF_APPLY_CHANGES = 0xB026;
+static const StringID STR_NEWGRF_SET_PARAMETERS = 0xB027;
+static const StringID STR_NEWGRF_TIP = 0xB028;
+static const StringID STR_NEWGRF_NO_FILES_INSTALLED = 0xB029;
+static const StringID STR_NEWGRF_FILENAME = 0xB02A;
+static const StringID STR_NEWGRF_GRF_ID = 0xB02B;
+static const StringID STR_NEWGRF_MD5SUM = 0xB02C;
+static const StringID STR_NEWGRF_CONFIRMATION_TEXT = 0xB02D;
+static const StringID STR_NEWGRF_ERROR_MSG_INFO = 0xB02E;
+static const StringID STR_NEWGRF_ERROR_MSG_WARNING = 0xB02F;
+static const StringID STR_NEWGRF_ERROR_MSG_ERROR = 0xB030;
+static const StringID STR_NEWGRF_ERROR_MSG_FATAL = 0xB031;
+static const StringID STR_NEWGRF_ERROR_VERSION_NUMBER = 0xB032;
+static const StringID STR_NEWGRF_ERROR_DOS_OR_WINDOWS = 0xB033;
+static const StringID STR_NEWGRF_ERROR_UNSET_SWITCH = 0xB034;
+static const StringID STR_NEWGRF_ERROR_INVALID_PARAMETER = 0xB035;
+static const StringID STR_NEWGRF_ERROR_LOAD_BEFORE = 0xB036;
+static const StringID STR_NEWGRF_ERROR_LOAD_AFTER = 0xB037;
+static const StringID STR_NEWGRF_ERROR_OTTD_VERSION_NUMBER = 0xB038;
+static const StringID STR_NEWGRF_ERROR_AFTER_TRANSLATED_FILE = 0xB039;
+static const StringID STR_NEWGRF_ERROR_TOO_MANY_NEWGRFS_LOADED = 0xB03A;
+static const StringID STR_NEWGRF_ERROR_STATIC_GRF_CAUSES_DESYNC = 0xB03B;
+static const StringID STR_NEWGRF_ADD = 0xB03C;
+static const StringID STR_NEWGRF_ADD_TIP = 0xB03D;
+static const StringID STR_NEWGRF_REMOVE = 0xB03E;
+static const StringID STR_NEWGRF_REMOVE_TIP = 0xB03F;
+static const StringID STR_NEWGRF_MOVEUP = 0xB040;
+static const StringID STR_NEWGRF_MOVEUP_TIP = 0xB041;
+static const StringID STR_NEWGRF_MOVEDOWN = 0xB042;
+static const StringID STR_NEWGRF_MOVEDOWN_TIP = 0xB043;
+static const StringID STR_NEWGRF_FILE_TIP = 0xB044;
+static const StringID STR_NEWGRF_PARAMETER = 0xB045;
+static const StringID STR_NEWGRF_PARAMETER_QUERY = 0xB046;
+static const StringID STR_NEWGRF_NO_INFO = 0xB047;
+static const StringID STR_NEWGRF_ADD_CAPTION = 0xB048;
+static const StringID STR_NEWGRF_ADD_FILE = 0xB049;
+static const StringID STR_NEWGRF_ADD_FILE_TIP = 0xB04A;
+static const StringID STR_NEWGRF_RESCAN_FILES = 0xB04B;
+static const StringID STR_NEWGRF_RESCAN_FILES_TIP = 0xB04C;
+static const StringID STR_NEWGRF_DUPLICATE_GRFID = 0xB04D;
+static const StringID STR_NEWGRF_NOT_FOUND = 0xB04E;
+static const StringID STR_NEWGRF_DISABLED = 0xB04F;
+static const StringID STR_NEWGRF_COMPATIBLE_LOADED = 0xB050;
+static const StringID STR_NEWGRF_COMPATIBLE_LOAD_WARNING = 0xB051;
+static const StringID STR_NEWGRF_DISABLED_WARNING = 0xB052;
+static const StringID STR_NEWGRF_NOT_FOUND_WARNING = 0xB053;
+static const StringID STR_NEWGRF_UNPAUSE_WARNING_TITLE = 0xB054;
+static const StringID STR_NEWGRF_UNPAUSE_WARNING = 0xB055;
+static const StringID STR_NEWGRF_BROKEN = 0xB056;
+static const StringID STR_NEWGRF_BROKEN_VEHICLE_LENGTH = 0xB057;
+static const StringID STR_BROKEN_VEHICLE_LENGTH = 0xB058;
+static const StringID STR_LOADGAME_REMOVED_TRAMS = 0xB059;
+static const StringID STR_CURRENCY_WINDOW = 0xB05A;
+static const StringID STR_CURRENCY_EXCHANGE_RATE = 0xB05B;
+static const StringID STR_CURRENCY_SEPARATOR = 0xB05C;
+static const StringID STR_CURRENCY_PREFIX = 0xB05D;
+static const StringID STR_CURRENCY_SUFFIX = 0xB05E;
+static const StringID STR_CURRENCY_SWITCH_TO_EURO = 0xB05F;
+static const StringID STR_CURRENCY_SWITCH_TO_EURO_NEVER = 0xB060;
+static const StringID STR_CURRENCY_PREVIEW = 0xB061;
+static const StringID STR_CURRENCY_CHANGE_PARAMETER = 0xB062;
+static const StringID STR_TRAIN = 0xB063;
+static const StringID STR_BUS = 0xB064;
+static const StringID STR_LORRY = 0xB065;
+static const StringID STR_PLANE = 0xB066;
+static const StringID STR_SHIP = 0xB067;
+static const StringID STR_SCHEDULED_TRAINS = 0xB068;
+static const StringID STR_SCHEDULED_ROAD_VEHICLES = 0xB069;
+static const StringID STR_SCHEDULED_AIRCRAFT = 0xB06A;
+static const StringID STR_SCHEDULED_SHIPS = 0xB06B;
+static const StringID STR_SCHEDULED_TRAINS_TIP = 0xB06C;
+static const StringID STR_SCHEDULED_ROAD_VEHICLES_TIP = 0xB06D;
+static const StringID STR_SCHEDULED_AIRCRAFT_TIP = 0xB06E;
+static const StringID STR_SCHEDULED_SHIPS_TIP = 0xB06F;
+static const StringID STR_VEH_WITH_SHARED_ORDERS_LIST = 0xB070;
+static const StringID STR_VEH_WITH_SHARED_ORDERS_LIST_TIP = 0xB071;
+static const StringID STR_DEPOT_SELL_CONFIRMATION_TEXT = 0xB072;
+static const StringID STR_DEPOT_WRONG_DEPOT_TYPE = 0xB073;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_TRAIN_TIP = 0xB074;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_ROADVEH_TIP = 0xB075;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_SHIP_TIP = 0xB076;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_AIRCRAFT_TIP = 0xB077;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_TRAIN_TIP = 0xB078;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_ROADVEH_TIP = 0xB079;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_SHIP_TIP = 0xB07A;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_AIRCRAFT_TIP = 0xB07B;
+static const StringID STR_DEPOT_AUTOREPLACE_TRAIN_TIP = 0xB07C;
+static const StringID STR_DEPOT_AUTOREPLACE_ROADVEH_TIP = 0xB07D;
+static const StringID STR_DEPOT_AUTOREPLACE_SHIP_TIP = 0xB07E;
+static const StringID STR_DEPOT_AUTOREPLACE_AIRCRAFT_TIP = 0xB07F;
+static const StringID STR_VEHICLE_LIST_TRAIN_DEPOT = 0xB080;
+static const StringID STR_VEHICLE_LIST_ROADVEH_DEPOT = 0xB081;
+static const StringID STR_VEHICLE_LIST_SHIP_DEPOT = 0xB082;
+static const StringID STR_VEHICLE_LIST_AIRCRAFT_DEPOT = 0xB083;
+static const StringID STR_REPLACE_VEHICLES_WHITE = 0xB084;
+static const StringID STR_REPLACE_VEHICLES_START = 0xB085;
+static const StringID STR_REPLACE_VEHICLES_STOP = 0xB086;
+static const StringID STR_NOT_REPLACING = 0xB087;
+static const StringID STR_NOT_REPLACING_VEHICLE_SELECTED = 0xB088;
+static const StringID STR_REPLACE_HELP_LEFT_ARRAY = 0xB089;
+static const StringID STR_REPLACE_HELP_RIGHT_ARRAY = 0xB08A;
+static const StringID STR_REPLACE_HELP_STOP_BUTTON = 0xB08B;
+static const StringID STR_REPLACE_HELP_START_BUTTON = 0xB08C;
+static const StringID STR_REPLACE_HELP_RAILTYPE = 0xB08D;
+static const StringID STR_REPLACE_HELP_REPLACE_INFO_TAB = 0xB08E;
+static const StringID STR_REPLACE_HELP = 0xB08F;
+static const StringID STR_REPLACE_REMOVE_WAGON = 0xB090;
+static const StringID STR_REPLACE_REMOVE_WAGON_HELP = 0xB091;
+static const StringID STR_REPLACE_ENGINE_WAGON_SELECT = 0xB092;
+static const StringID STR_REPLACE_ENGINE_WAGON_SELECT_HELP = 0xB093;
+static const StringID STR_RAIL_VEHICLE_NOT_AVAILABLE = 0xB094;
+static const StringID STR_ROAD_VEHICLE_NOT_AVAILABLE = 0xB095;
+static const StringID STR_SHIP_NOT_AVAILABLE = 0xB096;
+static const StringID STR_AIRCRAFT_NOT_AVAILABLE = 0xB097;
+static const StringID STR_ENGINES = 0xB098;
+static const StringID STR_WAGONS = 0xB099;
+static const StringID STR_MASS_STOP_DEPOT_TRAIN_TIP = 0xB09A;
+static const StringID STR_MASS_STOP_DEPOT_ROADVEH_TIP = 0xB09B;
+static const StringID STR_MASS_STOP_DEPOT_SHIP_TIP = 0xB09C;
+static const StringID STR_MASS_STOP_HANGAR_TIP = 0xB09D;
+static const StringID STR_MASS_START_DEPOT_TRAIN_TIP = 0xB09E;
+static const StringID STR_MASS_START_DEPOT_ROADVEH_TIP = 0xB09F;
+static const StringID STR_MASS_START_DEPOT_SHIP_TIP = 0xB0A0;
+static const StringID STR_MASS_START_HANGAR_TIP = 0xB0A1;
+static const StringID STR_MASS_STOP_LIST_TIP = 0xB0A2;
+static const StringID STR_MASS_START_LIST_TIP = 0xB0A3;
+static const StringID STR_SHORT_DATE = 0xB0A4;
+static const StringID STR_SIGN_LIST_CAPTION = 0xB0A5;
+static const StringID STR_ORDER_REFIT_FAILED = 0xB0A6;
+static const StringID STR_RAIL_VEHICLES = 0xB0A7;
+static const StringID STR_ELRAIL_VEHICLES = 0xB0A8;
+static const StringID STR_MONORAIL_VEHICLES = 0xB0A9;
+static const StringID STR_MAGLEV_VEHICLES = 0xB0AA;
+static const StringID STR_TINY_BLACK = 0xB0AB;
+static const StringID STR_PURCHASE_INFO_COST_WEIGHT = 0xB0AC;
+static const StringID STR_PURCHASE_INFO_SPEED_POWER = 0xB0AD;
+static const StringID STR_PURCHASE_INFO_SPEED = 0xB0AE;
+static const StringID STR_PURCHASE_INFO_RUNNINGCOST = 0xB0AF;
+static const StringID STR_PURCHASE_INFO_CAPACITY = 0xB0B0;
+static const StringID STR_PURCHASE_INFO_DESIGNED_LIFE = 0xB0B1;
+static const StringID STR_PURCHASE_INFO_RELIABILITY = 0xB0B2;
+static const StringID STR_PURCHASE_INFO_COST = 0xB0B3;
+static const StringID STR_PURCHASE_INFO_WEIGHT_CWEIGHT = 0xB0B4;
+static const StringID STR_PURCHASE_INFO_COST_SPEED = 0xB0B5;
+static const StringID STR_PURCHASE_INFO_AIRCRAFT_CAPACITY = 0xB0B6;
+static const StringID STR_PURCHASE_INFO_PWAGPOWER_PWAGWEIGHT = 0xB0B7;
+static const StringID STR_PURCHASE_INFO_REFITTABLE_TO = 0xB0B8;
+static const StringID STR_PURCHASE_INFO_ALL_TYPES = 0xB0B9;
+static const StringID STR_PURCHASE_INFO_ALL_BUT = 0xB0BA;
+static const StringID STR_PURCHASE_INFO_MAX_TE = 0xB0BB;
+static const StringID STR_NUM_1 = 0xB0BC;
+static const StringID STR_NUM_2 = 0xB0BD;
+static const StringID STR_NUM_3 = 0xB0BE;
+static const StringID STR_GENERATE = 0xB0BF;
+static const StringID STR_RANDOM = 0xB0C0;
+static const StringID STR_RANDOM_HELP = 0xB0C1;
+static const StringID STR_WORLD_GENERATION_CAPTION = 0xB0C2;
+static const StringID STR_RANDOM_SEED = 0xB0C3;
+static const StringID STR_RANDOM_SEED_HELP = 0xB0C4;
+static const StringID STR_LAND_GENERATOR = 0xB0C5;
+static const StringID STR_TREE_PLACER = 0xB0C6;
+static const StringID STR_HEIGHTMAP_ROTATION = 0xB0C7;
+static const StringID STR_TERRAIN_TYPE = 0xB0C8;
+static const StringID STR_QUANTITY_OF_SEA_LAKES = 0xB0C9;
+static const StringID STR_SMOOTHNESS = 0xB0CA;
+static const StringID STR_SNOW_LINE_HEIGHT = 0xB0CB;
+static const StringID STR_DATE = 0xB0CC;
+static const StringID STR_NUMBER_OF_TOWNS = 0xB0CD;
+static const StringID STR_NUMBER_OF_INDUSTRIES = 0xB0CE;
+static const StringID STR_GENERATE_DATE = 0xB0CF;
+static const StringID STR_SNOW_LINE_UP = 0xB0D0;
+static const StringID STR_SNOW_LINE_DOWN = 0xB0D1;
+static const StringID STR_SNOW_LINE_QUERY_CAPT = 0xB0D2;
+static const StringID STR_START_DATE_QUERY_CAPT = 0xB0D3;
+static const StringID STR_HEIGHTMAP_SCALE_WARNING_CAPTION = 0xB0D4;
+static const StringID STR_HEIGHTMAP_SCALE_WARNING_MESSAGE = 0xB0D5;
+static const StringID STR_TOWN_LAYOUT_WARNING_CAPTION = 0xB0D6;
+static const StringID STR_TOWN_LAYOUT_WARNING_MESSAGE = 0xB0D7;
+static const StringID STR_HEIGHTMAP_NAME = 0xB0D8;
+static const StringID STR_HEIGHTMAP_SIZE = 0xB0D9;
+static const StringID STR_GENERATION_WORLD = 0xB0DA;
+static const StringID STR_GENERATION_ABORT = 0xB0DB;
+static const StringID STR_GENERATION_ABORT_CAPTION = 0xB0DC;
+static const StringID STR_GENERATION_ABORT_MESSAGE = 0xB0DD;
+static const StringID STR_PROGRESS = 0xB0DE;
+static const StringID STR_GENERATION_PROGRESS = 0xB0DF;
+static const StringID STR_GENERATION_TIME = 0xB0E0;
+static const StringID STR_WORLD_GENERATION = 0xB0E1;
+static const StringID STR_TREE_GENERATION = 0xB0E2;
+static const StringID STR_UNMOVABLE_GENERATION = 0xB0E3;
+static const StringID STR_CLEARING_TILES = 0xB0E4;
+static const StringID STR_SETTINGUP_GAME = 0xB0E5;
+static const StringID STR_PREPARING_TILELOOP = 0xB0E6;
+static const StringID STR_PREPARING_GAME = 0xB0E7;
+static const StringID STR_DIFFICULTY_TO_CUSTOM = 0xB0E8;
+static const StringID STR_SE_FLAT_WORLD = 0xB0E9;
+static const StringID STR_SE_FLAT_WORLD_TIP = 0xB0EA;
+static const StringID STR_SE_RANDOM_LAND = 0xB0EB;
+static const StringID STR_SE_NEW_WORLD = 0xB0EC;
+static const StringID STR_SE_CAPTION = 0xB0ED;
+static const StringID STR_FLAT_WORLD_HEIGHT_DOWN = 0xB0EE;
+static const StringID STR_FLAT_WORLD_HEIGHT_UP = 0xB0EF;
+static const StringID STR_FLAT_WORLD_HEIGHT_QUERY_CAPT = 0xB0F0;
+static const StringID STR_FLAT_WORLD_HEIGHT = 0xB0F1;
+static const StringID STR_SMALLMAP_CENTER = 0xB0F2;
+static const StringID STR_SMALLMAP_INDUSTRY = 0xB0F3;
+static const StringID STR_SMALL_AIRPORT = 0xB0F4;
+static const StringID STR_CITY_AIRPORT = 0xB0F5;
+static const StringID STR_METRO_AIRPORT = 0xB0F6;
+static const StringID STR_INTERNATIONAL_AIRPORT = 0xB0F7;
+static const StringID STR_COMMUTER_AIRPORT = 0xB0F8;
+static const StringID STR_INTERCONTINENTAL_AIRPORT = 0xB0F9;
+static const StringID STR_HELIPORT = 0xB0FA;
+static const StringID STR_HELIDEPOT = 0xB0FB;
+static const StringID STR_HELISTATION = 0xB0FC;
+static const StringID STR_SMALL_AIRPORTS = 0xB0FD;
+static const StringID STR_LARGE_AIRPORTS = 0xB0FE;
+static const StringID STR_HUB_AIRPORTS = 0xB0FF;
+static const StringID STR_HELIPORTS = 0xB100;
+static const StringID STR_MEASURE_LENGTH = 0xB101;
+static const StringID STR_MEASURE_AREA = 0xB102;
+static const StringID STR_MEASURE_LENGTH_HEIGHTDIFF = 0xB103;
+static const StringID STR_MEASURE_AREA_HEIGHTDIFF = 0xB104;
+static const StringID STR_DATE_TINY = 0xB105;
+static const StringID STR_DATE_SHORT = 0xB106;
+static const StringID STR_DATE_LONG = 0xB107;
+static const StringID STR_FEEDER_CARGO_VALUE = 0xB108;
+static const StringID STR_DRIVE_THROUGH_ERROR_ON_TOWN_ROAD = 0xB109;
+static const StringID STR_DRIVE_THROUGH_ERROR_DIRECTION = 0xB10A;
+static const StringID STR_TRANSPARENCY_TOOLB = 0xB10B;
+static const StringID STR_TRANSPARENT_SIGNS_DESC = 0xB10C;
+static const StringID STR_TRANSPARENT_TREES_DESC = 0xB10D;
+static const StringID STR_TRANSPARENT_HOUSES_DESC = 0xB10E;
+static const StringID STR_TRANSPARENT_INDUSTRIES_DESC = 0xB10F;
+static const StringID STR_TRANSPARENT_BUILDINGS_DESC = 0xB110;
+static const StringID STR_TRANSPARENT_BRIDGES_DESC = 0xB111;
+static const StringID STR_TRANSPARENT_STRUCTURES_DESC = 0xB112;
+static const StringID STR_TRANSPARENT_CATENARY_DESC = 0xB113;
+static const StringID STR_TRANSPARENT_LOADING_DESC = 0xB114;
+static const StringID STR_PERCENT_UP_SMALL = 0xB115;
+static const StringID STR_PERCENT_UP = 0xB116;
+static const StringID STR_PERCENT_DOWN_SMALL = 0xB117;
+static const StringID STR_PERCENT_DOWN = 0xB118;
+static const StringID STR_PERCENT_UP_DOWN_SMALL = 0xB119;
+static const StringID STR_PERCENT_UP_DOWN = 0xB11A;
+static const StringID STR_GROUP_NAME_FORMAT = 0xB11B;
+static const StringID STR_GROUP_TINY_NAME = 0xB11C;
+static const StringID STR_GROUP_ALL_TRAINS = 0xB11D;
+static const StringID STR_GROUP_ALL_ROADS = 0xB11E;
+static const StringID STR_GROUP_ALL_SHIPS = 0xB11F;
+static const StringID STR_GROUP_ALL_AIRCRAFTS = 0xB120;
+static const StringID STR_GROUP_DEFAULT_TRAINS = 0xB121;
+static const StringID STR_GROUP_DEFAULT_ROADS = 0xB122;
+static const StringID STR_GROUP_DEFAULT_SHIPS = 0xB123;
+static const StringID STR_GROUP_DEFAULT_AIRCRAFTS = 0xB124;
+static const StringID STR_GROUP_TINY_NUM = 0xB125;
+static const StringID STR_GROUP_ADD_SHARED_VEHICLE = 0xB126;
+static const StringID STR_GROUP_REMOVE_ALL_VEHICLES = 0xB127;
+static const StringID STR_GROUP_TRAINS_CAPTION = 0xB128;
+static const StringID STR_GROUP_ROADVEH_CAPTION = 0xB129;
+static const StringID STR_GROUP_SHIPS_CAPTION = 0xB12A;
+static const StringID STR_GROUP_AIRCRAFTS_CAPTION = 0xB12B;
+static const StringID STR_GROUP_RENAME_CAPTION = 0xB12C;
+static const StringID STR_GROUP_REPLACE_CAPTION = 0xB12D;
+static const StringID STR_GROUP_CAN_T_CREATE = 0xB12E;
+static const StringID STR_GROUP_CAN_T_DELETE = 0xB12F;
+static const StringID STR_GROUP_CAN_T_RENAME = 0xB130;
+static const StringID STR_GROUP_CAN_T_REMOVE_ALL_VEHICLES = 0xB131;
+static const StringID STR_GROUP_CAN_T_ADD_VEHICLE = 0xB132;
+static const StringID STR_GROUP_CAN_T_ADD_SHARED_VEHICLE = 0xB133;
+static const StringID STR_GROUPS_CLICK_ON_GROUP_FOR_TIP = 0xB134;
+static const StringID STR_GROUP_CREATE_TIP = 0xB135;
+static const StringID STR_GROUP_DELETE_TIP = 0xB136;
+static const StringID STR_GROUP_RENAME_TIP = 0xB137;
+static const StringID STR_GROUP_REPLACE_PROTECTION_TIP = 0xB138;
+static const StringID STR_COMPANY_NAME = 0xB139;
+static const StringID STR_ENGINE_NAME = 0xB13A;
+static const StringID STR_GROUP_NAME = 0xB13B;
+static const StringID STR_PLAYER_NAME = 0xB13C;
+static const StringID STR_SIGN_NAME = 0xB13D;
+static const StringID STR_VEHICLE_NAME = 0xB13E;
+static const StringID STR_NAME_MUST_BE_UNIQUE = 0xB13F;
+static const StringID STR_NEXT_SIGN_TOOLTIP = 0xB140;
+static const StringID STR_PREVIOUS_SIGN_TOOLTIP = 0xB141;
+static const StringID STR_FUND_NEW_INDUSTRY = 0xB142;
+static const StringID STR_PROSPECT_NEW_INDUSTRY = 0xB143;
+static const StringID STR_BUILD_NEW_INDUSTRY = 0xB144;
+static const StringID STR_INDUSTRY_SELECTION_HINT = 0xB145;
+static const StringID STR_FACE_ADVANCED = 0xB146;
+static const StringID STR_FACE_ADVANCED_TIP = 0xB147;
+static const StringID STR_FACE_SIMPLE = 0xB148;
+static const StringID STR_FACE_SIMPLE_TIP = 0xB149;
+static const StringID STR_FACE_LOAD = 0xB14A;
+static const StringID STR_FACE_LOAD_TIP = 0xB14B;
+static const StringID STR_FACE_LOAD_DONE = 0xB14C;
+static const StringID STR_FACE_FACECODE = 0xB14D;
+static const StringID STR_FACE_FACECODE_TIP = 0xB14E;
+static const StringID STR_FACE_FACECODE_CAPTION = 0xB14F;
+static const StringID STR_FACE_FACECODE_SET = 0xB150;
+static const StringID STR_FACE_FACECODE_ERR = 0xB151;
+static const StringID STR_FACE_SAVE = 0xB152;
+static const StringID STR_FACE_SAVE_TIP = 0xB153;
+static const StringID STR_FACE_SAVE_DONE = 0xB154;
+static const StringID STR_FACE_EUROPEAN = 0xB155;
+static const StringID STR_FACE_SELECT_EUROPEAN = 0xB156;
+static const StringID STR_FACE_AFRICAN = 0xB157;
+static const StringID STR_FACE_SELECT_AFRICAN = 0xB158;
+static const StringID STR_FACE_YES = 0xB159;
+static const StringID STR_FACE_NO = 0xB15A;
+static const StringID STR_FACE_MOUSTACHE_EARRING_TIP = 0xB15B;
+static const StringID STR_FACE_HAIR = 0xB15C;
+static const StringID STR_FACE_HAIR_TIP = 0xB15D;
+static const StringID STR_FACE_EYEBROWS = 0xB15E;
+static const StringID STR_FACE_EYEBROWS_TIP = 0xB15F;
+static const StringID STR_FACE_EYECOLOUR = 0xB160;
+static const StringID STR_FACE_EYECOLOUR_TIP = 0xB161;
+static const StringID STR_FACE_GLASSES = 0xB162;
+static const StringID STR_FACE_GLASSES_TIP = 0xB163;
+static const StringID STR_FACE_GLASSES_TIP_2 = 0xB164;
+static const StringID STR_FACE_NOSE = 0xB165;
+static const StringID STR_FACE_NOSE_TIP = 0xB166;
+static const StringID STR_FACE_LIPS = 0xB167;
+static const StringID STR_FACE_MOUSTACHE = 0xB168;
+static const StringID STR_FACE_LIPS_MOUSTACHE_TIP = 0xB169;
+static const StringID STR_FACE_CHIN = 0xB16A;
+static const StringID STR_FACE_CHIN_TIP = 0xB16B;
+static const StringID STR_FACE_JACKET = 0xB16C;
+static const StringID STR_FACE_JACKET_TIP = 0xB16D;
+static const StringID STR_FACE_COLLAR = 0xB16E;
+static const StringID STR_FACE_COLLAR_TIP = 0xB16F;
+static const StringID STR_FACE_TIE = 0xB170;
+static const StringID STR_FACE_EARRING = 0xB171;
+static const StringID STR_FACE_TIE_EARRING_TIP = 0xB172;
+static const StringID STR_SIGNAL_SELECTION = 0xB173;
+static const StringID STR_SIGNAL_CAN_T_CONVERT_SIGNALS_HERE = 0xB174;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_NORM_TIP = 0xB175;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_ENTRY_TIP = 0xB176;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_EXIT_TIP = 0xB177;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_COMBO_TIP = 0xB178;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_NORM_TIP = 0xB179;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_ENTRY_TIP = 0xB17A;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_EXIT_TIP = 0xB17B;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_COMBO_TIP = 0xB17C;
+static const StringID STR_SIGNAL_CONVERT_TIP = 0xB17D;
+static const StringID STR_DRAG_SIGNALS_DENSITY_TIP = 0xB17E;
+static const StringID STR_DRAG_SIGNALS_DENSITY_DECREASE_TIP = 0xB17F;
+static const StringID STR_DRAG_SIGNALS_DENSITY_INCREASE_TIP = 0xB180;
+
+static const StringID STR_LAST_STRINGID = 0xB180;
+
+enum {
+	LANGUAGE_PACK_IDENT = 0x474E414C, // Big Endian value for 'LANG' (LE is 0x 4C 41 4E 47)
+	LANGUAGE_PACK_VERSION = 0x266A7AB5,
+};
+
+#endif /* TABLE_STRINGS_H */
@@ -62,11 +62,25 @@ static inline void SetStreamOffset(BmpBuffer *buffer, int offset)
 	AdvanceBuffer(buffer);
 }
 
+/**
+ * Hand the rows from 'from' down to 'to' to the row function. The first one
+ * has the pixels that have been read into the row buffer, the others have
+ * been skipped and are empty.
+ */
+static void BmpFinishRows(BmpInfo *info, BmpData *data, uint from, uint to, BmpRowProc *proc, void *param)
+{
+	for (uint y = from;; y--) {
+		proc(y, data->bitmap, param);
+		memset(data->bitmap, 0, info->width);
+		if (y == to) break;
+	}
+}
+
 /**
  * Reads a 1 bpp uncompressed bitmap
  * The bitmap is converted to a 8 bpp bitmap
  */
-static inline bool BmpRead1(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead1(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint x, y, i;
 	byte pad = GB(4 - info->width / 8, 0, 2);
@@ -74,7 +88,7 @@ static inline bool BmpRead1(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 	byte b;
 	for (y = info->height; y > 0; y--) {
 		x = 0;
-		pixel_row = &data->bitmap[(y - 1) * info->width];
+		pixel_row = data->bitmap;
 		while (x < info->width) {
 			if (EndOfBuffer(buffer)) return false; // the file is shorter than expected
 			b = ReadByte(buffer);
@@ -85,6 +99,7 @@ static inline bool BmpRead1(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 		}
 		/* Padding for 32 bit align */
 		SkipBytes(buffer, pad);
+		proc(y - 1, data->bitmap, param);
 	}
 	return true;
 }
@@ -93,7 +108,7 @@ static inline bool BmpRead1(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
  * Reads a 4 bpp uncompressed bitmap
  * The bitmap is converted to a 8 bpp bitmap
  */
-static inline bool BmpRead4(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead4(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint x, y;
 	byte pad = GB(4 - info->width / 2, 0, 2);
@@ -101,7 +116,7 @@ static inline bool BmpRead4(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 	byte b;
 	for (y = info->height; y > 0; y--) {
 		x = 0;
-		pixel_row = &data->bitmap[(y - 1) * info->width];
+		pixel_row = data->bitmap;
 		while (x < info->width) {
 			if (EndOfBuffer(buffer)) return false;  // the file is shorter than expected
 			b = ReadByte(buffer);
@@ -114,6 +129,7 @@ static inline bool BmpRead4(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 		}
 		/* Padding for 32 bit align */
 		SkipBytes(buffer, pad);
+		proc(y - 1, data->bitmap, param);
 	}
 	return true;
 }
@@ -122,13 +138,13 @@ static inline bool BmpRead4(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
  * Reads a 4-bit RLE compressed bitmap
  * The bitmap is converted to a 8 bpp bitmap
  */
-static inline bool BmpRead4Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead4Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint i;
 	uint x = 0;
 	uint y = info->height - 1;
 	byte n, c, b;
-	byte *pixel = &data->bitmap[y * info->width];
+	byte *pixel = data->bitmap;
 	while (y != 0 || x < info->width) {
 		if (EndOfBuffer(buffer)) return false; // the file is shorter than expected
 		n = ReadByte(buffer);
@@ -136,20 +152,24 @@ static inline bool BmpRead4Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 		if (n == 0) {
 			switch (c) {
 			case 0: // end of line
+				BmpFinishRows(info, data, y, y, proc, param);
+				if (y == 0) return true;
 				x = 0;
-				pixel = &data->bitmap[--y * info->width];
+				y--;
+				pixel = data->bitmap;
 				break;
 			case 1: // end of bitmap
-				x = info->width;
-				y = 0;
-				pixel = NULL;
-				break;
+				BmpFinishRows(info, data, y, 0, proc, param);
+				return true;
 			case 2: // delta
 				x += ReadByte(buffer);
 				i = ReadByte(buffer);
-				if (x >= info->width || (y == 0 && i > 0)) return false;
-				y -= i;
-				pixel = &data->bitmap[y * info->width + x];
+				if (x >= info->width || i > y) return false;
+				if (i > 0) {
+					BmpFinishRows(info, data, y, y - i + 1, proc, param);
+					y -= i;
+				}
+				pixel = &data->bitmap[x];
 				break;
 			default: // uncompressed
 				i = 0;
@@ -180,13 +200,14 @@ static inline bool BmpRead4Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 			}
 		}
 	}
+	BmpFinishRows(info, data, 0, 0, proc, param);
 	return true;
 }
 
 /**
  * Reads a 8 bpp bitmap
  */
-static inline bool BmpRead8(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead8(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint i;
 	uint y;
@@ -194,10 +215,11 @@ static inline bool BmpRead8(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 	byte *pixel;
 	for (y = info->height; y > 0; y--) {
 		if (EndOfBuffer(buffer)) return false; // the file is shorter than expected
-		pixel = &data->bitmap[(y - 1) * info->width];
+		pixel = data->bitmap;
 		for (i = 0; i < info->width; i++) *pixel++ = ReadByte(buffer);
 		/* Padding for 32 bit align */
 		SkipBytes(buffer, pad);
+		proc(y - 1, data->bitmap, param);
 	}
 	return true;
 }
@@ -205,13 +227,13 @@ static inline bool BmpRead8(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 /**
  * Reads a 8-bit RLE compressed bpp bitmap
  */
-static inline bool BmpRead8Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead8Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint i;
 	uint x = 0;
 	uint y = info->height - 1;
 	byte n, c;
-	byte *pixel = &data->bitmap[y * info->width];
+	byte *pixel = data->bitmap;
 	while (y != 0 || x < info->width) {
 		if (EndOfBuffer(buffer)) return false; // the file is shorter than expected
 		n = ReadByte(buffer);
@@ -219,20 +241,24 @@ static inline bool BmpRead8Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 		if (n == 0) {
 			switch (c) {
 			case 0: // end of line
+				BmpFinishRows(info, data, y, y, proc, param);
+				if (y == 0) return true;
 				x = 0;
-				pixel = &data->bitmap[--y * info->width];
+				y--;
+				pixel = data->bitmap;
 				break;
 			case 1: // end of bitmap
-				x = info->width;
-				y = 0;
-				pixel = NULL;
-				break;
+				BmpFinishRows(info, data, y, 0, proc, param);
+				return true;
 			case 2: // delta
 				x += ReadByte(buffer);
 				i = ReadByte(buffer);
-				if (x >= info->width || (y == 0 && i > 0)) return false;
-				y -= i;
-				pixel = &data->bitmap[y * info->width + x];
+				if (x >= info->width || i > y) return false;
+				if (i > 0) {
+					BmpFinishRows(info, data, y, y - i + 1, proc, param);
+					y -= i;
+				}
+				pixel = &data->bitmap[x];
 				break;
 			default: // uncompressed
 				if ((x += c) > info->width) return false;
@@ -249,19 +275,20 @@ static inline bool BmpRead8Rle(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 			}
 		}
 	}
+	BmpFinishRows(info, data, 0, 0, proc, param);
 	return true;
 }
 
 /**
  * Reads a 24 bpp uncompressed bitmap
  */
-static inline bool BmpRead24(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+static inline bool BmpRead24(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	uint x, y;
 	byte pad = GB(4 - info->width * 3, 0, 2);
 	byte *pixel_row;
 	for (y = info->height; y > 0; y--) {
-		pixel_row = &data->bitmap[(y - 1) * info->width * 3];
+		pixel_row = data->bitmap;
 		for (x = 0; x < info->width; x++) {
 			if (EndOfBuffer(buffer)) return false; // the file is shorter than expected
 			*(pixel_row + 2) = ReadByte(buffer); // green
@@ -271,6 +298,7 @@ static inline bool BmpRead24(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 		}
 		/* Padding for 32 bit align */
 		SkipBytes(buffer, pad);
+		proc(y - 1, data->bitmap, param);
 	}
 	return true;
 }
@@ -347,14 +375,14 @@ bool BmpReadHeader(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 }
 
 /*
- * Reads the bitmap
+ * Reads the bitmap, one row at a time; only one row is kept in memory.
  * 1 bpp and 4 bpp bitmaps are converted to 8 bpp bitmaps
  */
-bool BmpReadBitmap(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
+bool BmpReadBitmap(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param)
 {
 	assert(info != NULL && data != NULL);
 
-	data->bitmap = CallocT<byte>(info->width * info->height * ((info->bpp == 24) ? 3 : 1));
+	data->bitmap = CallocT<byte>(info->width * ((info->bpp == 24) ? 3 : 1));
 	if (data->bitmap == NULL) return false;
 
 	/* Load image */
@@ -362,14 +390,14 @@ bool BmpReadBitmap(BmpBuffer *buffer, BmpInfo *info, BmpData *data)
 	switch (info->compression) {
 	case 0: // no compression
 		switch (info->bpp) {
-		case 1:  return BmpRead1(buffer, info, data);
-		case 4:  return BmpRead4(buffer, info, data);
-		case 8:  return BmpRead8(buffer, info, data);
-		case 24: return BmpRead24(buffer, info, data);
+		case 1:  return BmpRead1(buffer, info, data, proc, param);
+		case 4:  return BmpRead4(buffer, info, data, proc, param);
+		case 8:  return BmpRead8(buffer, info, data, proc, param);
+		case 24: return BmpRead24(buffer, info, data, proc, param);
 		default: NOT_REACHED(); return false;
 		}
-	case 1:  return BmpRead8Rle(buffer, info, data); // 8-bit RLE compression
-	case 2:  return BmpRead4Rle(buffer, info, data); // 4-bit RLE compression
+	case 1:  return BmpRead8Rle(buffer, info, data, proc, param); // 8-bit RLE compression
+	case 2:  return BmpRead4Rle(buffer, info, data, proc, param); // 4-bit RLE compression
 	default: NOT_REACHED(); return false;
 	}
 }
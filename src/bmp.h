@@ -19,9 +19,18 @@ struct BmpInfo {
 
 struct BmpData {
 	Colour *palette;
-	byte   *bitmap;
+	byte   *bitmap; ///< the row of the bitmap that is being read
 };
 
+/**
+ * Function receiving the rows of a bitmap while it is being read. The rows
+ * are read from the bottom of the image to the top.
+ * @param y     the row, counted from the top of the image
+ * @param row   the pixels of the row; palette indices, or RGB for 24 bpp
+ * @param param the parameter passed to BmpReadBitmap
+ */
+typedef void BmpRowProc(uint y, const byte *row, void *param);
+
 #define BMP_BUFFER_SIZE 1024
 
 struct BmpBuffer {
@@ -34,7 +43,7 @@ struct BmpBuffer {
 
 void BmpInitializeBuffer(BmpBuffer *buffer, FILE *file);
 bool BmpReadHeader(BmpBuffer *buffer, BmpInfo *info, BmpData *data);
-bool BmpReadBitmap(BmpBuffer *buffer, BmpInfo *info, BmpData *data);
+bool BmpReadBitmap(BmpBuffer *buffer, BmpInfo *info, BmpData *data, BmpRowProc *proc, void *param);
 void BmpDestroyData(BmpData *data);
 
 #endif /* BMP_H */
@@ -7,6 +7,7 @@
 #include "station.h"
 #include "cargopacket.h"
 #include "saveload.h"
+#include "vehicle_base.h"
 
 #include "safeguards.h"
 
@@ -30,6 +31,7 @@ CargoPacket::CargoPacket(StationID source, uint16 count)
 
 	this->count           = count;
 	this->days_in_transit = 0;
+	this->aged_at         = 0;
 	this->feeder_share    = 0;
 	this->paid_for        = false;
 }
@@ -39,11 +41,6 @@ CargoPacket::~CargoPacket()
 	this->count = 0;
 }
 
-bool CargoPacket::SameSource(const CargoPacket *cp) const
-{
-	return this->source_xy == cp->source_xy && this->days_in_transit == cp->days_in_transit && this->paid_for == cp->paid_for;
-}
-
 static const SaveLoad _cargopacket_desc[] = {
 	SLE_VAR(CargoPacket, source,          SLE_UINT16),
 	SLE_VAR(CargoPacket, source_xy,       SLE_UINT32),
@@ -58,6 +55,11 @@ static const SaveLoad _cargopacket_desc[] = {
 
 static void Save_CAPA()
 {
+	/* The packets only know their days in transit as of the last time
+	 * they were brought up to date; only vehicles age their cargo. */
+	Vehicle *v;
+	FOR_ALL_VEHICLES(v) v->cargo.UpdatePacketAges();
+
 	CargoPacket *cp;
 
 	FOR_ALL_CARGOPACKETS(cp) {
@@ -96,24 +98,30 @@ CargoList::~CargoList()
 
 const CargoList::List *CargoList::Packets() const
 {
+	UpdatePacketAges();
 	return &packets;
 }
 
 void CargoList::AgeCargo()
 {
-	if (empty) return;
+	if (packets.empty()) return;
 
-	uint dit = 0;
+	age++;
+	days_in_transit_valid = false;
+}
+
+void CargoList::UpdatePacketAges() const
+{
 	for (List::const_iterator it = packets.begin(); it != packets.end(); it++) {
-		if ((*it)->days_in_transit != 0xFF) (*it)->days_in_transit++;
-		dit += (*it)->days_in_transit * (*it)->count;
+		CargoPacket *cp = *it;
+		cp->days_in_transit = PacketDaysInTransit(cp);
+		cp->aged_at         = age;
 	}
-	days_in_transit = dit / count;
 }
 
 bool CargoList::Empty() const
 {
-	return empty;
+	return packets.empty();
 }
 
 uint CargoList::Count() const
@@ -123,7 +131,7 @@ uint CargoList::Count() const
 
 bool CargoList::UnpaidCargo() const
 {
-	return unpaid_cargo;
+	return unpaid_packets != 0;
 }
 
 Money CargoList::FeederShare() const
@@ -138,52 +146,105 @@ StationID CargoList::Source() const
 
 uint CargoList::DaysInTransit() const
 {
+	if (!days_in_transit_valid) {
+		uint dit = 0;
+		for (List::const_iterator it = packets.begin(); it != packets.end(); it++) {
+			dit += PacketDaysInTransit(*it) * (*it)->count;
+		}
+		days_in_transit = (count == 0) ? 0 : dit / count;
+		days_in_transit_valid = true;
+	}
 	return days_in_transit;
 }
 
+/**
+ * Account for a packet that has been added to this list.
+ * @param cp the added packet, its days in transit must be up to date
+ */
+void CargoList::AddToCache(CargoPacket *cp)
+{
+	cp->aged_at = age;
+
+	count           += cp->count;
+	unpaid_packets  += !cp->paid_for;
+	feeder_share    += cp->feeder_share;
+	days_in_transit_valid = false;
+}
+
+/**
+ * Account for a packet that has been removed from this list; this also
+ * brings the days in transit of the packet up to date.
+ * @param cp the removed packet
+ */
+void CargoList::RemoveFromCache(CargoPacket *cp)
+{
+	cp->days_in_transit = PacketDaysInTransit(cp);
+	cp->aged_at         = age;
+
+	count           -= cp->count;
+	unpaid_packets  -= !cp->paid_for;
+	feeder_share    -= cp->feeder_share;
+	days_in_transit_valid = false;
+}
+
 void CargoList::Append(CargoPacket *cp)
 {
 	assert(cp != NULL);
 	assert(cp->IsValid());
 
 	for (List::iterator it = packets.begin(); it != packets.end(); it++) {
-		if ((*it)->SameSource(cp) && (*it)->count + cp->count <= 65535) {
-			(*it)->count        += cp->count;
-			(*it)->feeder_share += cp->feeder_share;
+		CargoPacket *icp = *it;
+		/* Only merge with cargo from (exactly) the same source in time and location */
+		if (icp->source_xy == cp->source_xy && PacketDaysInTransit(icp) == cp->days_in_transit && icp->paid_for == cp->paid_for &&
+				icp->count + cp->count <= 65535) {
+			icp->count        += cp->count;
+			icp->feeder_share += cp->feeder_share;
+
+			/* Same paid_for state, so only the totals change */
+			count        += cp->count;
+			feeder_share += cp->feeder_share;
+			days_in_transit_valid = false;
 			delete cp;
-
-			InvalidateCache();
 			return;
 		}
 	}
 
 	/* The packet could not be merged with another one */
 	packets.push_back(cp);
-	InvalidateCache();
+	AddToCache(cp);
+	source = packets.front()->source;
 }
 
 
 void CargoList::Truncate(uint count)
 {
-	for (List::iterator it = packets.begin(); it != packets.end(); it++) {
-		uint local_count = (*it)->count;
-		if (local_count <= count) {
-			count -= local_count;
+	List::iterator it = packets.begin();
+	for (; it != packets.end(); it++) {
+		CargoPacket *cp = *it;
+		if (cp->count <= count) {
+			count -= cp->count;
 			continue;
 		}
 
-		(*it)->count = count;
-		count = 0;
+		/* This packet gets cut; only the amount changes */
+		this->count -= cp->count - count;
+		this->days_in_transit_valid = false;
+		cp->count = count;
+
+		/* Keep the packet if anything is left of it */
+		if (count != 0) it++;
+		break;
 	}
 
-	while (!packets.empty()) {
-		CargoPacket *cp = packets.back();
-		if (cp->count != 0) break;
+	/* Everything from here on is gone completely */
+	for (List::iterator rit = it; rit != packets.end(); rit++) {
+		CargoPacket *cp = *rit;
+		RemoveFromCache(cp);
 		delete cp;
-		packets.pop_back();
 	}
+	packets.erase(it, packets.end());
 
-	InvalidateCache();
+	source = packets.empty() ? INVALID_STATION : packets.front()->source;
 }
 
 bool CargoList::MoveTo(CargoList *dest, uint count, CargoList::MoveToAction mta, uint data)
@@ -192,10 +253,11 @@ bool CargoList::MoveTo(CargoList *dest, uint count, CargoList::MoveToAction mta,
 	CargoList tmp;
 
 	while (!packets.empty() && count > 0) {
-		CargoPacket *cp = *packets.begin();
+		CargoPacket *cp = packets.front();
 		if (cp->count <= count) {
 			/* Can move the complete packet */
-			packets.remove(cp);
+			packets.pop_front();
+			RemoveFromCache(cp);
 			switch (mta) {
 				case MTA_FINAL_DELIVERY:
 					if (cp->source == data) {
@@ -213,30 +275,37 @@ bool CargoList::MoveTo(CargoList *dest, uint count, CargoList::MoveToAction mta,
 				case MTA_OTHER:
 					count -= cp->count;
 					dest->packets.push_back(cp);
+					dest->AddToCache(cp);
 					break;
 			}
 		} else {
 			/* Can move only part of the packet, so split it into two pieces */
+			Money fs = 0;
 			if (mta != MTA_FINAL_DELIVERY) {
 				CargoPacket *cp_new = new CargoPacket();
 
-				Money fs = cp->feeder_share * count / static_cast<uint>(cp->count);
+				fs = cp->feeder_share * count / static_cast<uint>(cp->count);
 				cp->feeder_share -= fs;
 
 				cp_new->source          = cp->source;
 				cp_new->source_xy       = cp->source_xy;
 				cp_new->loaded_at_xy    = (mta == MTA_CARGO_LOAD) ? data : cp->loaded_at_xy;
 
-				cp_new->days_in_transit = cp->days_in_transit;
+				cp_new->days_in_transit = PacketDaysInTransit(cp);
 				cp_new->feeder_share    = fs;
 				/* When cargo is moved into another vehicle you have *always* paid for it */
 				cp_new->paid_for        = (mta == MTA_CARGO_LOAD) ? false : cp->paid_for;
 
 				cp_new->count = count;
 				dest->packets.push_back(cp_new);
+				dest->AddToCache(cp_new);
 			}
 			cp->count -= count;
 
+			this->count        -= count;
+			this->feeder_share -= fs;
+			this->days_in_transit_valid = false;
+
 			count = 0;
 		}
 	}
@@ -249,30 +318,26 @@ bool CargoList::MoveTo(CargoList *dest, uint count, CargoList::MoveToAction mta,
 		tmp.packets.clear();
 	}
 
-	if (dest != NULL) dest->InvalidateCache();
-	InvalidateCache();
+	if (dest != NULL) dest->source = dest->packets.empty() ? INVALID_STATION : dest->packets.front()->source;
+	source = packets.empty() ? INVALID_STATION : packets.front()->source;
 
 	return remaining;
 }
 
 void CargoList::InvalidateCache()
 {
-	empty = packets.empty();
+	UpdatePacketAges();
+
 	count = 0;
-	unpaid_cargo = false;
+	unpaid_packets = 0;
 	feeder_share = 0;
 	source = INVALID_STATION;
-	days_in_transit = 0;
+	days_in_transit_valid = false;
 
-	if (empty) return;
+	if (packets.empty()) return;
 
-	uint dit = 0;
 	for (List::const_iterator it = packets.begin(); it != packets.end(); it++) {
-		count        += (*it)->count;
-		unpaid_cargo |= !(*it)->paid_for;
-		dit          += (*it)->days_in_transit * (*it)->count;
-		feeder_share += (*it)->feeder_share;
+		AddToCache(*it);
 	}
-	days_in_transit = dit / count;
-	source = (*packets.begin())->source;
+	source = packets.front()->source;
 }
@@ -7,7 +7,7 @@
 
 #include "economy_type.h"
 #include "tile_type.h"
-#include <list>
+#include <deque>
 
 typedef uint32 CargoPacketID;
 struct CargoPacket;
@@ -25,7 +25,8 @@ struct CargoPacket : PoolItem<CargoPacket, CargoPacketID, &_CargoPacket_pool> {
 	TileIndex loaded_at_xy; ///< Location where this cargo has been loaded into the vehicle
 
 	uint16 count;           ///< The amount of cargo in this packet
-	byte days_in_transit;   ///< Amount of days this packet has been in transit
+	byte days_in_transit;   ///< Amount of days this packet has been in transit, excluding the aging of its list since aged_at
+	uint aged_at;           ///< Age of the list holding this packet when days_in_transit was last brought up to date (not saved)
 	Money feeder_share;     ///< Value of feeder pickup to be paid for on delivery of cargo
 	bool paid_for;          ///< Have we been paid for this cargo packet?
 
@@ -46,14 +47,6 @@ struct CargoPacket : PoolItem<CargoPacket, CargoPacketID, &_CargoPacket_pool> {
 	 * @return true if and only it is valid
 	 */
 	inline bool IsValid() const { return this->count != 0; }
-
-	/**
-	 * Checks whether the cargo packet is from (exactly) the same source
-	 * in time and location.
-	 * @param cp the cargo packet to compare to
-	 * @return true if and only if days_in_transit and source_xy are equal
-	 */
-	bool SameSource(const CargoPacket *cp) const;
 };
 
 /**
@@ -72,12 +65,17 @@ struct CargoPacket : PoolItem<CargoPacket, CargoPacketID, &_CargoPacket_pool> {
 extern void SaveLoad_STNS(Station *st);
 
 /**
- * Simple collection class for a list of cargo packets
+ * Simple collection class for a list of cargo packets.
+ * The packets are kept in a deque, i.e. in contiguous chunks, and the
+ * cached totals are updated on every change instead of being recounted.
+ * Aging only increments the age of the list; the days in transit of a
+ * packet are brought up to date when it leaves the list or when the
+ * packets are accessed directly.
  */
 class CargoList {
 public:
 	/** List of cargo packets */
-	typedef std::list<CargoPacket *> List;
+	typedef std::deque<CargoPacket *> List;
 
 	/** Kind of actions that could be done with packets on move */
 	enum MoveToAction {
@@ -87,25 +85,42 @@ public:
 	};
 
 private:
-	List packets;         ///< The cargo packets in this list
+	List packets;         ///< The cargo packets in this list; must stay the first member as Vehicle saves the list via its cargo member
 
-	bool empty;           ///< Cache for whether this list is empty or not
 	uint count;           ///< Cache for the number of cargo entities
-	bool unpaid_cargo;    ///< Cache for the unpaid cargo
+	uint unpaid_packets;  ///< Cache for the number of packets that have not been paid for
 	Money feeder_share;   ///< Cache for the feeder share
 	StationID source;     ///< Cache for the source of the packet
-	uint days_in_transit; ///< Cache for the number of days in transit
+	uint age;             ///< Number of times this list has been aged (not saved)
+
+	mutable bool days_in_transit_valid; ///< Whether days_in_transit is up to date
+	mutable uint days_in_transit;       ///< Cache for the average number of days in transit
+
+	void AddToCache(CargoPacket *cp);
+	void RemoveFromCache(CargoPacket *cp);
+
+	/**
+	 * Gets the days in transit of a packet in this list, including the aging
+	 * of the list since the packet was last brought up to date.
+	 * @param cp the packet to get the days in transit of
+	 * @return the days in transit
+	 */
+	inline uint PacketDaysInTransit(const CargoPacket *cp) const
+	{
+		return min(cp->days_in_transit + (this->age - cp->aged_at), 0xFFU);
+	}
 
 public:
 	friend void SaveLoad_STNS(Station *st);
 
 	/** Create the cargo list */
-	CargoList() { this->InvalidateCache(); }
+	CargoList() : age(0) { this->InvalidateCache(); }
 	/** And destroy it ("frees" all cargo packets) */
 	~CargoList();
 
 	/**
 	 * Returns a pointer to the cargo packet list (so you can iterate over it etc).
+	 * The days in transit of the packets are brought up to date first.
 	 * @return pointer to the packet list
 	 */
 	const CargoList::List *Packets() const;
@@ -115,6 +130,12 @@ public:
 	 */
 	void AgeCargo();
 
+	/**
+	 * Brings the days in transit stored in the packets up to date
+	 * with the aging of this list, e.g. before they get saved.
+	 */
+	void UpdatePacketAges() const;
+
 	/**
 	 * Checks whether this list is empty
 	 * @return true if and only if the list is empty
@@ -186,7 +207,10 @@ public:
 	 */
 	bool MoveTo(CargoList *dest, uint count, CargoList::MoveToAction mta = MTA_OTHER, uint data = 0);
 
-	/** Invalidates the cached data and rebuild it */
+	/**
+	 * Invalidates the cached data and rebuild it.
+	 * Only needed after the packets have been changed directly.
+	 */
 	void InvalidateCache();
 };
 
@@ -18,6 +18,7 @@
 #include "economy_func.h"
 #include "viewport_func.h"
 #include "settings_type.h"
+#include "core/random_func.hpp"
 
 #include "table/strings.h"
 #include "table/sprites.h"
@@ -272,29 +273,30 @@ static void TileLoop_Clear(TileIndex tile)
 	MarkTileDirtyByTile(tile);
 }
 
-void GenerateClearTile()
+/** Amounts of rough and rocky areas to make for GenerateClearTile */
+struct ClearTileAmounts {
+	uint rough; ///< number of tries to make a tile rough
+	uint rocky; ///< number of rocky areas to try to make
+};
+
+/** The part of GenerateClearTile for one region of the map */
+static void GenerateClearTileInRegion(uint region, Randomizer &rnd, void *data)
 {
-	uint i, gi;
+	const ClearTileAmounts *amounts = (const ClearTileAmounts*)data;
+	uint i;
 	TileIndex tile;
 
 	/* add rough tiles */
-	i = ScaleByMapSize(GB(Random(), 0, 10) + 0x400);
-	gi = ScaleByMapSize(GB(Random(), 0, 7) + 0x80);
-
-	SetGeneratingWorldProgress(GWP_ROUGH_ROCKY, gi + i);
-	do {
-		IncreaseGeneratingWorldProgress(GWP_ROUGH_ROCKY);
-		tile = RandomTile();
+	for (i = GetGenerateWorldRegionShare(amounts->rough, region); i != 0; i--) {
+		tile = RandomTileInRegionSeed(region, rnd.Next());
 		if (IsTileType(tile, MP_CLEAR) && !IsClearGround(tile, CLEAR_DESERT)) SetClearGroundDensity(tile, CLEAR_ROUGH, 3);
-	} while (--i);
+	}
 
 	/* add rocky tiles */
-	i = gi;
-	do {
-		uint32 r = Random();
-		tile = RandomTileSeed(r);
+	for (i = GetGenerateWorldRegionShare(amounts->rocky, region); i != 0; i--) {
+		uint32 r = rnd.Next();
+		tile = RandomTileInRegionSeed(region, r);
 
-		IncreaseGeneratingWorldProgress(GWP_ROUGH_ROCKY);
 		if (IsTileType(tile, MP_CLEAR) && !IsClearGround(tile, CLEAR_DESERT)) {
 			uint j = GB(r, 16, 4) + 5;
 			for (;;) {
@@ -303,13 +305,26 @@ void GenerateClearTile()
 				SetClearGroundDensity(tile, CLEAR_ROCKS, 3);
 				do {
 					if (--j == 0) goto get_out;
-					tile_new = tile + TileOffsByDiagDir((DiagDirection)GB(Random(), 0, 2));
+					tile_new = tile + TileOffsByDiagDir((DiagDirection)GB(rnd.Next(), 0, 2));
 				} while (!IsTileType(tile_new, MP_CLEAR) || IsClearGround(tile_new, CLEAR_DESERT));
 				tile = tile_new;
 			}
 get_out:;
 		}
-	} while (--i);
+	}
+}
+
+void GenerateClearTile()
+{
+	ClearTileAmounts amounts;
+
+	amounts.rough = ScaleByMapSize(GB(Random(), 0, 10) + 0x400);
+	amounts.rocky = ScaleByMapSize(GB(Random(), 0, 7) + 0x80);
+
+	/* The rocky areas are at most 20 tiles long, so the regions can be
+	 * done at the same time */
+	SetGeneratingWorldProgress(GWP_ROUGH_ROCKY, 2);
+	GenerateWorldInRegions(GWP_ROUGH_ROCKY, &GenerateClearTileInRegion, &amounts);
 }
 
 static void ClickTile_Clear(TileIndex tile)
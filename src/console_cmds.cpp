@@ -14,12 +14,14 @@
 #include "network/network_client.h"
 #include "network/network_server.h"
 #include "network/network_udp.h"
+#include "network/network_replay.h"
 #include "command_func.h"
 #include "settings_func.h"
 #include "ai/ai.h"
 #include "fios.h"
 #include "fileio.h"
 #include "station.h"
+#include "cargopacket.h"
 #include "screenshot.h"
 #include "genworld.h"
 #include "network/network.h"
@@ -29,6 +31,7 @@
 #include "functions.h"
 #include "map_func.h"
 #include "date_func.h"
+#include "gfx_func.h"
 #include "vehicle_base.h"
 #include "vehicle_func.h"
 #include "string_func.h"
@@ -156,6 +159,115 @@ DEF_CONSOLE_CMD(ConStopAllVehicles)
 	StopAllVehicles();
 	return true;
 }
+
+DEF_CONSOLE_CMD(ConBenchmarkCargo)
+{
+	if (argc == 0) {
+		IConsoleHelp("Measure loading and unloading of cargo at a station with many cargo packets. Usage: 'bench_cargo [<packets>] [<rounds>]'");
+		IConsoleHelp("Each round loads all cargo in vehicle sized chunks and unloads it again. Defaults: 20000 packets, 10 rounds");
+		return true;
+	}
+
+	if (argc > 3) return false;
+
+	uint32 num_packets = 20000;
+	uint32 rounds = 10;
+	if (argc > 1 && !GetArgumentInteger(&num_packets, argv[1])) return false;
+	if (argc > 2 && !GetArgumentInteger(&rounds, argv[2])) return false;
+
+	extern uint64 _rdtsc();
+
+	/* Amount of cargo moved at once, like a vehicle would */
+	static const uint CHUNK = 250;
+	CargoList station, vehicle;
+
+	/* Fill the 'station'; each packet gets a different source so nothing gets merged */
+	for (uint i = 0; i < num_packets; i++) {
+		CargoPacket *cp = new CargoPacket();
+		if (cp == NULL) {
+			IConsoleError("Not enough cargo packets available");
+			break;
+		}
+
+		cp->source_xy = i;
+		cp->count     = 1 + i % 50;
+
+		CargoList single;
+		single.Append(cp);
+		single.MoveTo(&station, cp->count);
+	}
+
+	uint packets = (uint)station.Packets()->size();
+	uint total = station.Count();
+	uint64 load = 0;
+	uint64 unload = 0;
+
+	for (uint r = 0; r < rounds; r++) {
+		uint64 start = _rdtsc();
+		while (station.MoveTo(&vehicle, CHUNK, CargoList::MTA_CARGO_LOAD, 0)) {}
+		uint64 middle = _rdtsc();
+		while (vehicle.MoveTo(&station, CHUNK)) {}
+		uint64 end = _rdtsc();
+
+		load   += middle - start;
+		unload += end - middle;
+	}
+
+	IConsolePrintF(_icolour_def, "%u packets, %u cargo, %u rounds", packets, total, rounds);
+	if (total != 0 && rounds != 0) {
+		IConsolePrintF(_icolour_def, "load:   %" OTTD_PRINTF64 "u cycles, %" OTTD_PRINTF64 "u per cargo entity", load, load / ((uint64)total * rounds));
+		IConsolePrintF(_icolour_def, "unload: %" OTTD_PRINTF64 "u cycles, %" OTTD_PRINTF64 "u per cargo entity", unload, unload / ((uint64)total * rounds));
+	}
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConBenchmarkHeadless)
+{
+	if (argc == 0) {
+		IConsoleHelp("Measure the game loop on the current map with and without marking things dirty for the screen. Usage: 'bench_headless [<ticks>]'");
+		IConsoleHelp("Runs the ticks as if something were drawn, then the same amount headless. The game advances by twice the ticks. Default: 740 ticks");
+		return true;
+	}
+
+	if (argc > 2) return false;
+
+	uint32 ticks = 740;
+	if (argc > 1 && !GetArgumentInteger(&ticks, argv[1])) return false;
+
+	if (_networking) {
+		IConsoleError("Running game ticks on your own would desync the network game");
+		return true;
+	}
+	if (_pause_game) {
+		IConsoleError("Nothing happens while the game is paused");
+		return true;
+	}
+
+	extern uint64 _rdtsc();
+	extern void StateGameLoop();
+
+	bool headless = _screen_headless;
+	uint64 cycles[2];
+
+	for (uint i = 0; i < 2; i++) {
+		_screen_headless = (i == 1);
+
+		uint64 start = _rdtsc();
+		for (uint t = 0; t < ticks; t++) StateGameLoop();
+		cycles[i] = _rdtsc() - start;
+	}
+
+	_screen_headless = headless;
+	/* Whatever was skipped while headless still has to be drawn */
+	MarkWholeScreenDirty();
+
+	IConsolePrintF(_icolour_def, "%u ticks on a %ux%u map", ticks, MapSizeX(), MapSizeY());
+	if (ticks != 0) {
+		IConsolePrintF(_icolour_def, "drawn:    %" OTTD_PRINTF64 "u cycles, %" OTTD_PRINTF64 "u per tick", cycles[0], cycles[0] / ticks);
+		IConsolePrintF(_icolour_def, "headless: %" OTTD_PRINTF64 "u cycles, %" OTTD_PRINTF64 "u per tick", cycles[1], cycles[1] / ticks);
+	}
+	return true;
+}
 #endif /* _DEBUG */
 
 DEF_CONSOLE_CMD(ConScrollToTile)
@@ -790,6 +902,58 @@ DEF_CONSOLE_CMD(ConNetworkClients)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConReplayRecord)
+{
+	if (argc == 0) {
+		IConsoleHelp("Record the current game and all executed commands to a replay. Usage: 'replay_record <filename>'");
+		return true;
+	}
+
+	if (argc != 2) return false;
+
+	if (!NetworkReplayStartRecording(argv[1])) {
+		IConsolePrintF(_icolour_err, "Could not start recording to '%s'", argv[1]);
+		return true;
+	}
+
+	IConsolePrintF(_icolour_def, "Recording replay to '%s'", argv[1]);
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConReplayStop)
+{
+	if (argc == 0) {
+		IConsoleHelp("Stop recording the replay. Usage: 'replay_stop'");
+		return true;
+	}
+
+	if (!NetworkReplayIsRecording()) {
+		IConsoleError("Not recording a replay.");
+		return true;
+	}
+
+	NetworkReplayStopRecording();
+	IConsolePrint(_icolour_def, "Replay recording stopped.");
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConReplayPlay)
+{
+	if (argc == 0) {
+		IConsoleHelp("Play a replay at full speed and verify it stays in sync. Usage: 'replay_play <filename>'");
+		return true;
+	}
+
+	if (argc != 2) return false;
+
+	if (NetworkReplayPlay(argv[1])) {
+		IConsolePrint(_icolour_def, "Replay finished in sync.");
+	} else {
+		IConsolePrint(_icolour_err, "Replay failed; see the debug output for details.");
+	}
+	return true;
+}
+
 DEF_CONSOLE_CMD(ConNetworkConnect)
 {
 	char *ip;
@@ -1066,6 +1230,47 @@ DEF_CONSOLE_CMD(ConScreenShot)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConExportMap)
+{
+	static const char * const types[] = { "contours", "vehicles", "industries", "routes", "vegetation", "owners" };
+
+	if (argc == 0) {
+		IConsoleHelp("Export the map as the small map shows it, one pixel per tile. Usage: 'exportmap [<type>] [file name]'");
+		IConsoleHelp("Type is one of 'contours', 'vehicles', 'industries', 'routes', 'vegetation' or 'owners', default is 'contours'. "
+				"The image is written in the background and works on dedicated servers too.");
+		return true;
+	}
+
+	if (argc > 3) return false;
+
+	int type = 0;
+	const char *name = NULL;
+
+	if (argc > 1) {
+		for (type = 0; type != lengthof(types); type++) {
+			if (strcmp(argv[1], types[type]) == 0) break;
+		}
+
+		if (type != lengthof(types)) {
+			/* exportmap type [filename] */
+			if (argc > 2) name = argv[2];
+		} else if (argc == 2) {
+			/* exportmap filename */
+			type = 0;
+			name = argv[1];
+		} else {
+			/* exportmap argv[1] argv[2] - invalid */
+			return false;
+		}
+	}
+
+	if (!MakeMapExport(type, name)) {
+		IConsoleError("A map export is still in progress");
+		return true;
+	}
+	return true;
+}
+
 DEF_CONSOLE_CMD(ConInfoVar)
 {
 	static const char *_icon_vartypes[] = {"boolean", "byte", "uint16", "uint32", "int16", "int32", "string"};
@@ -1578,6 +1783,8 @@ static void IConsoleDebugLibRegister()
 	IConsoleVarRegister("con_developer",    &_stdlib_con_developer, ICONSOLE_VAR_BOOLEAN, "Enable/disable console debugging information (internal)");
 	IConsoleCmdRegister("resettile",        ConResetTile);
 	IConsoleCmdRegister("stopall",          ConStopAllVehicles);
+	IConsoleCmdRegister("bench_cargo",      ConBenchmarkCargo);
+	IConsoleCmdRegister("bench_headless",   ConBenchmarkHeadless);
 	IConsoleAliasRegister("dbg_echo",       "echo %A; echo %B");
 	IConsoleAliasRegister("dbg_echo2",      "echo %!");
 }
@@ -1615,6 +1822,7 @@ void IConsoleStdLibRegister()
 	IConsoleCmdRegister("resetengines", ConResetEngines);
 	IConsoleCmdRegister("return",       ConReturn);
 	IConsoleCmdRegister("screenshot",   ConScreenShot);
+	IConsoleCmdRegister("exportmap",    ConExportMap);
 	IConsoleCmdRegister("script",       ConScript);
 	IConsoleCmdRegister("scrollto",     ConScrollToTile);
 	IConsoleCmdRegister("alias",        ConAlias);
@@ -1674,6 +1882,12 @@ void IConsoleStdLibRegister()
 	IConsoleCmdRegister("rcon",            ConRcon);
 	IConsoleCmdHookAdd("rcon",             ICONSOLE_HOOK_ACCESS, ConHookNeedNetwork);
 
+	IConsoleCmdRegister("replay_record",   ConReplayRecord);
+	IConsoleCmdHookAdd("replay_record",    ICONSOLE_HOOK_ACCESS, ConHookNeedNetwork);
+	IConsoleCmdRegister("replay_stop",     ConReplayStop);
+	IConsoleCmdRegister("replay_play",     ConReplayPlay);
+	IConsoleCmdHookAdd("replay_play",      ICONSOLE_HOOK_ACCESS, ConHookNoNetwork);
+
 	IConsoleCmdRegister("reset_company",   ConResetCompany);
 	IConsoleCmdHookAdd("reset_company",    ICONSOLE_HOOK_ACCESS, ConHookServerOnly);
 	IConsoleAliasRegister("clean_company", "reset_company %A");
@@ -412,7 +412,9 @@ void ChangeOwnershipOfPlayerItems(PlayerID old_player, PlayerID new_player)
 						}
 					}
 				} else {
+					RemoveVehicleFromPlayerVehicles(v);
 					v->owner = new_player;
+					AddVehicleToPlayerVehicles(v);
 					v->colormap = PAL_NONE;
 					v->group_id = DEFAULT_GROUP;
 					if (IsEngineCountable(v)) GetPlayer(new_player)->num_engines[v->engine_type]++;
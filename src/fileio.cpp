@@ -19,6 +19,14 @@
 #endif
 #include <sys/stat.h>
 
+#if defined(WIN32) && !defined(WINCE)
+#include <io.h>
+#define FIO_MMAP
+#elif defined(UNIX) && !defined(__BEOS__) && !defined(__MORPHOS__) && !defined(__OS2__)
+#include <sys/mman.h>
+#define FIO_MMAP
+#endif
+
 #include "safeguards.h"
 
 /*************************************************/
@@ -36,6 +44,9 @@ struct Fio {
 	byte buffer_start[FIO_BUFFER_SIZE];    ///< local buffer when read from file
 	const char *filenames[MAX_FILE_SLOTS]; ///< array of filenames we (should) have open
 	char *shortnames[MAX_FILE_SLOTS];///< array of short names for spriteloader's use
+	byte *cur_map;                         ///< memory mapped contents of the current file, or NULL when it is read through the buffer
+	byte *maps[MAX_FILE_SLOTS];            ///< memory mapped contents of the files, or NULL when they could not be mapped
+	size_t map_sizes[MAX_FILE_SLOTS];      ///< sizes of the memory mapped files
 #if defined(LIMITED_FDS)
 	uint open_handles;                     ///< current amount of open handles
 	uint usage_count[MAX_FILE_SLOTS];      ///< count how many times this file has been opened
@@ -47,6 +58,7 @@ static Fio _fio;
 /* Get current position in file */
 uint32 FioGetPos()
 {
+	if (_fio.cur_map != NULL) return _fio.buffer - _fio.cur_map;
 	return _fio.pos + (_fio.buffer - _fio.buffer_start) - FIO_BUFFER_SIZE;
 }
 
@@ -55,9 +67,38 @@ const char *FioGetFilename(uint8 slot)
 	return _fio.shortnames[slot];
 }
 
+/**
+ * Get the name a file slot was opened with, so the same file can be opened
+ * again with FioFOpenFile, e.g. to read it on another thread.
+ * @param slot the file slot
+ * @return the name of the file in the slot
+ */
+const char *FioGetOpenedFilename(uint8 slot)
+{
+	return _fio.filenames[slot];
+}
+
+/**
+ * Get the memory mapped contents of the file in a slot. The contents do
+ * not change until the slot is closed, so they may be read by several
+ * threads at once; positions are the same as for FioSeekToFile.
+ * @param slot the file slot
+ * @param size the size of the mapped file is written here
+ * @return the contents of the file, or NULL when it is not memory mapped
+ */
+const byte *FioGetMappedFile(uint8 slot, size_t *size)
+{
+	*size = _fio.map_sizes[slot];
+	return _fio.maps[slot];
+}
+
 void FioSeekTo(uint32 pos, int mode)
 {
 	if (mode == SEEK_CUR) pos += FioGetPos();
+	if (_fio.cur_map != NULL) {
+		_fio.buffer = _fio.cur_map + min((size_t)pos, (size_t)(_fio.buffer_end - _fio.cur_map));
+		return;
+	}
 	_fio.buffer = _fio.buffer_end = _fio.buffer_start + FIO_BUFFER_SIZE;
 	_fio.pos = pos;
 	fseek(_fio.cur_fh, _fio.pos, SEEK_SET);
@@ -87,12 +128,16 @@ void FioSeekToFile(uint8 slot, uint32 pos)
 	assert(f != NULL);
 	_fio.cur_fh = f;
 	_fio.filename = _fio.filenames[slot];
+	_fio.cur_map = _fio.maps[slot];
+	if (_fio.cur_map != NULL) _fio.buffer_end = _fio.maps[slot] + _fio.map_sizes[slot];
 	FioSeekTo(pos, SEEK_SET);
 }
 
 byte FioReadByte()
 {
 	if (_fio.buffer == _fio.buffer_end) {
+		/* Reading past the end of a mapped file */
+		if (_fio.cur_map != NULL) return 0;
 		_fio.pos += FIO_BUFFER_SIZE;
 		fread(_fio.buffer = _fio.buffer_start, 1, FIO_BUFFER_SIZE, _fio.cur_fh);
 	}
@@ -125,14 +170,81 @@ uint32 FioReadDword()
 
 void FioReadBlock(void *ptr, uint size)
 {
+	if (_fio.cur_map != NULL) {
+		uint n = min(size, (uint)(_fio.buffer_end - _fio.buffer));
+		memcpy(ptr, _fio.buffer, n);
+		_fio.buffer += n;
+		return;
+	}
+
 	FioSeekTo(FioGetPos(), SEEK_SET);
 	_fio.pos += size;
 	fread(ptr, 1, size, _fio.cur_fh);
 }
 
+/**
+ * Map the contents of the file in a slot into memory, so reading it does
+ * not need any system calls. Files inside tars are mapped completely, so
+ * positions stay the same as in the file handle.
+ * @param slot the file slot
+ */
+static void FioMapFile(int slot)
+{
+	_fio.maps[slot] = NULL;
+	_fio.map_sizes[slot] = 0;
+
+#if defined(FIO_MMAP) && defined(WIN32)
+	HANDLE file = (HANDLE)_get_osfhandle(_fileno(_fio.handles[slot]));
+	DWORD size = GetFileSize(file, NULL);
+	if (size == INVALID_FILE_SIZE || size == 0) return;
+
+	HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL) return;
+	void *map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	/* The view keeps the mapping alive */
+	CloseHandle(mapping);
+	if (map == NULL) return;
+#elif defined(FIO_MMAP)
+	struct stat st;
+	if (fstat(fileno(_fio.handles[slot]), &st) != 0 || st.st_size == 0) return;
+
+	size_t size = st.st_size;
+	void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(_fio.handles[slot]), 0);
+	if (map == MAP_FAILED) return;
+#else
+	/* Reading through the buffer is all we can do */
+	return;
+#endif
+
+#if defined(FIO_MMAP)
+	_fio.maps[slot] = (byte*)map;
+	_fio.map_sizes[slot] = size;
+#endif /* FIO_MMAP */
+}
+
+/**
+ * Remove the mapping made by FioMapFile.
+ * @param slot the file slot
+ */
+static void FioUnmapFile(int slot)
+{
+	if (_fio.maps[slot] == NULL) return;
+	if (_fio.cur_map == _fio.maps[slot]) _fio.cur_map = NULL;
+
+#if defined(FIO_MMAP) && defined(WIN32)
+	UnmapViewOfFile(_fio.maps[slot]);
+#elif defined(FIO_MMAP)
+	munmap(_fio.maps[slot], _fio.map_sizes[slot]);
+#endif
+
+	_fio.maps[slot] = NULL;
+	_fio.map_sizes[slot] = 0;
+}
+
 static inline void FioCloseFile(int slot)
 {
 	if (_fio.handles[slot] != NULL) {
+		FioUnmapFile(slot);
 		fclose(_fio.handles[slot]);
 
 		free(_fio.shortnames[slot]);
@@ -191,6 +303,7 @@ void FioOpenFile(int slot, const char *filename)
 	FioCloseFile(slot); // if file was opened before, close it
 	_fio.handles[slot] = f;
 	_fio.filenames[slot] = filename;
+	FioMapFile(slot);
 
 	/* Store the filename without path and extension */
 	const char *t = strrchr(filename, PATHSEPCHAR);
@@ -214,7 +327,8 @@ const char *_subdirs[NUM_SUBDIRS] = {
 	"scenario" PATHSEP "heightmap" PATHSEP,
 	"gm" PATHSEP,
 	"data" PATHSEP,
-	"lang" PATHSEP
+	"lang" PATHSEP,
+	"cache" PATHSEP,
 };
 
 const char *_searchpaths[NUM_SEARCHPATHS];
@@ -374,6 +488,27 @@ FILE *FioFOpenFile(const char *filename, const char *mode, Subdirectory subdir,
 	return f;
 }
 
+/**
+ * Get the size and last modification time of a file.
+ * @param filename the full path of the file
+ * @param size     the size of the file is written here
+ * @param mtime    the modification time of the file is written here
+ * @return true if the file exists and its details could be read
+ */
+bool FioGetFileStat(const char *filename, size_t *size, time_t *mtime)
+{
+#if defined(WIN32) && defined(UNICODE)
+	struct _stat sb;
+	if (_wstat(OTTD2FS(filename), &sb) != 0) return false;
+#else
+	struct stat sb;
+	if (stat(OTTD2FS(filename), &sb) != 0) return false;
+#endif
+	*size  = sb.st_size;
+	*mtime = sb.st_mtime;
+	return true;
+}
+
 /**
  * Create a directory with the given name
  * @param name the new name of the directory
@@ -773,7 +908,7 @@ void DeterminePaths(const char *exe)
 #endif
 
 	static const Subdirectory default_subdirs[] = {
-		SAVE_DIR, AUTOSAVE_DIR
+		SAVE_DIR, AUTOSAVE_DIR, CACHE_DIR
 	};
 
 	for (uint i = 0; i < lengthof(default_subdirs); i++) {
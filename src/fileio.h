@@ -13,6 +13,8 @@ void FioSeekTo(uint32 pos, int mode);
 void FioSeekToFile(uint8 slot, uint32 pos);
 uint32 FioGetPos();
 const char *FioGetFilename(uint8 slot);
+const char *FioGetOpenedFilename(uint8 slot);
+const byte *FioGetMappedFile(uint8 slot, size_t *size);
 byte FioReadByte();
 uint16 FioReadWord();
 uint32 FioReadDword();
@@ -34,6 +36,7 @@ enum Subdirectory {
 	GM_DIR,        ///< Subdirectory for all music
 	DATA_DIR,      ///< Subdirectory for all data (GRFs, sample.cat, intro game)
 	LANG_DIR,      ///< Subdirectory for all translation files
+	CACHE_DIR,     ///< Subdirectory for regenerable caches (NewGRF indices, ...)
 	NUM_SUBDIRS,   ///< Number of subdirectories
 	NO_DIRECTORY,  ///< A path without any base directory
 };
@@ -100,6 +103,7 @@ FILE *FioTarFileList(const char *tar, const char *mode, size_t *filesize, FioTar
 void FioFCloseFile(FILE *f);
 FILE *FioFOpenFile(const char *filename, const char *mode = "rb", Subdirectory subdir = DATA_DIR, size_t *filesize = NULL);
 bool FioCheckFileExists(const char *filename, Subdirectory subdir = DATA_DIR);
+bool FioGetFileStat(const char *filename, size_t *size, time_t *mtime);
 char *FioGetFullPath(char *buf, size_t buflen, Searchpath sp, Subdirectory subdir, const char *filename);
 char *FioFindFullPath(char *buf, size_t buflen, Subdirectory subdir, const char *filename);
 char *FioAppendDirectory(char *buf, size_t buflen, Searchpath sp, Subdirectory subdir);
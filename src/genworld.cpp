@@ -21,6 +21,7 @@
 #include "map_func.h"
 #include "date_func.h"
 #include "core/random_func.hpp"
+#include "core/bitmath_func.hpp"
 #include "engine.h"
 #include "settings_type.h"
 #include "newgrf_storage.h"
@@ -28,6 +29,12 @@
 
 #include "table/sprites.h"
 
+#if defined(UNIX) || defined(__OS2__) || defined(PSP)
+#include <sys/time.h> /* gettimeofday */
+#else
+#include <time.h>
+#endif
+
 #include "safeguards.h"
 
 void GenerateClearTile();
@@ -48,6 +55,176 @@ void InitializeGame(int mode, uint size_x, uint size_y);
  *  in the genworld.h and genworld.c! -- TrueLight */
 gw_info _gw;
 
+/** Names of the generation phases for the debug output */
+static const char * const _gw_phase_names[GWP_CLASS_COUNT] = {
+	"map init",
+	"landscape",
+	"rough and rocky",
+	"towns",
+	"industries",
+	"unmovables",
+	"trees",
+	"game init",
+	"tile loop",
+	"game start",
+};
+
+static uint32 _gw_start_time;                  ///< When the generation started
+static uint32 _gw_phase_start_time;            ///< When the current generation phase started
+static uint32 _gw_last_phase_time;             ///< How long the last finished phase took, in milliseconds
+static uint32 _gw_phase_time[GWP_CLASS_COUNT]; ///< How long each phase took, in milliseconds
+
+/** Get the wall clock time in milliseconds, for timing the generation phases. */
+static uint32 GetGenerateWorldClock()
+{
+#if defined(UNIX) || defined(__OS2__) || defined(PSP)
+	struct timeval tim;
+
+	gettimeofday(&tim, NULL);
+	return tim.tv_usec / 1000 + tim.tv_sec * 1000;
+#else
+	/* On Windows clock() measures the wall clock time too */
+	return (uint32)((uint64)clock() * 1000 / CLOCKS_PER_SEC);
+#endif
+}
+
+/** Start timing the generation phases. */
+static void StartGenerateWorldTiming()
+{
+	_gw_start_time = _gw_phase_start_time = GetGenerateWorldClock();
+	_gw_last_phase_time = 0;
+	memset(_gw_phase_time, 0, sizeof(_gw_phase_time));
+}
+
+/**
+ * Mark the end of a generation phase; the time since the end of the
+ * previous phase is accounted to it.
+ * @param cls the phase that has ended
+ */
+static void EndGenerateWorldPhase(gwp_class cls)
+{
+	uint32 now = GetGenerateWorldClock();
+
+	_gw_last_phase_time = now - _gw_phase_start_time;
+	_gw_phase_time[cls] += _gw_last_phase_time;
+	_gw_phase_start_time = now;
+
+	DEBUG(misc, 2, "Map generation phase '%s' took %u ms", _gw_phase_names[cls], _gw_last_phase_time);
+}
+
+/** Write how long the generation and each of its phases took to the debug output. */
+static void ShowGenerateWorldTiming()
+{
+	DEBUG(misc, 1, "Map generation took %u ms", GetGeneratingWorldTime());
+	for (uint i = 0; i < GWP_CLASS_COUNT; i++) {
+		if (_gw_phase_time[i] == 0) continue;
+		DEBUG(misc, 1, "  %-16s %6u ms", _gw_phase_names[i], _gw_phase_time[i]);
+	}
+}
+
+/**
+ * Get the time since the generation started.
+ * @return the time in milliseconds
+ */
+uint GetGeneratingWorldTime()
+{
+	return GetGenerateWorldClock() - _gw_start_time;
+}
+
+/**
+ * Get the time the last finished generation phase took.
+ * @return the time in milliseconds
+ */
+uint GetGeneratingWorldLastPhaseTime()
+{
+	return _gw_last_phase_time;
+}
+
+/** Maximum number of regions GenerateWorldInRegions cuts the largest possible map into */
+static const uint GW_MAX_REGIONS = 2048 >> GW_REGION_BITS;
+
+/** The shared data of the threads of GenerateWorldInRegions */
+struct GenerateRegionsInfo {
+	gw_region_proc *proc;          ///< function generating one region
+	void *data;                    ///< data to pass to that function
+	uint32 seeds[GW_MAX_REGIONS];  ///< seed of the random generator of each region
+	uint parity;                   ///< whether the even (0) or odd (1) regions are generated
+};
+
+/** Get the number of regions GenerateWorldInRegions cuts the map into. */
+static uint GetGenerateWorldRegionCount()
+{
+	return max(MapSizeY() >> GW_REGION_BITS, 1U);
+}
+
+/** Generate the regions [first, last) of the current parity. */
+static void GenerateRegions(uint first, uint last, void *data)
+{
+	const GenerateRegionsInfo *info = (const GenerateRegionsInfo*)data;
+	Randomizer r;
+
+	for (uint i = first; i < last; i++) {
+		uint region = 2 * i + info->parity;
+		r.SetSeed(info->seeds[region]);
+		info->proc(region, r, info->data);
+	}
+}
+
+/**
+ * Run a part of the generation on all regions of the map, using as many
+ * threads as there are processors. The regions are bands of rows of the
+ * map; all even regions are done at the same time, then all odd ones. So
+ * two regions that are done at the same time are a whole region apart, and
+ * the threads do not get in each others way as long as proc does not touch
+ * tiles more than half a region away from its own. Every region gets its
+ * own random generator, seeded by Random(), so the result is the same for
+ * any number of threads.
+ * The progress of the class is increased after the even and the odd regions.
+ * @param cls  the generation class of this part of the generation
+ * @param proc the function generating one region
+ * @param data the data to pass to proc
+ */
+void GenerateWorldInRegions(gwp_class cls, gw_region_proc *proc, void *data)
+{
+	uint count = GetGenerateWorldRegionCount();
+	assert(count <= GW_MAX_REGIONS);
+
+	GenerateRegionsInfo info;
+	info.proc = proc;
+	info.data = data;
+	for (uint i = 0; i < count; i++) info.seeds[i] = Random();
+
+	for (info.parity = 0; info.parity < 2; info.parity++) {
+		OTTDParallelFor(0, (count + 1 - info.parity) / 2, &GenerateRegions, &info);
+		IncreaseGeneratingWorldProgress(cls);
+	}
+}
+
+/**
+ * Get the part of an amount that is for a region of GenerateWorldInRegions.
+ * @param total  the amount for the whole map
+ * @param region the region
+ * @return the amount for the region
+ */
+uint GetGenerateWorldRegionShare(uint total, uint region)
+{
+	uint count = GetGenerateWorldRegionCount();
+	return total / count + (region < total % count ? 1 : 0);
+}
+
+/**
+ * Get a random tile within a region of GenerateWorldInRegions, using the
+ * same bits of the random value as RandomTileSeed does.
+ * @param region the region to get the tile in
+ * @param r      the random value
+ * @return a tile in the region
+ */
+TileIndex RandomTileInRegionSeed(uint region, uint32 r)
+{
+	uint rows_log = min(MapLogY(), GW_REGION_BITS);
+	return TileXY(0, region << rows_log) + GB(r, 0, MapLogX() + rows_log);
+}
+
 /**
  * Set the status of the Paint flag.
  *  If it is true, the thread will hold with any futher generating till
@@ -99,6 +276,7 @@ static void *_GenerateWorld(void *arg)
 	IncreaseGeneratingWorldProgress(GWP_MAP_INIT);
 	/* Must start economy early because of the costs. */
 	StartupEconomy();
+	EndGenerateWorldPhase(GWP_MAP_INIT);
 
 	/* Don't generate landscape items when in the scenario editor. */
 	if (_gw.mode == GW_EMPTY) {
@@ -109,16 +287,23 @@ static void *_GenerateWorld(void *arg)
 
 		ConvertGroundTilesIntoWaterTiles();
 		IncreaseGeneratingWorldProgress(GWP_UNMOVABLE);
+		EndGenerateWorldPhase(GWP_UNMOVABLE);
 	} else {
 		GenerateLandscape(_gw.mode);
+		EndGenerateWorldPhase(GWP_LANDSCAPE);
 		GenerateClearTile();
+		EndGenerateWorldPhase(GWP_ROUGH_ROCKY);
 
 		/* only generate towns, tree and industries in newgame mode. */
 		if (_game_mode != GM_EDITOR) {
 			GenerateTowns();
+			EndGenerateWorldPhase(GWP_TOWN);
 			GenerateIndustries();
+			EndGenerateWorldPhase(GWP_INDUSTRY);
 			GenerateUnmovables();
+			EndGenerateWorldPhase(GWP_UNMOVABLE);
 			GenerateTrees();
+			EndGenerateWorldPhase(GWP_TREE);
 		}
 	}
 
@@ -132,6 +317,7 @@ static void *_GenerateWorld(void *arg)
 	IncreaseGeneratingWorldProgress(GWP_GAME_INIT);
 	StartupDisasters();
 	_generating_world = false;
+	EndGenerateWorldPhase(GWP_GAME_INIT);
 
 	/* No need to run the tile loop in the scenario editor. */
 	if (_gw.mode != GW_EMPTY) {
@@ -142,6 +328,7 @@ static void *_GenerateWorld(void *arg)
 			RunTileLoop();
 			IncreaseGeneratingWorldProgress(GWP_RUNTILELOOP);
 		}
+		EndGenerateWorldPhase(GWP_RUNTILELOOP);
 	}
 
 	ResetObjectToPlace();
@@ -151,6 +338,8 @@ static void *_GenerateWorld(void *arg)
 	/* Call any callback */
 	if (_gw.proc != NULL) _gw.proc();
 	IncreaseGeneratingWorldProgress(GWP_GAME_START);
+	EndGenerateWorldPhase(GWP_GAME_START);
+	ShowGenerateWorldTiming();
 
 	if (_cursor.sprite == SPR_CURSOR_ZZZ) SetMouseCursor(SPR_CURSOR_MOUSE, PAL_NONE);
 	/* Show all vital windows again, because we have hidden them */
@@ -276,6 +465,7 @@ void GenerateWorld(int mode, uint size_x, uint size_y)
 
 	InitializeGame(IG_NONE, _gw.size_x, _gw.size_y);
 	PrepareGenerateWorldProgress();
+	StartGenerateWorldTiming();
 
 	/* Re-init the windowing system */
 	ResetWindowSystem();
@@ -16,6 +16,7 @@
 #endif
 
 #include "player_type.h"
+#include "tile_type.h"
 
 /*
  * Order of these enums has to be the same as in lang/english.txt
@@ -65,6 +66,19 @@ enum gwp_class {
 	GWP_CLASS_COUNT
 };
 
+struct Randomizer;
+
+/**
+ * Function generating a part of the map for GenerateWorldInRegions.
+ * @param region the region of the map to generate
+ * @param r      the random generator to use for this region
+ * @param data   the data passed to GenerateWorldInRegions
+ */
+typedef void gw_region_proc(uint region, Randomizer &r, void *data);
+
+/** The regions of GenerateWorldInRegions are bands of 1 << GW_REGION_BITS rows of the map */
+static const uint GW_REGION_BITS = 6;
+
 /**
  * Check if we are currently in the process of generating a world.
  */
@@ -86,6 +100,11 @@ void GenerateWorld(int mode, uint size_x, uint size_y);
 void AbortGeneratingWorld();
 bool IsGeneratingWorldAborted();
 void HandleGeneratingWorldAbortion();
+void GenerateWorldInRegions(gwp_class cls, gw_region_proc *proc, void *data);
+uint GetGenerateWorldRegionShare(uint total, uint region);
+TileIndex RandomTileInRegionSeed(uint region, uint32 r);
+uint GetGeneratingWorldTime();
+uint GetGeneratingWorldLastPhaseTime();
 
 /* genworld_gui.cpp */
 void SetGeneratingWorldProgress(gwp_class cls, uint total);
@@ -806,8 +806,8 @@ void ShowCreateScenario()
 
 static const Widget _show_terrain_progress_widgets[] = {
 {    WWT_CAPTION,   RESIZE_NONE,    14,     0,   180,     0,    13, STR_GENERATION_WORLD,   STR_018C_WINDOW_TITLE_DRAG_THIS},
-{      WWT_PANEL,   RESIZE_NONE,    14,     0,   180,    14,    96, 0x0,                    STR_NULL},
-{    WWT_TEXTBTN,   RESIZE_NONE,    15,    20,   161,    74,    85, STR_GENERATION_ABORT,   STR_NULL}, // Abort button
+{      WWT_PANEL,   RESIZE_NONE,    14,     0,   180,    14,   108, 0x0,                    STR_NULL},
+{    WWT_TEXTBTN,   RESIZE_NONE,    15,    20,   161,    86,    97, STR_GENERATION_ABORT,   STR_NULL}, // Abort button
 {   WIDGETS_END},
 };
 
@@ -864,13 +864,18 @@ static void ShowTerrainProgressProc(Window* w, WindowEvent* e)
 			SetDParam(1, _tp.total);
 			DrawStringCentered(90, 58, STR_GENERATION_PROGRESS, TC_FROMSTRING);
 
+			/* And how long it is taking */
+			SetDParam(0, GetGeneratingWorldTime());
+			SetDParam(1, GetGeneratingWorldLastPhaseTime());
+			DrawStringCentered(90, 70, STR_GENERATION_TIME, TC_FROMSTRING);
+
 			SetWindowDirty(w);
 			break;
 	}
 }
 
 static const WindowDesc _show_terrain_progress_desc = {
-	WDP_CENTER, WDP_CENTER, 181, 97, 181, 97,
+	WDP_CENTER, WDP_CENTER, 181, 109, 181, 109,
 	WC_GENERATE_PROGRESS_WINDOW, WC_NONE,
 	WDF_DEF_WIDGET | WDF_UNCLICK_BUTTONS,
 	_show_terrain_progress_widgets,
@@ -36,6 +36,7 @@ bool _right_button_down;
 bool _right_button_clicked;
 DrawPixelInfo _screen;
 bool _screen_disable_anim = false;   ///< Disable palette animation (important for 32bpp-anim blitter during giant screenshot)
+bool _screen_headless = false;       ///< Nothing is ever shown on the screen (dedicated server or null video driver), so nothing has to be marked dirty
 bool _exit_game;
 bool _networking;         ///< are we in networking mode?
 byte _game_mode;
@@ -1143,6 +1144,8 @@ void SetDirtyBlocks(int left, int top, int right, int bottom)
 	int width;
 	int height;
 
+	if (_screen_headless) return;
+
 	if (left < 0) left = 0;
 	if (top < 0) top = 0;
 	if (right > _screen.width) right = _screen.width;
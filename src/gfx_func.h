@@ -56,6 +56,7 @@ extern bool _right_button_clicked;
 
 extern DrawPixelInfo _screen;
 extern bool _screen_disable_anim;   ///< Disable palette animation (important for 32bpp-anim blitter during giant screenshot)
+extern bool _screen_headless;       ///< Nothing is ever shown on the screen (dedicated server or null video driver), so nothing has to be marked dirty
 
 extern int _pal_first_dirty;
 extern int _pal_count_dirty;
@@ -255,4 +255,5 @@ void GfxLoadSprites()
 	GfxInitSpriteMem();
 	LoadSpriteTables();
 	GfxInitPalettes();
+	PrewarmSpriteCache();
 }
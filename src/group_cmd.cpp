@@ -259,14 +259,15 @@ CommandCost CmdAddSharedVehicleGroup(TileIndex tile, uint32 flags, uint32 p1, ui
 	if (!IsValidGroupID(p1) || !IsPlayerBuildableVehicleType(type)) return CMD_ERROR;
 
 	if (flags & DC_EXEC) {
-		Vehicle *v;
 		VehicleType type = (VehicleType)p2;
 		GroupID id_g = p1;
 
 		/* Find the first front engine which belong to the group id_g
 		 * then add all shared vehicles of this front engine to the group id_g */
-		FOR_ALL_VEHICLES(v) {
-			if (v->type == type && v->IsPrimaryVehicle()) {
+		const PlayerVehicles &vehicles = GetPlayerVehicles(GetGroup(id_g)->owner, type);
+		for (PlayerVehicles::const_iterator it = vehicles.begin(); it != vehicles.end(); it++) {
+			Vehicle *v = GetVehicle(*it);
+			if (v->IsPrimaryVehicle()) {
 				if (v->group_id != id_g) continue;
 
 				/* For each shared vehicles add it to the group */
@@ -300,11 +301,12 @@ CommandCost CmdRemoveAllVehiclesGroup(TileIndex tile, uint32 flags, uint32 p1, u
 
 	if (flags & DC_EXEC) {
 		GroupID old_g = p1;
-		Vehicle *v;
 
 		/* Find each Vehicle that belongs to the group old_g and add it to the default group */
-		FOR_ALL_VEHICLES(v) {
-			if (v->type == type && v->IsPrimaryVehicle()) {
+		const PlayerVehicles &vehicles = GetPlayerVehicles(g->owner, type);
+		for (PlayerVehicles::const_iterator it = vehicles.begin(); it != vehicles.end(); it++) {
+			const Vehicle *v = GetVehicle(*it);
+			if (v->IsPrimaryVehicle()) {
 				if (v->group_id != old_g) continue;
 
 				/* Add The Vehicle to the default group */
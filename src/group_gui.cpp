@@ -798,8 +798,9 @@ void ShowPlayerGroup(PlayerID player, VehicleType vehicle_type)
 
 	WindowNumber num = (vehicle_type << 11) | VLW_GROUP_LIST | player;
 	DeleteWindowById(wc, num);
-	Window *w = AllocateWindowDescFront(&_group_desc, num);
-	if (w == NULL) return;
-
-	w->window_class = wc;
+	/* The group window shares its layout with all vehicle types, but has to
+	 * be opened with the class of the vehicle list it replaces */
+	WindowDesc desc = _group_desc;
+	desc.cls = wc;
+	AllocateWindowDescFront(&desc, num);
 }
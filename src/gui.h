@@ -92,6 +92,8 @@ void ShowEstimatedCostOrIncome(Money cost, int x, int y);
 void ShowErrorMessage(StringID msg_1, StringID msg_2, int x, int y);
 
 void ShowSmallMap();
+void GetSmallMapColours(byte *buf, int type);
+void InvalidateSmallMapTile(TileIndex tile);
 void ShowExtraViewPortWindow();
 void SetVScrollCount(Window *w, int num);
 void SetVScroll2Count(Window *w, int num);
@@ -34,71 +34,205 @@ static inline byte RGBToGrayscale(byte red, byte green, byte blue)
 }
 
 
-#ifdef WITH_PNG
+/** Defines the detail of the aspect ratio (to avoid doubles) */
+static const uint HEIGHTMAP_NUM_DIV = 16384;
 
-#include <png.h>
+/**
+ * Converts the rows of a grayscale image into tile heights while the image
+ * is being read, so the image itself never has to be kept in memory.
+ * The heights are gathered in a buffer of one byte per tile, which is only
+ * written to the map once the whole image has been read successfully.
+ */
+struct HeightmapConverter {
+	byte *heights;          ///< the new height of each tile, indexed by TileIndex
+	uint img_width;         ///< the width of the image in pixels
+	uint img_height;        ///< the height of the image in pixels
+	uint width;             ///< the width of the (rotated) map in tiles
+	uint height;            ///< the height of the (rotated) map in tiles
+	uint row_pad;           ///< the number of padding rows above and below the image
+	uint img_scale;         ///< the number of tiles per pixel, multiplied by HEIGHTMAP_NUM_DIV
+	int *img_cols;          ///< the image column of each column of the (rotated) map, or -1 for padding
+	bool rgb;               ///< whether the pixels are RGB, otherwise they are palette indices
+	byte gray_palette[256]; ///< the grayscale value of each palette index
+	byte *gray_row;         ///< the row of the image that is being converted, in grayscale
+	byte *row;              ///< a row of the image as it is read from the file
+	byte *image;            ///< the whole image, only used for interlaced PNGs
+
+	HeightmapConverter() : heights(NULL), img_cols(NULL), rgb(false), gray_row(NULL), row(NULL), image(NULL) {}
+
+	~HeightmapConverter()
+	{
+		free(this->heights);
+		free(this->img_cols);
+		free(this->gray_row);
+		free(this->row);
+		free(this->image);
+	}
+
+	void Setup(uint img_width, uint img_height);
+	void ConvertRow(uint img_row, const byte *pixels);
+};
 
 /**
- * The PNG Heightmap loader.
+ * Calculate the scale and padding of an image of the given size and prepare
+ * the height buffer for it.
+ * @param img_width  the with of the image in pixels/tiles
+ * @param img_height the height of the image in pixels/tiles
  */
-static void ReadHeightmapPNGImageData(byte *map, png_structp png_ptr, png_infop info_ptr)
+void HeightmapConverter::Setup(uint img_width, uint img_height)
 {
-	uint x, y;
-	byte gray_palette[256];
-	png_bytep *row_pointers = NULL;
+	uint col_pad = 0;
 
-	/* Get palette and convert it to grayscale */
-	if (png_get_color_type(png_ptr, info_ptr) == PNG_COLOR_TYPE_PALETTE) {
-		int i;
-		int palette_size;
-		png_color *palette;
-		bool all_gray = true;
+	this->img_width  = img_width;
+	this->img_height = img_height;
+	this->row_pad    = 0;
+
+	/* Get map size and calculate scale and padding values */
+	switch (_patches.heightmap_rotation) {
+		default: NOT_REACHED();
+		case HM_COUNTER_CLOCKWISE:
+			this->width  = MapSizeX();
+			this->height = MapSizeY();
+			break;
+		case HM_CLOCKWISE:
+			this->width  = MapSizeY();
+			this->height = MapSizeX();
+			break;
+	}
 
-		png_get_PLTE(png_ptr, info_ptr, &palette, &palette_size);
-		for (i = 0; i < palette_size && (palette_size != 16 || all_gray); i++) {
-			all_gray &= palette[i].red == palette[i].green && palette[i].red == palette[i].blue;
-			gray_palette[i] = RGBToGrayscale(palette[i].red, palette[i].green, palette[i].blue);
+	if ((img_width * HEIGHTMAP_NUM_DIV) / img_height > ((this->width * HEIGHTMAP_NUM_DIV) / this->height)) {
+		/* Image is wider than map - center vertically */
+		this->img_scale = (this->width * HEIGHTMAP_NUM_DIV) / img_width;
+		this->row_pad = (1 + this->height - ((img_height * this->img_scale) / HEIGHTMAP_NUM_DIV)) / 2;
+	} else {
+		/* Image is taller than map - center horizontally */
+		this->img_scale = (this->height * HEIGHTMAP_NUM_DIV) / img_height;
+		col_pad = (1 + this->width - ((img_width * this->img_scale) / HEIGHTMAP_NUM_DIV)) / 2;
+	}
+
+	/* Use nearest neighbor resizing to scale map data.
+	 *  We rotate the map 45 degrees (counter)clockwise */
+	this->img_cols = MallocT<int>(this->width);
+	for (uint col = 0; col < this->width; col++) {
+		if (col < col_pad || col >= this->width - col_pad - 1) {
+			this->img_cols[col] = -1;
+			continue;
 		}
 
-		/**
-		 * For a non-gray palette of size 16 we assume that
-		 * the order of the palette determines the height;
-		 * the first entry is the sea (level 0), the second one
-		 * level 1, etc.
-		 */
-		if (palette_size == 16 && !all_gray) {
-			for (i = 0; i < palette_size; i++) {
-				gray_palette[i] = 256 * i / palette_size;
-			}
+		switch (_patches.heightmap_rotation) {
+			default: NOT_REACHED();
+			case HM_COUNTER_CLOCKWISE:
+				this->img_cols[col] = ((this->width - 1 - col - col_pad) * HEIGHTMAP_NUM_DIV) / this->img_scale;
+				break;
+			case HM_CLOCKWISE:
+				this->img_cols[col] = ((col - col_pad) * HEIGHTMAP_NUM_DIV) / this->img_scale;
+				break;
+		}
+		assert((uint)this->img_cols[col] < img_width);
+	}
+
+	this->gray_row = MallocT<byte>(img_width);
+
+	/* Tiles in the 1-pixel map edge or the padding regions stay at height 0;
+	 * the last row and column of the map are not part of the landscape. */
+	this->heights = MallocT<byte>(MapSize());
+	for (uint y = 0; y < MapSizeY(); y++) {
+		for (uint x = 0; x < MapSizeX(); x++) {
+			TileIndex tile = TileXY(x, y);
+			this->heights[tile] = (x < MapMaxX() && y < MapMaxY()) ? 0 : TileHeight(tile);
 		}
 	}
+}
 
-	row_pointers = png_get_rows(png_ptr, info_ptr);
-
-	/* Read the raw image data and convert in 8-bit grayscale */
-	for (x = 0; x < png_get_image_width(png_ptr, info_ptr); x++) {
-		for (y = 0; y < png_get_image_height(png_ptr, info_ptr); y++) {
-			byte *pixel = &map[y * png_get_image_width(png_ptr, info_ptr) + x];
-			uint x_offset = x * png_get_channels(png_ptr, info_ptr);
-
-			if (png_get_color_type(png_ptr, info_ptr) == PNG_COLOR_TYPE_PALETTE) {
-				*pixel = gray_palette[row_pointers[y][x_offset]];
-			} else if (png_get_channels(png_ptr, info_ptr) == 3) {
-				*pixel = RGBToGrayscale(row_pointers[y][x_offset + 0],
-						row_pointers[y][x_offset + 1], row_pointers[y][x_offset + 2]);
-			} else {
-				*pixel = row_pointers[y][x_offset];
+/**
+ * Convert a row of the image to the heights of the tiles it covers.
+ * @param img_row the row, counted from the top of the image
+ * @param pixels  the pixels of the row, either RGB or palette indices
+ */
+void HeightmapConverter::ConvertRow(uint img_row, const byte *pixels)
+{
+	assert(img_row < this->img_height);
+
+	for (uint x = 0; x < this->img_width; x++) {
+		if (this->rgb) {
+			this->gray_row[x] = RGBToGrayscale(pixels[0], pixels[1], pixels[2]);
+			pixels += 3;
+		} else {
+			this->gray_row[x] = this->gray_palette[*pixels++];
+		}
+	}
+
+	/* The map rows that scale down to this image row */
+	uint first = this->row_pad + (uint)(((uint64)img_row * this->img_scale + HEIGHTMAP_NUM_DIV - 1) / HEIGHTMAP_NUM_DIV);
+	uint last  = this->row_pad + (uint)(((uint64)(img_row + 1) * this->img_scale + HEIGHTMAP_NUM_DIV - 1) / HEIGHTMAP_NUM_DIV);
+	last = min(last, this->height - this->row_pad - 1);
+
+	for (uint row = first; row < last; row++) {
+		for (uint col = 0; col < this->width - 1; col++) {
+			if (this->img_cols[col] < 0) continue;
+
+			TileIndex tile;
+			switch (_patches.heightmap_rotation) {
+				default: NOT_REACHED();
+				case HM_COUNTER_CLOCKWISE: tile = TileXY(col, row); break;
+				case HM_CLOCKWISE:         tile = TileXY(row, col); break;
 			}
+			if (DistanceFromEdge(tile) <= 1) continue;
+
+			/* Color scales from 0 to 255, OpenTTD height scales from 0 to 15 */
+			this->heights[tile] = this->gray_row[this->img_cols[col]] / 16;
+		}
+	}
+}
+
+
+#ifdef WITH_PNG
+
+#include <png.h>
+
+/**
+ * Get the grayscale palette of a PNG heightmap.
+ */
+static void ReadHeightmapPNGPalette(byte *gray_palette, png_structp png_ptr, png_infop info_ptr)
+{
+	int i;
+
+	if (png_get_color_type(png_ptr, info_ptr) != PNG_COLOR_TYPE_PALETTE) {
+		/* Grayscale images are their own palette */
+		for (i = 0; i < 256; i++) gray_palette[i] = i;
+		return;
+	}
+
+	/* Get palette and convert it to grayscale */
+	int palette_size;
+	png_color *palette;
+	bool all_gray = true;
+
+	png_get_PLTE(png_ptr, info_ptr, &palette, &palette_size);
+	for (i = 0; i < palette_size && (palette_size != 16 || all_gray); i++) {
+		all_gray &= palette[i].red == palette[i].green && palette[i].red == palette[i].blue;
+		gray_palette[i] = RGBToGrayscale(palette[i].red, palette[i].green, palette[i].blue);
+	}
+
+	/**
+	 * For a non-gray palette of size 16 we assume that
+	 * the order of the palette determines the height;
+	 * the first entry is the sea (level 0), the second one
+	 * level 1, etc.
+	 */
+	if (palette_size == 16 && !all_gray) {
+		for (i = 0; i < palette_size; i++) {
+			gray_palette[i] = 256 * i / palette_size;
 		}
 	}
 }
 
 /**
  * Reads the heightmap and/or size of the heightmap from a PNG file.
- * If map == NULL only the size of the PNG is read, otherwise a map
- * with grayscale pixels is allocated and assigned to *map.
+ * If conv == NULL only the size of the PNG is read, otherwise the image
+ * is read row by row and handed to the converter.
  */
-static bool ReadHeightmapPNG(char *filename, uint *x, uint *y, byte **map)
+static bool ReadHeightmapPNG(char *filename, uint *x, uint *y, HeightmapConverter *conv)
 {
 	FILE *fp;
 	png_structp png_ptr = NULL;
@@ -126,11 +260,15 @@ static bool ReadHeightmapPNG(char *filename, uint *x, uint *y, byte **map)
 	}
 
 	png_init_io(png_ptr, fp);
+	png_read_info(png_ptr, info_ptr);
 
-	/* Allocate memory and read image, without alpha or 16-bit samples
+	/* Read the image without alpha or 16-bit samples
 	 * (result is either 8-bit indexed/grayscale or 24-bit RGB) */
 	png_set_packing(png_ptr);
-	png_read_png(png_ptr, info_ptr, PNG_TRANSFORM_PACKING | PNG_TRANSFORM_STRIP_ALPHA | PNG_TRANSFORM_STRIP_16, NULL);
+	png_set_strip_alpha(png_ptr);
+	png_set_strip_16(png_ptr);
+	int passes = png_set_interlace_handling(png_ptr);
+	png_read_update_info(png_ptr, info_ptr);
 
 	/* Maps of wrong color-depth are not used.
 	 * (this should have been taken care of by stripping alpha and 16-bit samples on load) */
@@ -141,14 +279,33 @@ static bool ReadHeightmapPNG(char *filename, uint *x, uint *y, byte **map)
 		return false;
 	}
 
-	if (map != NULL) {
-		*map = MallocT<byte>(png_get_image_width(png_ptr, info_ptr) * png_get_image_height(png_ptr, info_ptr));
-		ReadHeightmapPNGImageData(*map, png_ptr, info_ptr);
-	}
-
 	*x = png_get_image_width(png_ptr, info_ptr);
 	*y = png_get_image_height(png_ptr, info_ptr);
 
+	if (conv != NULL) {
+		uint row_bytes = png_get_rowbytes(png_ptr, info_ptr);
+
+		conv->Setup(*x, *y);
+		conv->rgb = png_get_channels(png_ptr, info_ptr) == 3;
+		ReadHeightmapPNGPalette(conv->gray_palette, png_ptr, info_ptr);
+
+		if (passes == 1) {
+			conv->row = MallocT<byte>(row_bytes);
+			for (uint i = 0; i < *y; i++) {
+				png_read_row(png_ptr, conv->row, NULL);
+				conv->ConvertRow(i, conv->row);
+			}
+		} else {
+			/* Rows of interlaced images are only complete after the last pass */
+			conv->image = MallocT<byte>(row_bytes * *y);
+			for (int pass = 0; pass < passes; pass++) {
+				for (uint i = 0; i < *y; i++) png_read_row(png_ptr, &conv->image[i * row_bytes], NULL);
+			}
+			for (uint i = 0; i < *y; i++) conv->ConvertRow(i, &conv->image[i * row_bytes]);
+		}
+		png_read_end(png_ptr, NULL);
+	}
+
 	fclose(fp);
 	png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
 	return true;
@@ -158,13 +315,10 @@ static bool ReadHeightmapPNG(char *filename, uint *x, uint *y, byte **map)
 
 
 /**
- * The BMP Heightmap loader.
+ * Get the grayscale palette of a BMP heightmap.
  */
-static void ReadHeightmapBMPImageData(byte *map, BmpInfo *info, BmpData *data)
+static void ReadHeightmapBMPPalette(byte *gray_palette, BmpInfo *info, BmpData *data)
 {
-	uint x, y;
-	byte gray_palette[256];
-
 	if (data->palette != NULL) {
 		uint i;
 		bool all_gray = true;
@@ -195,29 +349,20 @@ static void ReadHeightmapBMPImageData(byte *map, BmpInfo *info, BmpData *data)
 			gray_palette[1] = 16;
 		}
 	}
+}
 
-	/* Read the raw image data and convert in 8-bit grayscale */
-	for (y = 0; y < info->height; y++) {
-		byte *pixel = &map[y * info->width];
-		byte *bitmap = &data->bitmap[y * info->width * (info->bpp == 24 ? 3 : 1)];
-
-		for (x = 0; x < info->width; x++) {
-			if (info->bpp != 24) {
-				*pixel++ = gray_palette[*bitmap++];
-			} else {
-				*pixel++ = RGBToGrayscale(*bitmap, *(bitmap + 1), *(bitmap + 2));
-				bitmap += 3;
-			}
-		}
-	}
+/** Hands a row of a BMP heightmap to the converter. */
+static void ReadHeightmapBMPRow(uint y, const byte *row, void *param)
+{
+	((HeightmapConverter*)param)->ConvertRow(y, row);
 }
 
 /**
  * Reads the heightmap and/or size of the heightmap from a BMP file.
- * If map == NULL only the size of the BMP is read, otherwise a map
- * with grayscale pixels is allocated and assigned to *map.
+ * If conv == NULL only the size of the BMP is read, otherwise the image
+ * is read row by row and handed to the converter.
  */
-static bool ReadHeightmapBMP(char *filename, uint *x, uint *y, byte **map)
+static bool ReadHeightmapBMP(char *filename, uint *x, uint *y, HeightmapConverter *conv)
 {
 	FILE *f;
 	BmpInfo info;
@@ -242,24 +387,17 @@ static bool ReadHeightmapBMP(char *filename, uint *x, uint *y, byte **map)
 		return false;
 	}
 
-	if (map != NULL) {
-		if (!BmpReadBitmap(&buffer, &info, &data)) {
-			ShowErrorMessage(STR_BMPMAP_ERR_IMAGE_TYPE, STR_BMPMAP_ERROR, 0, 0);
-			fclose(f);
-			BmpDestroyData(&data);
-			return false;
-		}
+	if (conv != NULL) {
+		conv->Setup(info.width, info.height);
+		conv->rgb = info.bpp == 24;
+		ReadHeightmapBMPPalette(conv->gray_palette, &info, &data);
 
-		*map = MallocT<byte>(info.width * info.height);
-		if (*map == NULL) {
-			ShowErrorMessage(STR_PNGMAP_ERR_MISC, STR_BMPMAP_ERROR, 0, 0);
+		if (!BmpReadBitmap(&buffer, &info, &data, ReadHeightmapBMPRow, conv)) {
+			ShowErrorMessage(STR_BMPMAP_ERR_IMAGE_TYPE, STR_BMPMAP_ERROR, 0, 0);
 			fclose(f);
 			BmpDestroyData(&data);
 			return false;
 		}
-
-		ReadHeightmapBMPImageData(*map, &info, &data);
-
 	}
 
 	BmpDestroyData(&data);
@@ -271,92 +409,14 @@ static bool ReadHeightmapBMP(char *filename, uint *x, uint *y, byte **map)
 	return true;
 }
 
-/**
- * Converts a given grayscale map to something that fits in OTTD map system
- * and create a map of that data.
- * @param img_width  the with of the image in pixels/tiles
- * @param img_height the height of the image in pixels/tiles
- * @param map        the input map
- */
-static void GrayscaleToMapHeights(uint img_width, uint img_height, byte *map)
-{
-	/* Defines the detail of the aspect ratio (to avoid doubles) */
-	const uint num_div = 16384;
-
-	uint width, height;
-	uint row, col;
-	uint row_pad = 0, col_pad = 0;
-	uint img_scale;
-	uint img_row, img_col;
-	TileIndex tile;
-
-	/* Get map size and calculate scale and padding values */
-	switch (_patches.heightmap_rotation) {
-		default: NOT_REACHED();
-		case HM_COUNTER_CLOCKWISE:
-			width   = MapSizeX();
-			height  = MapSizeY();
-			break;
-		case HM_CLOCKWISE:
-			width   = MapSizeY();
-			height  = MapSizeX();
-			break;
-	}
-
-	if ((img_width * num_div) / img_height > ((width * num_div) / height)) {
-		/* Image is wider than map - center vertically */
-		img_scale = (width * num_div) / img_width;
-		row_pad = (1 + height - ((img_height * img_scale) / num_div)) / 2;
-	} else {
-		/* Image is taller than map - center horizontally */
-		img_scale = (height * num_div) / img_height;
-		col_pad = (1 + width - ((img_width * img_scale) / num_div)) / 2;
-	}
-
-	/* Form the landscape */
-	for (row = 0; row < height - 1; row++) {
-		for (col = 0; col < width - 1; col++) {
-			switch (_patches.heightmap_rotation) {
-				default: NOT_REACHED();
-				case HM_COUNTER_CLOCKWISE: tile = TileXY(col, row); break;
-				case HM_CLOCKWISE:         tile = TileXY(row, col); break;
-			}
-
-			/* Check if current tile is within the 1-pixel map edge or padding regions */
-			if ((DistanceFromEdge(tile) <= 1) ||
-					(row < row_pad) || (row >= (height - row_pad - 1)) ||
-					(col < col_pad) || (col >= (width  - col_pad - 1))) {
-				SetTileHeight(tile, 0);
-			} else {
-				/* Use nearest neighbor resizing to scale map data.
-				 *  We rotate the map 45 degrees (counter)clockwise */
-				img_row = (((row - row_pad) * num_div) / img_scale);
-				switch (_patches.heightmap_rotation) {
-					default: NOT_REACHED();
-					case HM_COUNTER_CLOCKWISE:
-						img_col = (((width - 1 - col - col_pad) * num_div) / img_scale);
-						break;
-					case HM_CLOCKWISE:
-						img_col = (((col - col_pad) * num_div) / img_scale);
-						break;
-				}
-
-				assert(img_row < img_height);
-				assert(img_col < img_width);
-
-				/* Color scales from 0 to 255, OpenTTD height scales from 0 to 15 */
-				SetTileHeight(tile, map[img_row * img_width + img_col] / 16);
-			}
-			MakeClear(tile, CLEAR_GRASS, 3);
-		}
-	}
-}
-
 /**
  * This function takes care of the fact that land in OpenTTD can never differ
- * more than 1 in height
+ * more than 1 in height.
+ * It works on a buffer with the height of each tile, indexed by TileIndex,
+ * so the map itself is only touched once when the result is written back.
+ * @param heights the heights to fix
  */
-static void FixSlopes()
+static void FixSlopes(byte *heights)
 {
 	uint width, height;
 	uint row, col;
@@ -368,34 +428,30 @@ static void FixSlopes()
 
 	/* Top and left edge */
 	for (row = 1; row < height - 2; row++) {
-		for (col = 1; col < width - 2; col++) {
-			/* Find lowest tile; either the top or left one */
-			current_tile = TileHeight(TileXY(col - 1, row)); // top edge
-			if (TileHeight(TileXY(col, row - 1)) < current_tile) {
-				current_tile = TileHeight(TileXY(col, row - 1)); // left edge
-			}
+		byte *h = &heights[TileXY(1, row)];
+		for (col = 1; col < width - 2; col++, h++) {
+			/* Find lowest tile; either the top (x - 1) or left (y - 1) one */
+			current_tile = min(h[-1], h[-(int)width]);
 
 			/* Does the height differ more than one? */
-			if (TileHeight(TileXY(col, row)) >= (uint)current_tile + 2) {
+			if (*h >= (uint)current_tile + 2) {
 				/* Then change the height to be no more than one */
-				SetTileHeight(TileXY(col, row), current_tile + 1);
+				*h = current_tile + 1;
 			}
 		}
 	}
 
 	/* Bottom and right edge */
 	for (row = height - 2; row > 0; row--) {
-		for (col = width - 2; col > 0; col--) {
-			/* Find lowest tile; either the bottom and right one */
-			current_tile = TileHeight(TileXY(col + 1, row)); // bottom edge
-			if (TileHeight(TileXY(col, row + 1)) < current_tile) {
-				current_tile = TileHeight(TileXY(col, row + 1)); // right edge
-			}
+		byte *h = &heights[TileXY(width - 2, row)];
+		for (col = width - 2; col > 0; col--, h--) {
+			/* Find lowest tile; either the bottom (x + 1) or right (y + 1) one */
+			current_tile = min(h[1], h[width]);
 
 			/* Does the height differ more than one? */
-			if (TileHeight(TileXY(col, row)) >= (uint)current_tile + 2) {
+			if (*h >= (uint)current_tile + 2) {
 				/* Then change the height to be no more than one */
-				SetTileHeight(TileXY(col, row), current_tile + 1);
+				*h = current_tile + 1;
 			}
 		}
 	}
@@ -404,16 +460,16 @@ static void FixSlopes()
 /**
  * Reads the heightmap with the correct file reader
  */
-static bool ReadHeightMap(char *filename, uint *x, uint *y, byte **map)
+static bool ReadHeightMap(char *filename, uint *x, uint *y, HeightmapConverter *conv)
 {
 	switch (_file_to_saveload.mode) {
 		default: NOT_REACHED();
 #ifdef WITH_PNG
 		case SL_PNG:
-			return ReadHeightmapPNG(filename, x, y, map);
+			return ReadHeightmapPNG(filename, x, y, conv);
 #endif /* WITH_PNG */
 		case SL_BMP:
-			return ReadHeightmapBMP(filename, x, y, map);
+			return ReadHeightmapBMP(filename, x, y, conv);
 	}
 }
 
@@ -425,17 +481,21 @@ bool GetHeightmapDimensions(char *filename, uint *x, uint *y)
 void LoadHeightmap(char *filename)
 {
 	uint x, y;
-	byte *map = NULL;
+	HeightmapConverter conv;
 
-	if (!ReadHeightMap(filename, &x, &y, &map)) {
-		free(map);
-		return;
-	}
+	if (!ReadHeightMap(filename, &x, &y, &conv)) return;
 
-	GrayscaleToMapHeights(x, y, map);
-	free(map);
+	FixSlopes(conv.heights);
+
+	/* Form the landscape */
+	for (uint row = 0; row < MapMaxY(); row++) {
+		for (uint col = 0; col < MapMaxX(); col++) {
+			TileIndex tile = TileXY(col, row);
+			SetTileHeight(tile, conv.heights[tile]);
+			MakeClear(tile, CLEAR_GRASS, 3);
+		}
+	}
 
-	FixSlopes();
 	MarkWholeScreenDirty();
 }
 
@@ -447,12 +507,21 @@ void FlatEmptyWorld(byte tile_height)
 	width  = MapSizeX();
 	height = MapSizeY();
 
+	byte *heights = MallocT<byte>(MapSize());
+	for (TileIndex tile = 0; tile < MapSize(); tile++) heights[tile] = TileHeight(tile);
+
 	for (row = 2; row < height - 2; row++) {
 		for (col = 2; col < width - 2; col++) {
-			SetTileHeight(TileXY(col, row), tile_height);
+			heights[TileXY(col, row)] = tile_height;
 		}
 	}
 
-	FixSlopes();
+	FixSlopes(heights);
+
+	for (TileIndex tile = 0; tile < MapSize(); tile++) {
+		if (heights[tile] != TileHeight(tile)) SetTileHeight(tile, heights[tile]);
+	}
+	free(heights);
+
 	MarkWholeScreenDirty();
 }
@@ -327,6 +327,8 @@ static inline void ResetIndustryCounts()
 	memset(&_industry_counts, 0, sizeof(_industry_counts));
 }
 
+uint32 GetClosestIndustryDistance(TileIndex tile, IndustryType type, const Industry *current);
+
 /**
  * Return a random valid industry.
  */
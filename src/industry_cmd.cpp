@@ -7,6 +7,7 @@
 #include "clear_map.h"
 #include "industry_map.h"
 #include "station_map.h"
+#include "station.h"
 #include "train.h"
 #include "landscape.h"
 #include "viewport_func.h"
@@ -36,6 +37,10 @@
 #include "vehicle_func.h"
 #include "sound_func.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include "table/strings.h"
 #include "table/sprites.h"
 #include "table/industry_land.h"
@@ -133,10 +138,127 @@ const IndustryTileSpec *GetIndustryTileSpec(IndustryGfx gfx)
 	return &_industry_tile_specs[gfx];
 }
 
+/** Number of bits of the tile coordinates within one cell of the industry grid. */
+static const uint INDUSTRY_GRID_BITS = 4;
+
+static std::vector<IndustryID> *_industry_grid = NULL; ///< Per cell of the map the industries whose top tile lies in it
+static uint _industry_grid_x;                         ///< Number of cells along the X axis
+static uint _industry_grid_y;                         ///< Number of cells along the Y axis
+
+typedef std::map<std::pair<TownID, IndustryType>, uint> TownIndustryCounts;
+static TownIndustryCounts _town_industry_counts;      ///< Number of industries of each type per town
+
+static inline std::vector<IndustryID> &GetIndustryGridCell(uint cx, uint cy)
+{
+	return _industry_grid[cy * _industry_grid_x + cx];
+}
+
+static inline std::pair<TownID, IndustryType> GetTownIndustryKey(const Town *t, IndustryType type)
+{
+	return std::make_pair(t == NULL ? (TownID)INVALID_TOWN : t->index, type);
+}
+
+/**
+ * Add an industry to the spatial index.
+ * @param i the industry, with its position, type and town set
+ */
+static void AddIndustryToIndex(const Industry *i)
+{
+	if (_industry_grid == NULL) return;
+
+	GetIndustryGridCell(TileX(i->xy) >> INDUSTRY_GRID_BITS, TileY(i->xy) >> INDUSTRY_GRID_BITS).push_back(i->index);
+	_town_industry_counts[GetTownIndustryKey(i->town, i->type)]++;
+}
+
+/**
+ * Remove an industry from the spatial index, if it is in there.
+ * @param i the industry
+ */
+static void RemoveIndustryFromIndex(const Industry *i)
+{
+	if (_industry_grid == NULL) return;
+
+	std::vector<IndustryID> &cell = GetIndustryGridCell(TileX(i->xy) >> INDUSTRY_GRID_BITS, TileY(i->xy) >> INDUSTRY_GRID_BITS);
+	std::vector<IndustryID>::iterator it = std::find(cell.begin(), cell.end(), i->index);
+	if (it == cell.end()) return;
+
+	*it = cell.back();
+	cell.pop_back();
+
+	TownIndustryCounts::iterator count = _town_industry_counts.find(GetTownIndustryKey(i->town, i->type));
+	if (--count->second == 0) _town_industry_counts.erase(count);
+}
+
+/** Forget the spatial index; it gets rebuilt when it is needed. */
+static void ResetIndustryIndex()
+{
+	delete[] _industry_grid;
+	_industry_grid = NULL;
+	_town_industry_counts.clear();
+}
+
+/** Make sure the spatial index exists, building it from all industries when needed. */
+static void BuildIndustryIndex()
+{
+	if (_industry_grid != NULL) return;
+
+	_industry_grid_x = (MapSizeX() + (1 << INDUSTRY_GRID_BITS) - 1) >> INDUSTRY_GRID_BITS;
+	_industry_grid_y = (MapSizeY() + (1 << INDUSTRY_GRID_BITS) - 1) >> INDUSTRY_GRID_BITS;
+	_industry_grid = new std::vector<IndustryID>[_industry_grid_x * _industry_grid_y];
+
+	const Industry *i;
+	FOR_ALL_INDUSTRIES(i) AddIndustryToIndex(i);
+}
+
+/**
+ * Get the Manhattan distance to the closest industry of the given type.
+ * The cells of the index are searched in rings around the tile, until no
+ * closer industry can be found anymore.
+ * @param tile    the tile to measure the distance from
+ * @param type    the type of industry to look for
+ * @param current industry to ignore, may be NULL
+ * @return the distance, or MAX_UVALUE(uint32) if there is no such industry
+ */
+uint32 GetClosestIndustryDistance(TileIndex tile, IndustryType type, const Industry *current)
+{
+	uint32 best_dist = MAX_UVALUE(uint32);
+	if (type >= NUM_INDUSTRYTYPES || _industry_counts[type] == 0) return best_dist;
+
+	BuildIndustryIndex();
+
+	int cx = TileX(tile) >> INDUSTRY_GRID_BITS;
+	int cy = TileY(tile) >> INDUSTRY_GRID_BITS;
+	int max_ring = max(max(cx, (int)_industry_grid_x - 1 - cx), max(cy, (int)_industry_grid_y - 1 - cy));
+
+	for (int ring = 0; ring <= max_ring; ring++) {
+		/* Tiles in this ring are at least this far away */
+		if (ring > 0 && (uint32)((ring - 1) << INDUSTRY_GRID_BITS) + 1 >= best_dist) break;
+
+		for (int y = max(cy - ring, 0); y <= min(cy + ring, (int)_industry_grid_y - 1); y++) {
+			for (int x = max(cx - ring, 0); x <= min(cx + ring, (int)_industry_grid_x - 1); x++) {
+				/* Only the border of the ring, the inside has been done already */
+				if (abs(x - cx) != ring && abs(y - cy) != ring) continue;
+
+				const std::vector<IndustryID> &cell = GetIndustryGridCell(x, y);
+				for (std::vector<IndustryID>::const_iterator it = cell.begin(); it != cell.end(); ++it) {
+					const Industry *i = GetIndustry(*it);
+					if (i->type != type || i == current) continue;
+
+					best_dist = min(best_dist, DistanceManhattan(tile, i->xy));
+				}
+			}
+		}
+	}
+
+	return best_dist;
+}
+
 Industry::~Industry()
 {
 	if (CleaningPool()) return;
 
+	RemoveIndustryFromIndex(this);
+
 	/* Industry can also be destroyed when not fully initialized.
 	 * This means that we do not have to clear tiles either. */
 	if (this->width == 0) {
@@ -450,6 +572,7 @@ static void TransportIndustryGoods(TileIndex tile)
 			ResetIndustryConstructionStage(tile);
 			SetIndustryCompleted(tile, true);
 			SetIndustryGfx(tile, newgfx);
+			UpdateTileAcceptance(tile);
 			MarkTileDirtyByTile(tile);
 		}
 	}
@@ -566,6 +689,7 @@ static void AnimateTile_Industry(TileIndex tile)
 
 			gfx = (gfx < 155) ? gfx + 1 : 148;
 			SetIndustryGfx(tile, gfx);
+			UpdateTileAcceptance(tile);
 			MarkTileDirtyByTile(tile);
 		}
 		break;
@@ -580,11 +704,13 @@ static void AnimateTile_Industry(TileIndex tile)
 			m = GetIndustryAnimationState(tile) + 1;
 			if (m == 4 && (m = 0, ++gfx) == GFX_OILWELL_ANIMATED_3 + 1 && (gfx = GFX_OILWELL_ANIMATED_1, b)) {
 				SetIndustryGfx(tile, GFX_OILWELL_NOT_ANIMATED);
+				UpdateTileAcceptance(tile);
 				SetIndustryConstructionStage(tile, 3);
 				DeleteAnimatedTile(tile);
 			} else {
 				SetIndustryAnimationState(tile, m);
 				SetIndustryGfx(tile, gfx);
+				UpdateTileAcceptance(tile);
 				MarkTileDirtyByTile(tile);
 			}
 		}
@@ -736,6 +862,7 @@ static void TileLoop_Industry(TileIndex tile)
 	if (newgfx != INDUSTRYTILE_NOANIM) {
 		ResetIndustryConstructionStage(tile);
 		SetIndustryGfx(tile, newgfx);
+		UpdateTileAcceptance(tile);
 		MarkTileDirtyByTile(tile);
 		return;
 	}
@@ -761,6 +888,7 @@ static void TileLoop_Industry(TileIndex tile)
 				case GFX_GOLD_MINE_TOWER_NOT_ANIMATED:   gfx = GFX_GOLD_MINE_TOWER_ANIMATED;   break;
 			}
 			SetIndustryGfx(tile, gfx);
+			UpdateTileAcceptance(tile);
 			SetIndustryAnimationState(tile, 0x80);
 			AddAnimatedTile(tile);
 		}
@@ -769,6 +897,7 @@ static void TileLoop_Industry(TileIndex tile)
 	case GFX_OILWELL_NOT_ANIMATED:
 		if (Chance16(1, 6)) {
 			SetIndustryGfx(tile, GFX_OILWELL_ANIMATED_1);
+			UpdateTileAcceptance(tile);
 			SetIndustryAnimationState(tile, 0);
 			AddAnimatedTile(tile);
 		}
@@ -784,6 +913,7 @@ static void TileLoop_Industry(TileIndex tile)
 				case GFX_GOLD_MINE_TOWER_ANIMATED:   gfx = GFX_GOLD_MINE_TOWER_NOT_ANIMATED;   break;
 			}
 			SetIndustryGfx(tile, gfx);
+			UpdateTileAcceptance(tile);
 			SetIndustryCompleted(tile, true);
 			SetIndustryConstructionStage(tile, 3);
 			DeleteAnimatedTile(tile);
@@ -1180,18 +1310,15 @@ static bool CheckSuitableIndustryPos(TileIndex tile)
 static const Town *CheckMultipleIndustryInTown(TileIndex tile, int type)
 {
 	const Town *t;
-	const Industry *i;
 
 	t = ClosestTownFromTile(tile, (uint)-1);
 
 	if (_patches.multiple_industry_per_town) return t;
 
-	FOR_ALL_INDUSTRIES(i) {
-		if (i->type == (byte)type &&
-				i->town == t) {
-			_error_message = STR_0287_ONLY_ONE_ALLOWED_PER_TOWN;
-			return NULL;
-		}
+	BuildIndustryIndex();
+	if (_town_industry_counts.find(GetTownIndustryKey(t, type)) != _town_industry_counts.end()) {
+		_error_message = STR_0287_ONLY_ONE_ALLOWED_PER_TOWN;
+		return NULL;
 	}
 
 	return t;
@@ -1398,37 +1525,52 @@ static bool CheckIfCanLevelIndustryPlatform(TileIndex tile, uint32 flags, const
 static bool CheckIfFarEnoughFromIndustry(TileIndex tile, int type)
 {
 	const IndustrySpec *indspec = GetIndustrySpec(type);
-	const Industry *i;
 
 	if (_patches.same_industry_close && indspec->IsRawIndustry())
 		/* Allow primary industries to be placed close to any other industry */
 		return true;
 
-	FOR_ALL_INDUSTRIES(i) {
-		/* Within 14 tiles from another industry is considered close */
-		bool in_low_distance = DistanceMax(tile, i->xy) <= 14;
-
-		/* check if an industry that accepts the same goods is nearby */
-		if (in_low_distance &&
-				!indspec->IsRawIndustry() && // not a primary industry?
-				indspec->accepts_cargo[0] == i->accepts_cargo[0] && (
-				/* at least one of those options must be true */
-				_game_mode != GM_EDITOR || // editor must not be stopped
-				!_patches.same_industry_close ||
-				!_patches.multiple_industry_per_town)) {
-			_error_message = STR_INDUSTRY_TOO_CLOSE;
-			return false;
-		}
+	/* Within 14 tiles from another industry is considered close, so only
+	 * the industries in the cells of the index within that range matter */
+	static const uint CLOSE_DISTANCE = 14;
+	BuildIndustryIndex();
+
+	uint x1 = (uint)max((int)TileX(tile) - (int)CLOSE_DISTANCE, 0) >> INDUSTRY_GRID_BITS;
+	uint y1 = (uint)max((int)TileY(tile) - (int)CLOSE_DISTANCE, 0) >> INDUSTRY_GRID_BITS;
+	uint x2 = min(TileX(tile) + CLOSE_DISTANCE, MapMaxX()) >> INDUSTRY_GRID_BITS;
+	uint y2 = min(TileY(tile) + CLOSE_DISTANCE, MapMaxY()) >> INDUSTRY_GRID_BITS;
+
+	for (uint cy = y1; cy <= y2; cy++) {
+		for (uint cx = x1; cx <= x2; cx++) {
+			const std::vector<IndustryID> &cell = GetIndustryGridCell(cx, cy);
+			for (std::vector<IndustryID>::const_iterator it = cell.begin(); it != cell.end(); ++it) {
+				const Industry *i = GetIndustry(*it);
+				bool in_low_distance = DistanceMax(tile, i->xy) <= CLOSE_DISTANCE;
+
+				/* check if an industry that accepts the same goods is nearby */
+				if (in_low_distance &&
+						!indspec->IsRawIndustry() && // not a primary industry?
+						indspec->accepts_cargo[0] == i->accepts_cargo[0] && (
+						/* at least one of those options must be true */
+						_game_mode != GM_EDITOR || // editor must not be stopped
+						!_patches.same_industry_close ||
+						!_patches.multiple_industry_per_town)) {
+					_error_message = STR_INDUSTRY_TOO_CLOSE;
+					return false;
+				}
 
-		/* check if there are any conflicting industry types around */
-		if ((i->type == indspec->conflicting[0] ||
-				i->type == indspec->conflicting[1] ||
-				i->type == indspec->conflicting[2]) &&
-				in_low_distance) {
-			_error_message = STR_INDUSTRY_TOO_CLOSE;
-			return false;
+				/* check if there are any conflicting industry types around */
+				if ((i->type == indspec->conflicting[0] ||
+						i->type == indspec->conflicting[1] ||
+						i->type == indspec->conflicting[2]) &&
+						in_low_distance) {
+					_error_message = STR_INDUSTRY_TOO_CLOSE;
+					return false;
+				}
+			}
 		}
 	}
+
 	return true;
 }
 
@@ -1472,6 +1614,7 @@ static void DoCreateNewIndustry(Industry *i, TileIndex tile, int type, const Ind
 
 	i->town = t;
 	i->owner = owner;
+	AddIndustryToIndex(i);
 
 	r = Random();
 	i->random_color = GB(r, 0, 4);
@@ -1546,6 +1689,7 @@ static void DoCreateNewIndustry(Industry *i, TileIndex tile, int type, const Ind
 			DoCommand(cur_tile, 0, 0, DC_EXEC, CMD_LANDSCAPE_CLEAR);
 
 			MakeIndustry(cur_tile, i->index, it->gfx, Random());
+			UpdateTileAcceptance(cur_tile);
 
 			if (_generating_world) {
 				SetIndustryConstructionCounter(cur_tile, 3);
@@ -2260,6 +2404,7 @@ void InitializeIndustries()
 	_Industry_pool.AddBlockToPool();
 
 	ResetIndustryCounts();
+	ResetIndustryIndex();
 	_industry_sort_dirty = true;
 	_industry_sound_tile = 0;
 }
@@ -2424,6 +2569,7 @@ static void Load_INDY()
 	int index;
 
 	ResetIndustryCounts();
+	ResetIndustryIndex();
 
 	while ((index = SlIterateArray()) != -1) {
 		Industry *i = new (index) Industry();
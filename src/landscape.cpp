@@ -24,6 +24,7 @@
 #include "vehicle_func.h"
 #include "settings_type.h"
 #include "water.h"
+#include "station.h"
 
 #include "table/sprites.h"
 
@@ -440,6 +441,7 @@ void DrawFoundation(TileInfo *ti, Foundation f)
 void DoClearSquare(TileIndex tile)
 {
 	MakeClear(tile, CLEAR_GRASS, _generating_world ? 3 : 0);
+	UpdateTileAcceptance(tile);
 	MarkTileDirtyByTile(tile);
 }
 
@@ -90,6 +90,8 @@ void NetworkCoreShutdown()
 #if defined(WIN32)
 	WSACleanup();
 #endif
+
+	NetworkPacketPoolFree();
 }
 
 
@@ -7,7 +7,9 @@
 #ifdef ENABLE_NETWORK
 
 #include "../../stdafx.h"
+#include "../../debug.h"
 #include "../../string_func.h"
+#include "../../core/alloc_func.hpp"
 
 #include "packet.h"
 
@@ -17,6 +19,140 @@
 /* Do not want to include functions.h and all required headers */
 extern void NORETURN CDECL error(const char *str, ...);
 
+/**
+ * The sizes of the buffer classes packets can have; the biggest one
+ * has to be SEND_MTU. Most packets (frames, commands, acks) fit in
+ * the smallest two classes.
+ */
+static const PacketSize _packet_buffer_sizes[] = { 32, 128, 512, SEND_MTU };
+
+/** Maximum number of items kept in a single free list. */
+static const uint PACKET_POOL_MAX_FREE = 256;
+
+/** A released item; its own memory is used to chain it in the free list. */
+struct PacketPoolItem {
+	PacketPoolItem *next; ///< The next free item
+};
+
+/**
+ * A free list of equally sized items with its allocation statistics.
+ * Packets are only created and destroyed by the thread running the
+ * game loop, so the free lists need no locking.
+ */
+struct PacketPoolList {
+	PacketPoolItem *first; ///< The first free item
+	uint free;             ///< Number of items in the free list
+	uint requests;         ///< Number of allocation requests
+	uint reused;           ///< Number of requests served from the free list
+	uint in_use;           ///< Number of items currently handed out
+	uint peak;             ///< Maximum number of items handed out at the same time
+};
+
+static PacketPoolList _packet_pool;                                        ///< Pool of the Packet objects
+static PacketPoolList _packet_buffer_pool[lengthof(_packet_buffer_sizes)]; ///< Pools of the buffers per size class
+
+/**
+ * Get an item from a free list, or allocate one when the list is empty.
+ * @param list the free list to allocate from
+ * @param size the size of the items of the list
+ * @return the item
+ */
+static void *PacketPoolAlloc(PacketPoolList *list, size_t size)
+{
+	list->requests++;
+	if (++list->in_use > list->peak) list->peak = list->in_use;
+
+	PacketPoolItem *item = list->first;
+	if (item == NULL) return MallocT<byte>(size);
+
+	list->first = item->next;
+	list->free--;
+	list->reused++;
+	return item;
+}
+
+/**
+ * Return an item to its free list, or free it when the list is full.
+ * @param list the free list the item was allocated from
+ * @param p the item
+ */
+static void PacketPoolRelease(PacketPoolList *list, void *p)
+{
+	list->in_use--;
+
+	if (list->free >= PACKET_POOL_MAX_FREE) {
+		free(p);
+		return;
+	}
+
+	PacketPoolItem *item = (PacketPoolItem*)p;
+	item->next = list->first;
+	list->first = item;
+	list->free++;
+}
+
+/**
+ * Free all items in a free list.
+ * @param list the free list to clear
+ */
+static void PacketPoolClear(PacketPoolList *list)
+{
+	while (list->first != NULL) {
+		PacketPoolItem *item = list->first;
+		list->first = item->next;
+		free(item);
+	}
+	list->free = 0;
+}
+
+/**
+ * Get the smallest buffer class that can hold the given number of bytes.
+ * @param bytes the number of bytes
+ * @return index into _packet_buffer_sizes
+ */
+static uint GetPacketBufferClass(uint bytes)
+{
+	assert(bytes <= SEND_MTU);
+
+	uint i = 0;
+	while (_packet_buffer_sizes[i] < bytes) i++;
+	return i;
+}
+
+/** Print the allocation statistics of the packet pools. */
+void NetworkPacketPoolDebugStats()
+{
+	DEBUG(net, 1, "[core] packets: %d requests, %d reused, %d in use, %d peak",
+		_packet_pool.requests, _packet_pool.reused, _packet_pool.in_use, _packet_pool.peak);
+
+	for (uint i = 0; i < lengthof(_packet_buffer_sizes); i++) {
+		const PacketPoolList *list = &_packet_buffer_pool[i];
+		DEBUG(net, 1, "[core] %4d byte buffers: %d requests, %d reused, %d in use, %d peak",
+			_packet_buffer_sizes[i], list->requests, list->reused, list->in_use, list->peak);
+	}
+}
+
+/** Free all memory kept in the packet pools. */
+void NetworkPacketPoolFree()
+{
+	PacketPoolClear(&_packet_pool);
+	for (uint i = 0; i < lengthof(_packet_buffer_sizes); i++) {
+		PacketPoolClear(&_packet_buffer_pool[i]);
+	}
+}
+
+void *Packet::operator new(size_t size)
+{
+	assert(size == sizeof(Packet));
+	return PacketPoolAlloc(&_packet_pool, size);
+}
+
+void Packet::operator delete(void *p)
+{
+	if (p == NULL) return;
+	PacketPoolRelease(&_packet_pool, p);
+}
+
 /**
  * Create a packet that is used to read from a network socket
  * @param cs the socket handler associated with the socket we are reading from
@@ -29,6 +165,8 @@ Packet::Packet(NetworkSocketHandler *cs)
 	this->next = NULL;
 	this->pos  = 0; // We start reading from here
 	this->size = 0;
+
+	this->AllocateBuffer(sizeof(PacketSize));
 }
 
 /**
@@ -40,12 +178,51 @@ Packet::Packet(PacketType type)
 	this->cs                   = NULL;
 	this->next                 = NULL;
 
+	this->AllocateBuffer(sizeof(PacketSize) + sizeof(PacketType));
+
 	/* Skip the size so we can write that in before sending the packet */
 	this->pos                  = 0;
 	this->size                 = sizeof(PacketSize);
 	this->buffer[this->size++] = type;
 }
 
+/** Return the buffer of the packet to its pool. */
+Packet::~Packet()
+{
+	PacketPoolRelease(&_packet_buffer_pool[GetPacketBufferClass(this->limit)], this->buffer);
+}
+
+/**
+ * Get a buffer of the smallest class that can hold the given number of bytes.
+ * @param bytes the number of bytes the buffer must be able to hold
+ */
+void Packet::AllocateBuffer(PacketSize bytes)
+{
+	uint c = GetPacketBufferClass(bytes);
+
+	this->limit  = _packet_buffer_sizes[c];
+	this->buffer = (byte*)PacketPoolAlloc(&_packet_buffer_pool[c], this->limit);
+}
+
+/**
+ * Make sure the buffer can hold at least the given number of bytes,
+ * moving the contents to a buffer of a bigger class when needed.
+ * @param bytes the total number of bytes the buffer must be able to hold
+ */
+void Packet::Reserve(uint bytes)
+{
+	assert(bytes <= SEND_MTU);
+	if (bytes <= this->limit) return;
+
+	byte *old_buffer = this->buffer;
+	PacketSize old_limit = this->limit;
+
+	this->AllocateBuffer(bytes);
+	memcpy(this->buffer, old_buffer, old_limit);
+
+	PacketPoolRelease(&_packet_buffer_pool[GetPacketBufferClass(old_limit)], old_buffer);
+}
+
 /**
  * Create a packet for sending
  * @param type the of packet
@@ -92,20 +269,20 @@ void Packet::Send_bool(bool data)
 
 void Packet::Send_uint8(uint8 data)
 {
-	assert(this->size < sizeof(this->buffer) - sizeof(data));
+	this->Reserve(this->size + sizeof(data));
 	this->buffer[this->size++] = data;
 }
 
 void Packet::Send_uint16(uint16 data)
 {
-	assert(this->size < sizeof(this->buffer) - sizeof(data));
+	this->Reserve(this->size + sizeof(data));
 	this->buffer[this->size++] = GB(data, 0, 8);
 	this->buffer[this->size++] = GB(data, 8, 8);
 }
 
 void Packet::Send_uint32(uint32 data)
 {
-	assert(this->size < sizeof(this->buffer) - sizeof(data));
+	this->Reserve(this->size + sizeof(data));
 	this->buffer[this->size++] = GB(data,  0, 8);
 	this->buffer[this->size++] = GB(data,  8, 8);
 	this->buffer[this->size++] = GB(data, 16, 8);
@@ -114,7 +291,7 @@ void Packet::Send_uint32(uint32 data)
 
 void Packet::Send_uint64(uint64 data)
 {
-	assert(this->size < sizeof(this->buffer) - sizeof(data));
+	this->Reserve(this->size + sizeof(data));
 	this->buffer[this->size++] = GB(data,  0, 8);
 	this->buffer[this->size++] = GB(data,  8, 8);
 	this->buffer[this->size++] = GB(data, 16, 8);
@@ -133,8 +310,7 @@ void Packet::Send_uint64(uint64 data)
 void Packet::Send_string(const char* data)
 {
 	assert(data != NULL);
-	/* The <= *is* valid due to the fact that we are comparing sizes and not the index. */
-	assert(this->size + strlen(data) + 1 <= sizeof(this->buffer));
+	this->Reserve(this->size + strlen(data) + 1);
 	while ((this->buffer[this->size++] = *data++) != '\0') {}
 }
 
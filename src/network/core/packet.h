@@ -23,6 +23,11 @@ typedef uint8  PacketType; ///< Identifier for the packet
  * limit will give an assertion when sending (i.e. writing) the
  * packet. Reading past the size of the packet when receiving
  * will return all 0 values and "" in case of the string.
+ *
+ * Packets and their buffers come from a pool of free lists; the
+ * buffer starts small and is moved to a bigger size class when
+ * the packet grows, so small (frame) packets do not carry a full
+ * SEND_MTU buffer around.
  */
 struct Packet {
 	/** The next packet. Used for queueing packets before sending. */
@@ -34,13 +39,23 @@ struct Packet {
 	/** The current read/write position in the packet */
 	PacketSize pos;
 	/** The buffer of this packet */
-	byte buffer[SEND_MTU];
+	byte *buffer;
 private:
+	/** The number of bytes allocated for the buffer */
+	PacketSize limit;
 	NetworkSocketHandler *cs;
 
+	void AllocateBuffer(PacketSize bytes);
+
 public:
 	Packet(NetworkSocketHandler *cs);
 	Packet(PacketType type);
+	~Packet();
+
+	void *operator new(size_t size);
+	void operator delete(void *p);
+
+	void Reserve(uint bytes);
 
 	/* Sending/writing of packets */
 	void PrepareToSend();
@@ -67,6 +82,9 @@ public:
 
 Packet *NetworkSend_Init(PacketType type);
 
+void NetworkPacketPoolDebugStats();
+void NetworkPacketPoolFree();
+
 #endif /* ENABLE_NETWORK */
 
 #endif /* NETWORK_CORE_PACKET_H */
@@ -213,6 +213,9 @@ Packet *NetworkTCPSocketHandler::Recv_Packet(NetworkRecvStatus *status)
 			*status = this->CloseConnection();
 			return NULL;
 		}
+
+		/* Make room for the rest of the packet */
+		p->Reserve(p->size);
 	}
 
 	/* Read rest of packet */
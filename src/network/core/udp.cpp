@@ -110,7 +110,9 @@ void NetworkUDPSocketHandler::ReceivePackets()
 
 	if (!this->IsConnected()) return;
 
-	packet_len = sizeof(p.buffer);
+	/* A datagram has to be read in one go, so make room for the biggest packet */
+	p.Reserve(SEND_MTU);
+	packet_len = SEND_MTU;
 	client_len = sizeof(client_addr);
 
 	/* Try to receive anything */
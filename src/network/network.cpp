@@ -17,6 +17,7 @@
 #include "network_server.h"
 #include "network_udp.h"
 #include "network_gamelist.h"
+#include "network_replay.h"
 #include "core/udp.h"
 #include "core/tcp.h"
 #include "core/core.h"
@@ -32,9 +33,6 @@
 #include "../player_func.h"
 #include "../settings_type.h"
 #include "../rev.h"
-#ifdef DEBUG_DUMP_COMMANDS
-	#include "../core/alloc_func.hpp"
-#endif /* DEBUG_DUMP_COMMANDS */
 
 #include "table/strings.h"
 
@@ -276,6 +274,7 @@ static void NetworkClientError(NetworkRecvStatus res, NetworkTCPSocketHandler* c
 
 	_switch_mode = SM_MENU;
 	NetworkCloseClient(cs);
+	NetworkReplayStopRecording();
 	_networking = false;
 }
 
@@ -675,6 +674,7 @@ void NetworkCloseClient(NetworkTCPSocketHandler *cs)
 		// We just lost one client :(
 		if (cs->status >= STATUS_AUTH) _network_game_info.clients_on--;
 		_network_clients_connected--;
+		NetworkUDPInvalidateReplyCache();
 
 		while ((cs + 1) != DEREF_CLIENT(MAX_CLIENTS) && (cs + 1)->sock != INVALID_SOCKET) {
 			*cs = *(cs + 1);
@@ -844,6 +844,9 @@ static void NetworkClose()
 {
 	NetworkTCPSocketHandler *cs;
 
+	NetworkReplayStopRecording();
+	NetworkPacketPoolDebugStats();
+
 	FOR_ALL_CLIENTS(cs) {
 		if (!_network_server) {
 			SEND_COMMAND(PACKET_CLIENT_QUIT)("leaving");
@@ -1238,6 +1241,7 @@ static bool NetworkDoClientLoop()
 	NetworkHandleLocalQueue();
 
 	StateGameLoop();
+	NetworkReplayRecordFrame();
 
 	// Check if we are in sync!
 	if (_sync_frame != 0) {
@@ -1294,37 +1298,6 @@ void NetworkGameLoop()
 	if (!NetworkReceive()) return;
 
 	if (_network_server) {
-#ifdef DEBUG_DUMP_COMMANDS
-		static FILE *f = FioFOpenFile("commands.log", "rb", SAVE_DIR);
-		static Date next_date = 0;
-		static uint32 next_date_fract;
-		static CommandPacket *cp = NULL;
-		if (f == NULL && next_date == 0) {
-			printf("Cannot open commands.log\n");
-			next_date = 1;
-		}
-
-		while (f != NULL && !feof(f)) {
-			if (cp != NULL && _date == next_date && _date_fract == next_date_fract) {
-				_current_player = cp->player;
-				_cmd_text = cp->text;
-				DoCommandP(cp->tile, cp->p1, cp->p2, NULL, cp->cmd);
-				free(cp);
-				cp = NULL;
-			}
-
-			if (cp != NULL) break;
-
-			char buff[4096];
-			if (fgets(buff, lengthof(buff), f) == NULL) break;
-			if (strncmp(buff, "ddc:cmd:", 8) != 0) continue;
-			cp = MallocT<CommandPacket>(1);
-			int player;
-			sscanf(&buff[8], "%d;%d;%d;%d;%d;%d;%d;%s", &next_date, &next_date_fract, &player, &cp->tile, &cp->p1, &cp->p2, &cp->cmd, cp->text);
-			cp->player = (Owner)player;
-		}
-#endif /* DEBUG_DUMP_COMMANDS */
-
 		bool send_frame = false;
 
 		// We first increase the _frame_counter
@@ -1344,6 +1317,7 @@ void NetworkGameLoop()
 #ifdef NETWORK_SEND_DOUBLE_SEED
 		_sync_seed_2 = _random.state[1];
 #endif
+		NetworkReplayRecordFrame();
 
 		NetworkServer_Tick(send_frame);
 	} else {
@@ -6,6 +6,7 @@
 #include "../debug.h"
 #include "network_data.h"
 #include "network_client.h"
+#include "network_replay.h"
 #include "../command_func.h"
 #include "../callback_table.h"
 #include "../core/alloc_func.hpp"
@@ -102,6 +103,7 @@ void NetworkExecuteCommand(CommandPacket *cp)
 	}
 
 	DebugDumpCommands("ddc:cmd:%d;%d;%d;%d;%d;%d;%d;%s\n", _date, _date_fract, (int)cp->player, cp->tile, cp->p1, cp->p2, cp->cmd, cp->text);
+	NetworkReplayRecordCommand(cp);
 
 	DoCommandP(cp->tile, cp->p1, cp->p2, _callback_table[cp->callback], cp->cmd | CMD_NETWORK_COMMAND, cp->my_cmd);
 }
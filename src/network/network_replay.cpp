@@ -0,0 +1,373 @@
+/* $Id$ */
+
+/**
+ * @file network_replay.cpp Recording and playback of network command streams.
+ *
+ * A replay consists of the savegame the recording started from, followed by
+ * every command that got executed and the state of the game randomizer at
+ * the end of every frame. Playing it back re-executes the commands at the
+ * frames they were executed on the server, as fast as possible, and checks
+ * the randomizer at every frame; this makes it possible to benchmark real
+ * server workloads offline and to find the first frame of a desync.
+ *
+ * File layout (all values little endian):
+ *   4 bytes  : "OTRP"
+ *   uint16   : REPLAY_VERSION
+ *   uint32   : frame counter at the start of the recording
+ *   uint32   : size of the savegame
+ *   n bytes  : the savegame
+ *   records  : until REPLAY_END or end of file
+ *     REPLAY_COMMAND: uint32 frame, uint8 player, uint32 cmd, uint32 p1, uint32 p2, uint32 tile, uint8 length, text
+ *     REPLAY_SYNC   : uint32 frame, uint32 seed 1, uint32 seed 2
+ */
+
+#ifdef ENABLE_NETWORK
+
+#include "../stdafx.h"
+#include "../debug.h"
+#include "network_data.h"
+#include "network_replay.h"
+#include "../openttd.h"
+#include "../command_func.h"
+#include "../variables.h"
+#include "../date_func.h"
+#include "../player_func.h"
+#include "../saveload.h"
+#include "../fileio.h"
+#include "../settings_type.h"
+#include "../core/bitmath_func.hpp"
+#include "../core/random_func.hpp"
+#include <time.h>
+
+#include "../safeguards.h"
+
+/** Version of the replay format; bump when the layout changes. */
+static const uint16 REPLAY_VERSION = 1;
+/** Name of the temporary file the initial savegame is moved through. */
+static const char * const REPLAY_TEMP_SAVEGAME = "network_replay.tmp";
+
+/** Types of the records following the savegame. */
+enum ReplayRecordType {
+	REPLAY_COMMAND, ///< A command executed at the start of a frame
+	REPLAY_SYNC,    ///< The randomizer state at the end of a frame
+	REPLAY_END,     ///< The recording was stopped properly
+};
+
+static FILE *_replay_file = NULL; ///< File we are currently recording to
+
+extern void StateGameLoop();
+extern bool SafeSaveOrLoad(const char *filename, int mode, int newgm, Subdirectory subdir);
+
+static void ReplayWriteUint8(FILE *f, uint8 v)
+{
+	fputc(v, f);
+}
+
+static void ReplayWriteUint16(FILE *f, uint16 v)
+{
+	ReplayWriteUint8(f, GB(v, 0, 8));
+	ReplayWriteUint8(f, GB(v, 8, 8));
+}
+
+static void ReplayWriteUint32(FILE *f, uint32 v)
+{
+	ReplayWriteUint16(f, GB(v,  0, 16));
+	ReplayWriteUint16(f, GB(v, 16, 16));
+}
+
+/**
+ * Read a byte from the replay.
+ * @param f the file to read from
+ * @param v where to store the value
+ * @return false when the end of the file was reached
+ */
+static bool ReplayReadUint8(FILE *f, uint8 *v)
+{
+	int c = fgetc(f);
+	if (c == EOF) return false;
+	*v = c;
+	return true;
+}
+
+static bool ReplayReadUint16(FILE *f, uint16 *v)
+{
+	uint8 lo, hi;
+	if (!ReplayReadUint8(f, &lo) || !ReplayReadUint8(f, &hi)) return false;
+	*v = lo | hi << 8;
+	return true;
+}
+
+static bool ReplayReadUint32(FILE *f, uint32 *v)
+{
+	uint16 lo, hi;
+	if (!ReplayReadUint16(f, &lo) || !ReplayReadUint16(f, &hi)) return false;
+	*v = lo | hi << 16;
+	return true;
+}
+
+/**
+ * Copy a number of bytes from one file to another.
+ * @param from the file to read from
+ * @param to the file to write to
+ * @param length the number of bytes to copy
+ * @return true when all bytes were copied
+ */
+static bool ReplayCopyBytes(FILE *from, FILE *to, uint32 length)
+{
+	char buf[4096];
+
+	while (length > 0) {
+		size_t n = min(length, (uint32)sizeof(buf));
+		if (fread(buf, 1, n, from) != n) return false;
+		if (fwrite(buf, 1, n, to) != n) return false;
+		length -= (uint32)n;
+	}
+	return true;
+}
+
+/**
+ * Start recording the executed commands to a replay file. The current
+ * game is saved into the replay as the point to start playing from.
+ * @param filename the replay to write, relative to the save directory
+ * @return true when the recording has started
+ */
+bool NetworkReplayStartRecording(const char *filename)
+{
+	NetworkReplayStopRecording();
+
+	if (SaveOrLoad(REPLAY_TEMP_SAVEGAME, SL_SAVE, AUTOSAVE_DIR) != SL_OK) return false;
+	WaitTillSaved();
+
+	FILE *save = FioFOpenFile(REPLAY_TEMP_SAVEGAME, "rb", AUTOSAVE_DIR);
+	if (save == NULL) return false;
+
+	fseek(save, 0, SEEK_END);
+	uint32 length = ftell(save);
+	fseek(save, 0, SEEK_SET);
+
+	FILE *f = FioFOpenFile(filename, "wb", SAVE_DIR);
+	if (f == NULL) {
+		fclose(save);
+		return false;
+	}
+
+	fwrite("OTRP", 1, 4, f);
+	ReplayWriteUint16(f, REPLAY_VERSION);
+	ReplayWriteUint32(f, _frame_counter);
+	ReplayWriteUint32(f, length);
+
+	bool ok = ReplayCopyBytes(save, f, length);
+	fclose(save);
+
+	if (!ok) {
+		fclose(f);
+		return false;
+	}
+
+	_replay_file = f;
+	DEBUG(net, 1, "Started recording replay '%s' at frame %d", filename, _frame_counter);
+	return true;
+}
+
+/** Stop the current recording, if any. */
+void NetworkReplayStopRecording()
+{
+	if (_replay_file == NULL) return;
+
+	ReplayWriteUint8(_replay_file, REPLAY_END);
+	fclose(_replay_file);
+	_replay_file = NULL;
+	DEBUG(net, 1, "Stopped recording replay at frame %d", _frame_counter);
+}
+
+/**
+ * Are we recording a replay?
+ * @return true when commands are being recorded
+ */
+bool NetworkReplayIsRecording()
+{
+	return _replay_file != NULL;
+}
+
+/**
+ * Record a command that is about to be executed in the current frame.
+ * @param cp the command
+ */
+void NetworkReplayRecordCommand(const CommandPacket *cp)
+{
+	if (_replay_file == NULL) return;
+
+	size_t length = min(strlen(cp->text), (size_t)lengthof(cp->text) - 1);
+
+	ReplayWriteUint8(_replay_file, REPLAY_COMMAND);
+	ReplayWriteUint32(_replay_file, _frame_counter);
+	ReplayWriteUint8(_replay_file, cp->player);
+	ReplayWriteUint32(_replay_file, cp->cmd);
+	ReplayWriteUint32(_replay_file, cp->p1);
+	ReplayWriteUint32(_replay_file, cp->p2);
+	ReplayWriteUint32(_replay_file, cp->tile);
+	ReplayWriteUint8(_replay_file, (uint8)length);
+	fwrite(cp->text, 1, length, _replay_file);
+}
+
+/** Record the state of the randomizer at the end of the current frame. */
+void NetworkReplayRecordFrame()
+{
+	if (_replay_file == NULL) return;
+
+	ReplayWriteUint8(_replay_file, REPLAY_SYNC);
+	ReplayWriteUint32(_replay_file, _frame_counter);
+	ReplayWriteUint32(_replay_file, _random.state[0]);
+	ReplayWriteUint32(_replay_file, _random.state[1]);
+}
+
+/**
+ * Read the header of a replay and extract its savegame.
+ * @param f the replay to read from
+ * @param start_frame where to store the frame the recording started at
+ * @return true when the savegame is ready to be loaded
+ */
+static bool ReplayExtractSavegame(FILE *f, uint32 *start_frame)
+{
+	char magic[4];
+	uint16 version;
+	uint32 length;
+
+	if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "OTRP", 4) != 0) {
+		DEBUG(net, 0, "Replay: not a replay file");
+		return false;
+	}
+	if (!ReplayReadUint16(f, &version) || version != REPLAY_VERSION) {
+		DEBUG(net, 0, "Replay: unsupported version");
+		return false;
+	}
+	if (!ReplayReadUint32(f, start_frame) || !ReplayReadUint32(f, &length)) {
+		DEBUG(net, 0, "Replay: truncated header");
+		return false;
+	}
+
+	FILE *save = FioFOpenFile(REPLAY_TEMP_SAVEGAME, "wb", AUTOSAVE_DIR);
+	if (save == NULL) return false;
+
+	bool ok = ReplayCopyBytes(f, save, length);
+	fclose(save);
+
+	if (!ok) DEBUG(net, 0, "Replay: truncated savegame");
+	return ok;
+}
+
+/**
+ * Play a replay at maximum speed, checking the randomizer at every
+ * recorded frame. The game is played as a network client would, so AIs
+ * and other server-only logic do not run; their commands are part of
+ * the recording. Afterwards the replayed game stays loaded with the local
+ * player being a spectator.
+ * @param filename the replay to play, relative to the save directory
+ * @return true when the whole replay was played and stayed in sync
+ */
+bool NetworkReplayPlay(const char *filename)
+{
+	if (_networking) {
+		DEBUG(net, 0, "Replay: cannot play a replay during a network game");
+		return false;
+	}
+
+	FILE *f = FioFOpenFile(filename, "rb", SAVE_DIR);
+	if (f == NULL) f = FioFOpenFile(filename, "rb", BASE_DIR);
+	if (f == NULL) {
+		DEBUG(net, 0, "Replay: cannot open '%s'", filename);
+		return false;
+	}
+
+	uint32 start_frame;
+	if (!ReplayExtractSavegame(f, &start_frame) ||
+			!SafeSaveOrLoad(REPLAY_TEMP_SAVEGAME, SL_LOAD, GM_NORMAL, AUTOSAVE_DIR)) {
+		fclose(f);
+		return false;
+	}
+	_opt_ptr = &_opt;
+
+	PlayerID old_playas = _network_playas;
+	SetLocalPlayer(PLAYER_SPECTATOR);
+	_network_playas = PLAYER_SPECTATOR;
+	_networking = true;
+
+	_frame_counter = start_frame;
+	uint32 executed = start_frame; ///< Last frame of which the game loop has run
+	uint32 commands = 0;
+	bool in_sync = true;
+	bool ended = false;
+	clock_t start = clock();
+
+	for (;;) {
+		uint8 type;
+		uint32 frame;
+		if (!ReplayReadUint8(f, &type)) break;
+		if (type == REPLAY_END) {
+			ended = true;
+			break;
+		}
+		if (type > REPLAY_END || !ReplayReadUint32(f, &frame) || frame <= executed) {
+			DEBUG(net, 0, "Replay: corrupt record after frame %d", executed);
+			in_sync = false;
+			break;
+		}
+
+		/* Catch up on frames without any records */
+		while (executed + 1 < frame) {
+			_frame_counter = ++executed;
+			StateGameLoop();
+		}
+		_frame_counter = frame;
+
+		if (type == REPLAY_COMMAND) {
+			CommandPacket cp;
+			uint8 player, length;
+			if (!ReplayReadUint8(f, &player) || !ReplayReadUint32(f, &cp.cmd) ||
+					!ReplayReadUint32(f, &cp.p1) || !ReplayReadUint32(f, &cp.p2) ||
+					!ReplayReadUint32(f, &cp.tile) || !ReplayReadUint8(f, &length) ||
+					length >= lengthof(cp.text) || fread(cp.text, 1, length, f) != length) {
+				DEBUG(net, 0, "Replay: truncated command at frame %d", frame);
+				break;
+			}
+			cp.text[length] = '\0';
+			cp.player = (Owner)player;
+
+			_current_player = cp.player;
+			_cmd_text = cp.text;
+			DoCommandP(cp.tile, cp.p1, cp.p2, NULL, cp.cmd | CMD_NETWORK_COMMAND, false);
+			commands++;
+		} else {
+			uint32 seed1, seed2;
+			if (!ReplayReadUint32(f, &seed1) || !ReplayReadUint32(f, &seed2)) {
+				DEBUG(net, 0, "Replay: truncated sync record at frame %d", frame);
+				break;
+			}
+
+			StateGameLoop();
+			executed = frame;
+
+			if (seed1 != _random.state[0] || seed2 != _random.state[1]) {
+				DEBUG(net, 0, "Replay: desync at frame %d (date %d, fract %d): expected %08X:%08X, got %08X:%08X",
+						frame, _date, _date_fract, seed1, seed2, _random.state[0], _random.state[1]);
+				in_sync = false;
+				break;
+			}
+		}
+	}
+
+	uint ms = (uint)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+	uint frames = executed - start_frame;
+	DEBUG(net, 0, "Replay: played %d frames and %d commands in %d ms (%d frames/s)%s",
+			frames, commands, ms, ms == 0 ? 0 : (uint)((uint64)frames * 1000 / ms),
+			ended || !in_sync ? "" : ", recording was not stopped properly");
+
+	fclose(f);
+
+	_networking = false;
+	_network_playas = old_playas;
+
+	return in_sync;
+}
+
+#endif /* ENABLE_NETWORK */
@@ -0,0 +1,22 @@
+/* $Id$ */
+
+/** @file network_replay.h Recording and playback of network command streams. */
+
+#ifndef NETWORK_REPLAY_H
+#define NETWORK_REPLAY_H
+
+#ifdef ENABLE_NETWORK
+
+struct CommandPacket;
+
+bool NetworkReplayStartRecording(const char *filename);
+void NetworkReplayStopRecording();
+bool NetworkReplayIsRecording();
+void NetworkReplayRecordCommand(const CommandPacket *cp);
+void NetworkReplayRecordFrame();
+
+bool NetworkReplayPlay(const char *filename);
+
+#endif /* ENABLE_NETWORK */
+
+#endif /* NETWORK_REPLAY_H */
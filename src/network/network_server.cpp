@@ -249,6 +249,7 @@ DEF_SERVER_SEND_COMMAND(PACKET_SERVER_WELCOME)
 
 	cs->status = STATUS_AUTH;
 	_network_game_info.clients_on++;
+	NetworkUDPInvalidateReplyCache();
 
 	p = NetworkSend_Init(PACKET_SERVER_WELCOME);
 	p->Send_uint16(cs->index);
@@ -351,6 +352,7 @@ DEF_SERVER_SEND_COMMAND(PACKET_SERVER_MAP)
 		for (i = 0; i < sent_packets; i++) {
 			Packet *p = NetworkSend_Init(PACKET_SERVER_MAP);
 			p->Send_uint8(MAP_PACKET_NORMAL);
+			p->Reserve(SEND_MTU);
 			res = (int)fread(p->buffer + p->size, 1, SEND_MTU - p->size, file_pointer);
 
 			if (ferror(file_pointer)) error("Error reading temporary network savegame!");
@@ -1406,6 +1408,9 @@ void NetworkUpdateClientInfo(uint16 client_index)
 	FOR_ALL_CLIENTS(cs) {
 		SEND_COMMAND(PACKET_SERVER_CLIENT_INFO)(cs, ci);
 	}
+
+	/* The company of the client might have changed */
+	NetworkUDPInvalidateReplyCache();
 }
 
 /* Check if we want to restart the map */
@@ -58,6 +58,106 @@ DEF_UDP_RECEIVE_COMMAND(Master, PACKET_UDP_MASTER_ACK_REGISTER)
 
 ///*** Communication with clients (we are server) ***/
 
+enum {
+	UDP_REPLY_CACHE_LIFETIME = 5000, ///< time in milliseconds a cached reply to a query is sent before it is rebuilt
+	UDP_NEWGRF_CACHE_SIZE    =   16, ///< number of different NewGRF name requests of which the reply is cached
+	UDP_RATE_LIMIT_WINDOW    = 1000, ///< time in milliseconds over which the queries of an address are counted
+	UDP_RATE_LIMIT_QUERIES   =    8, ///< number of queries an address may do within UDP_RATE_LIMIT_WINDOW
+	UDP_RATE_LIMIT_SLOTS     =  256, ///< number of addresses the rate limiter keeps track of
+};
+
+/** A reply to a query that is sent again to everyone asking the same. */
+struct UDPReplyCache {
+	Packet *packet; ///< The serialised reply, or NULL if it needs to be built
+	uint32 built;   ///< The _realtime_tick at which the reply was built
+};
+
+/** A cached reply to a request for the names of some NewGRFs. */
+struct UDPNewGRFReplyCache : UDPReplyCache {
+	PacketSize request_size; ///< The size of the request
+	byte request[SEND_MTU];  ///< The request (list of GRF identifiers) this is the reply to
+};
+
+/** The queries done recently by an address. */
+struct UDPQuerySource {
+	uint32 ip;           ///< The address (network byte order)
+	uint32 window_start; ///< The _realtime_tick at which the current window started
+	uint queries;        ///< Number of queries done within the current window
+};
+
+static UDPReplyCache _udp_server_response_cache;                     ///< Reply to PACKET_UDP_CLIENT_FIND_SERVER
+static UDPReplyCache _udp_detail_info_cache;                         ///< Reply to PACKET_UDP_CLIENT_DETAIL_INFO
+static UDPNewGRFReplyCache _udp_newgrf_cache[UDP_NEWGRF_CACHE_SIZE]; ///< Replies to PACKET_UDP_CLIENT_GET_NEWGRFS
+static uint _udp_newgrf_cache_next;                                  ///< Entry of _udp_newgrf_cache to replace next
+static UDPQuerySource _udp_query_sources[UDP_RATE_LIMIT_SLOTS];      ///< Rate limiter state, indexed by a hash of the address
+
+/**
+ * Get the cached reply if it is still fresh, otherwise throw it away.
+ * @param cache the cache to look in
+ * @return the reply, or NULL if it has to be rebuilt
+ */
+static Packet *GetCachedReply(UDPReplyCache *cache)
+{
+	if (cache->packet != NULL && _realtime_tick - cache->built >= UDP_REPLY_CACHE_LIFETIME) {
+		delete cache->packet;
+		cache->packet = NULL;
+	}
+	return cache->packet;
+}
+
+/**
+ * Store a freshly built reply in the cache.
+ * @param cache the cache to store it in
+ * @param packet the reply; the cache takes ownership
+ */
+static void SetCachedReply(UDPReplyCache *cache, Packet *packet)
+{
+	delete cache->packet;
+	cache->packet = packet;
+	cache->built  = _realtime_tick;
+}
+
+/**
+ * Throw away all cached replies to queries, so they are rebuilt on the
+ * next query. Call this when the information in the replies changed,
+ * e.g. a client joined or left.
+ */
+void NetworkUDPInvalidateReplyCache()
+{
+	SetCachedReply(&_udp_server_response_cache, NULL);
+	SetCachedReply(&_udp_detail_info_cache, NULL);
+	for (uint i = 0; i < lengthof(_udp_newgrf_cache); i++) {
+		SetCachedReply(&_udp_newgrf_cache[i], NULL);
+	}
+}
+
+/**
+ * Check whether we may answer a query of the given address, i.e. whether
+ * it did not send too many queries recently. Addresses share a slot when
+ * their hash collides, in which case the window is simply restarted.
+ * @param client_addr the address the query came from
+ * @return true if the query may be answered
+ */
+static bool NetworkUDPAllowQuery(const struct sockaddr_in *client_addr)
+{
+	uint32 ip = client_addr->sin_addr.s_addr;
+	UDPQuerySource *source = &_udp_query_sources[(ip ^ (ip >> 8) ^ (ip >> 16) ^ (ip >> 24)) % UDP_RATE_LIMIT_SLOTS];
+
+	if (source->ip != ip || _realtime_tick - source->window_start >= UDP_RATE_LIMIT_WINDOW) {
+		source->ip           = ip;
+		source->window_start = _realtime_tick;
+		source->queries      = 0;
+	}
+
+	if (source->queries >= UDP_RATE_LIMIT_QUERIES) {
+		DEBUG(net, 3, "[udp] ignoring query from '%s', too many queries", inet_ntoa(client_addr->sin_addr));
+		return false;
+	}
+
+	source->queries++;
+	return true;
+}
+
 class ServerNetworkUDPSocketHandler : public NetworkUDPSocketHandler {
 protected:
 	DECLARE_UDP_RECEIVE_COMMAND(PACKET_UDP_CLIENT_FIND_SERVER);
@@ -73,21 +173,27 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_FIND_SERVER)
 	if (!_network_udp_server)
 		return;
 
-	Packet packet(PACKET_UDP_SERVER_RESPONSE);
+	if (!NetworkUDPAllowQuery(client_addr)) return;
+
+	Packet *packet = GetCachedReply(&_udp_server_response_cache);
+	if (packet == NULL) {
+		packet = NetworkSend_Init(PACKET_UDP_SERVER_RESPONSE);
 
-	// Update some game_info
-	_network_game_info.game_date     = _date;
-	_network_game_info.map_width     = MapSizeX();
-	_network_game_info.map_height    = MapSizeY();
-	_network_game_info.map_set       = _opt.landscape;
-	_network_game_info.companies_on  = ActivePlayerCount();
-	_network_game_info.spectators_on = NetworkSpectatorCount();
-	_network_game_info.grfconfig     = _grfconfig;
+		// Update some game_info
+		_network_game_info.game_date     = _date;
+		_network_game_info.map_width     = MapSizeX();
+		_network_game_info.map_height    = MapSizeY();
+		_network_game_info.map_set       = _opt.landscape;
+		_network_game_info.companies_on  = ActivePlayerCount();
+		_network_game_info.spectators_on = NetworkSpectatorCount();
+		_network_game_info.grfconfig     = _grfconfig;
 
-	this->Send_NetworkGameInfo(&packet, &_network_game_info);
+		this->Send_NetworkGameInfo(packet, &_network_game_info);
+		SetCachedReply(&_udp_server_response_cache, packet);
+	}
 
 	// Let the client know that we are here
-	this->SendPacket(&packet, client_addr);
+	this->SendPacket(packet, client_addr);
 
 	DEBUG(net, 2, "[udp] queried from '%s'", inet_ntoa(client_addr->sin_addr));
 }
@@ -97,11 +203,19 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_DETAIL_INFO)
 	// Just a fail-safe.. should never happen
 	if (!_network_udp_server) return;
 
-	Packet packet(PACKET_UDP_SERVER_DETAIL_INFO);
+	if (!NetworkUDPAllowQuery(client_addr)) return;
+
+	Packet *cached = GetCachedReply(&_udp_detail_info_cache);
+	if (cached != NULL) {
+		this->SendPacket(cached, client_addr);
+		return;
+	}
+
+	Packet *packet = NetworkSend_Init(PACKET_UDP_SERVER_DETAIL_INFO);
 
 	/* Send the amount of active companies */
-	packet.Send_uint8 (NETWORK_COMPANY_INFO_VERSION);
-	packet.Send_uint8 (ActivePlayerCount());
+	packet->Send_uint8 (NETWORK_COMPANY_INFO_VERSION);
+	packet->Send_uint8 (ActivePlayerCount());
 
 	/* Fetch the latest version of everything */
 	NetworkPopulateCompanyInfo();
@@ -116,28 +230,29 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_DETAIL_INFO)
 		current++;
 
 		/* Send the information */
-		packet.Send_uint8 (current);
+		packet->Send_uint8 (current);
 
-		packet.Send_string(_network_player_info[player->index].company_name);
-		packet.Send_uint32(_network_player_info[player->index].inaugurated_year);
-		packet.Send_uint64(_network_player_info[player->index].company_value);
-		packet.Send_uint64(_network_player_info[player->index].money);
-		packet.Send_uint64(_network_player_info[player->index].income);
-		packet.Send_uint16(_network_player_info[player->index].performance);
+		packet->Send_string(_network_player_info[player->index].company_name);
+		packet->Send_uint32(_network_player_info[player->index].inaugurated_year);
+		packet->Send_uint64(_network_player_info[player->index].company_value);
+		packet->Send_uint64(_network_player_info[player->index].money);
+		packet->Send_uint64(_network_player_info[player->index].income);
+		packet->Send_uint16(_network_player_info[player->index].performance);
 
 		/* Send 1 if there is a passord for the company else send 0 */
-		packet.Send_bool  (!StrEmpty(_network_player_info[player->index].password));
+		packet->Send_bool  (!StrEmpty(_network_player_info[player->index].password));
 
 		for (int i = 0; i < NETWORK_VEHICLE_TYPES; i++) {
-			packet.Send_uint16(_network_player_info[player->index].num_vehicle[i]);
+			packet->Send_uint16(_network_player_info[player->index].num_vehicle[i]);
 		}
 
 		for (int i = 0; i < NETWORK_STATION_TYPES; i++) {
-			packet.Send_uint16(_network_player_info[player->index].num_station[i]);
+			packet->Send_uint16(_network_player_info[player->index].num_station[i]);
 		}
 	}
 
-	this->SendPacket(&packet, client_addr);
+	SetCachedReply(&_udp_detail_info_cache, packet);
+	this->SendPacket(packet, client_addr);
 }
 
 /**
@@ -152,6 +267,8 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_DETAIL_INFO)
  * would be sent, the packet overflows.
  * in_reply and in_reply_count are used to keep a list of GRFs to
  * send in the reply.
+ * Clients ask for the same sets of NewGRFs over and over, so replies
+ * are cached by the contents of the request.
  */
 DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_GET_NEWGRFS)
 {
@@ -164,6 +281,21 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_GET_NEWGRFS)
 
 	DEBUG(net, 6, "[udp] newgrf data request from %s:%d", inet_ntoa(client_addr->sin_addr), ntohs(client_addr->sin_port));
 
+	if (!NetworkUDPAllowQuery(client_addr)) return;
+
+	/* The request is everything after the packet type */
+	const byte *request = p->buffer + p->pos;
+	PacketSize request_size = p->size - p->pos;
+
+	for (i = 0; i < lengthof(_udp_newgrf_cache); i++) {
+		UDPNewGRFReplyCache *cache = &_udp_newgrf_cache[i];
+		if (GetCachedReply(cache) == NULL || cache->request_size != request_size) continue;
+		if (memcmp(cache->request, request, request_size) != 0) continue;
+
+		this->SendPacket(cache->packet, client_addr);
+		return;
+	}
+
 	num_grfs = p->Recv_uint8 ();
 	if (num_grfs > NETWORK_MAX_GRF_COUNT) return;
 
@@ -191,19 +323,25 @@ DEF_UDP_RECEIVE_COMMAND(Server, PACKET_UDP_CLIENT_GET_NEWGRFS)
 
 	if (in_reply_count == 0) return;
 
-	Packet packet(PACKET_UDP_SERVER_NEWGRFS);
-	packet.Send_uint8(in_reply_count);
+	Packet *packet = NetworkSend_Init(PACKET_UDP_SERVER_NEWGRFS);
+	packet->Send_uint8(in_reply_count);
 	for (i = 0; i < in_reply_count; i++) {
 		char name[NETWORK_GRF_NAME_LENGTH];
 
 		/* The name could be an empty string, if so take the filename */
 		ttd_strlcpy(name, (in_reply[i]->name != NULL && !StrEmpty(in_reply[i]->name)) ?
 				in_reply[i]->name : in_reply[i]->filename, sizeof(name));
-		this->Send_GRFIdentifier(&packet, in_reply[i]);
-		packet.Send_string(name);
+		this->Send_GRFIdentifier(packet, in_reply[i]);
+		packet->Send_string(name);
 	}
 
-	this->SendPacket(&packet, client_addr);
+	UDPNewGRFReplyCache *cache = &_udp_newgrf_cache[_udp_newgrf_cache_next];
+	_udp_newgrf_cache_next = (_udp_newgrf_cache_next + 1) % lengthof(_udp_newgrf_cache);
+	cache->request_size = request_size;
+	memcpy(cache->request, request, request_size);
+	SetCachedReply(cache, packet);
+
+	this->SendPacket(packet, client_addr);
 }
 
 ///*** Communication with servers (we are client) ***/
@@ -371,6 +509,8 @@ void NetworkUDPCloseAll()
 
 	_network_udp_server = false;
 	_network_udp_broadcast = 0;
+
+	NetworkUDPInvalidateReplyCache();
 }
 
 // Broadcast to all ips
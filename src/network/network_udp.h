@@ -12,6 +12,7 @@ void NetworkUDPQueryServer(const char* host, unsigned short port, bool manually
 void NetworkUDPAdvertise();
 void NetworkUDPRemoveAdvertise();
 void NetworkUDPShutdown();
+void NetworkUDPInvalidateReplyCache();
 
 #endif /* ENABLE_NETWORK */
 
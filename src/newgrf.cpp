@@ -47,6 +47,7 @@
 #include "settings_type.h"
 #include "network/network.h"
 #include "map_func.h"
+#include "misc/smallvec.h"
 
 #include "table/strings.h"
 #include "table/sprites.h"
@@ -5631,6 +5632,41 @@ static void MapNewCargoStrings()
 }
 
 
+/* XXX: There is a difference between staged loading in TTDPatch and
+ * here.  In TTDPatch, for some reason actions 1 and 2 are carried out
+ * during stage 1, whilst action 3 is carried out during stage 2 (to
+ * "resolve" cargo IDs... wtf). This is a little problem, because cargo
+ * IDs are valid only within a given set (action 1) block, and may be
+ * overwritten after action 3 associates them. But overwriting happens
+ * in an earlier stage than associating, so...  We just process actions
+ * 1 and 2 in stage 2 now, let's hope that won't get us into problems.
+ * --pasky */
+/* We need a pre-stage to set up GOTO labels of Action 0x10 because the grf
+ * is not in memory and scanning the file every time would be too expensive.
+ * In other stages we skip action 0x10 since it's already dealt with. */
+static const SpecialSpriteHandler _special_sprite_handlers[][GLS_END] = {
+	/* 0x00 */ { NULL,     SafeChangeInfo, NULL,       NULL,           ReserveChangeInfo, FeatureChangeInfo, },
+	/* 0x01 */ { SkipAct1, SkipAct1,  SkipAct1,        SkipAct1,       SkipAct1,          NewSpriteSet, },
+	/* 0x02 */ { NULL,     NULL,      NULL,            NULL,           NULL,              NewSpriteGroup, },
+	/* 0x03 */ { NULL,     GRFUnsafe, NULL,            NULL,           NULL,              FeatureMapSpriteGroup, },
+	/* 0x04 */ { NULL,     NULL,      NULL,            NULL,           NULL,              FeatureNewName, },
+	/* 0x05 */ { SkipAct5, SkipAct5,  SkipAct5,        SkipAct5,       SkipAct5,          GraphicsNew, },
+	/* 0x06 */ { NULL,     NULL,      NULL,            CfgApply,       CfgApply,          CfgApply, },
+	/* 0x07 */ { NULL,     NULL,      NULL,            NULL,           SkipIf,            SkipIf, },
+	/* 0x08 */ { ScanInfo, NULL,      NULL,            GRFInfo,        GRFInfo,           GRFInfo, },
+	/* 0x09 */ { NULL,     NULL,      NULL,            SkipIf,         SkipIf,            SkipIf, },
+	/* 0x0A */ { SkipActA, SkipActA,  SkipActA,        SkipActA,       SkipActA,          SpriteReplace, },
+	/* 0x0B */ { NULL,     NULL,      NULL,            GRFLoadError,   GRFLoadError,      GRFLoadError, },
+	/* 0x0C */ { NULL,     NULL,      NULL,            GRFComment,     NULL,              GRFComment, },
+	/* 0x0D */ { NULL,     SafeParamSet, NULL,         ParamSet,       ParamSet,          ParamSet, },
+	/* 0x0E */ { NULL,     SafeGRFInhibit, NULL,       GRFInhibit,     GRFInhibit,        GRFInhibit, },
+	/* 0x0F */ { NULL,     GRFUnsafe, NULL,            FeatureTownName, NULL,             NULL, },
+	/* 0x10 */ { NULL,     NULL,      DefineGotoLabel, NULL,           NULL,              NULL, },
+	/* 0x11 */ { SkipAct11,GRFUnsafe, SkipAct11,       SkipAct11,      SkipAct11,         GRFSound, },
+	/* 0x12 */ { SkipAct12, SkipAct12, SkipAct12,      SkipAct12,      SkipAct12,         LoadFontGlyph, },
+	/* 0x13 */ { NULL,     NULL,      NULL,            NULL,           NULL,              TranslateGRFStrings, },
+};
+
 /* Here we perform initial decoding of some special sprites (as are they
  * described at http://www.ttdpatch.net/src/newgrf.txt, but this is only a very
  * partial implementation yet). */
@@ -5639,41 +5675,6 @@ static void MapNewCargoStrings()
  * better make this more robust in the future. */
 static void DecodeSpecialSprite(uint num, GrfLoadingStage stage)
 {
-	/* XXX: There is a difference between staged loading in TTDPatch and
-	 * here.  In TTDPatch, for some reason actions 1 and 2 are carried out
-	 * during stage 1, whilst action 3 is carried out during stage 2 (to
-	 * "resolve" cargo IDs... wtf). This is a little problem, because cargo
-	 * IDs are valid only within a given set (action 1) block, and may be
-	 * overwritten after action 3 associates them. But overwriting happens
-	 * in an earlier stage than associating, so...  We just process actions
-	 * 1 and 2 in stage 2 now, let's hope that won't get us into problems.
-	 * --pasky */
-	/* We need a pre-stage to set up GOTO labels of Action 0x10 because the grf
-	 * is not in memory and scanning the file every time would be too expensive.
-	 * In other stages we skip action 0x10 since it's already dealt with. */
-	static const SpecialSpriteHandler handlers[][GLS_END] = {
-		/* 0x00 */ { NULL,     SafeChangeInfo, NULL,       NULL,           ReserveChangeInfo, FeatureChangeInfo, },
-		/* 0x01 */ { SkipAct1, SkipAct1,  SkipAct1,        SkipAct1,       SkipAct1,          NewSpriteSet, },
-		/* 0x02 */ { NULL,     NULL,      NULL,            NULL,           NULL,              NewSpriteGroup, },
-		/* 0x03 */ { NULL,     GRFUnsafe, NULL,            NULL,           NULL,              FeatureMapSpriteGroup, },
-		/* 0x04 */ { NULL,     NULL,      NULL,            NULL,           NULL,              FeatureNewName, },
-		/* 0x05 */ { SkipAct5, SkipAct5,  SkipAct5,        SkipAct5,       SkipAct5,          GraphicsNew, },
-		/* 0x06 */ { NULL,     NULL,      NULL,            CfgApply,       CfgApply,          CfgApply, },
-		/* 0x07 */ { NULL,     NULL,      NULL,            NULL,           SkipIf,            SkipIf, },
-		/* 0x08 */ { ScanInfo, NULL,      NULL,            GRFInfo,        GRFInfo,           GRFInfo, },
-		/* 0x09 */ { NULL,     NULL,      NULL,            SkipIf,         SkipIf,            SkipIf, },
-		/* 0x0A */ { SkipActA, SkipActA,  SkipActA,        SkipActA,       SkipActA,          SpriteReplace, },
-		/* 0x0B */ { NULL,     NULL,      NULL,            GRFLoadError,   GRFLoadError,      GRFLoadError, },
-		/* 0x0C */ { NULL,     NULL,      NULL,            GRFComment,     NULL,              GRFComment, },
-		/* 0x0D */ { NULL,     SafeParamSet, NULL,         ParamSet,       ParamSet,          ParamSet, },
-		/* 0x0E */ { NULL,     SafeGRFInhibit, NULL,       GRFInhibit,     GRFInhibit,        GRFInhibit, },
-		/* 0x0F */ { NULL,     GRFUnsafe, NULL,            FeatureTownName, NULL,             NULL, },
-		/* 0x10 */ { NULL,     NULL,      DefineGotoLabel, NULL,           NULL,              NULL, },
-		/* 0x11 */ { SkipAct11,GRFUnsafe, SkipAct11,       SkipAct11,      SkipAct11,         GRFSound, },
-		/* 0x12 */ { SkipAct12, SkipAct12, SkipAct12,      SkipAct12,      SkipAct12,         LoadFontGlyph, },
-		/* 0x13 */ { NULL,     NULL,      NULL,            NULL,           NULL,              TranslateGRFStrings, },
-	};
-
 	bool preloaded_sprite = true;
 	GRFLocation location(_cur_grfconfig->grfid, _nfo_line);
 	byte *buf;
@@ -5702,18 +5703,295 @@ static void DecodeSpecialSprite(uint num, GrfLoadingStage stage)
 	} else if (action == 0xFE) {
 		grfmsg(7, "DecodeSpecialSprite: Handling import block in stage %d", stage);
 		GRFImportBlock(buf, num);
-	} else if (action >= lengthof(handlers)) {
+	} else if (action >= lengthof(_special_sprite_handlers)) {
 		grfmsg(7, "DecodeSpecialSprite: Skipping unknown action 0x%02X", action);
-	} else if (handlers[action][stage] == NULL) {
+	} else if (_special_sprite_handlers[action][stage] == NULL) {
 		grfmsg(7, "DecodeSpecialSprite: Skipping action 0x%02X in stage %d", action, stage);
 	} else {
 		grfmsg(7, "DecodeSpecialSprite: Handling action 0x%02X in stage %d", action, stage);
-		handlers[action][stage](buf, num);
+		_special_sprite_handlers[action][stage](buf, num);
 	}
 	if (!preloaded_sprite) free(buf);
 }
 
 
+
+/** Location of a single sprite within a NewGRF file, as remembered by a GRFSpriteIndex. */
+struct GRFSpriteIndexEntry {
+	uint32 pos;  ///< Offset of the sprite data (just after the type byte) relative to the first sprite header
+	uint16 num;  ///< Size of the sprite as stored in its header
+	byte type;   ///< Type byte of the sprite; 0xFF for pseudo sprites
+	byte action; ///< First byte of a pseudo sprite, i.e. its action
+};
+
+/**
+ * Positions of all sprites of a NewGRF file. After the first loading stage
+ * this lets us jump straight to the pseudo sprites a stage actually handles,
+ * instead of decoding every real sprite just to find the next header.
+ * Indices are kept in memory and in CACHE_DIR, keyed on the MD5 sum of the
+ * file, so they survive loading another game and restarting OpenTTD.
+ */
+struct GRFSpriteIndex {
+	uint8 md5sum[16];                              ///< MD5 sum of the indexed file
+	uint32 end;                                    ///< Offset of the terminating (empty) sprite header
+	SmallVector<GRFSpriteIndexEntry, 256> sprites; ///< All sprites of the file, in file order
+	GRFSpriteIndex *next;                          ///< Next index in #_grf_sprite_indices
+};
+
+static GRFSpriteIndex *_grf_sprite_indices = NULL;
+
+/**
+ * Header of a sprite index in the cache directory; it is followed by the
+ * entries. The cache is local to the machine, so it is stored in native
+ * byte order.
+ */
+struct GRFSpriteIndexHeader {
+	uint32 magic;   ///< Always #GRF_SPRITE_INDEX_MAGIC
+	uint32 version; ///< Version of the format, #GRF_SPRITE_INDEX_VERSION
+	uint32 end;     ///< See GRFSpriteIndex::end
+	uint32 count;   ///< Number of entries following the header
+};
+
+static const uint32 GRF_SPRITE_INDEX_MAGIC   = 'O' | 'G' << 8 | 'S' << 16 | 'I' << 24; ///< Magic of a cached sprite index
+static const uint32 GRF_SPRITE_INDEX_VERSION = 1;                                     ///< Version of the cached sprite index format
+
+/**
+ * Get the file the sprite index of a NewGRF is cached in.
+ * @param buf    buffer to write the filename to
+ * @param last   last element of the buffer
+ * @param md5sum MD5 sum of the NewGRF
+ */
+static void GetGRFSpriteIndexFilename(char *buf, const char *last, const uint8 *md5sum)
+{
+	char md5[33];
+	md5sumToString(md5, lastof(md5), md5sum);
+	snprintf(buf, last - buf + 1, "%s%s%s.idx", _personal_dir, FioGetSubdirectory(CACHE_DIR), md5);
+}
+
+/**
+ * Try to read the sprite index of a NewGRF from the cache directory.
+ * @param md5sum MD5 sum of the NewGRF
+ * @return the index, or NULL if there was no (usable) cached index
+ */
+static GRFSpriteIndex *ReadGRFSpriteIndex(const uint8 *md5sum)
+{
+	char filename[MAX_PATH];
+	GetGRFSpriteIndexFilename(filename, lastof(filename), md5sum);
+
+	FILE *f = fopen(filename, "rb");
+	if (f == NULL) return NULL;
+
+	GRFSpriteIndexHeader header;
+	if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != GRF_SPRITE_INDEX_MAGIC || header.version != GRF_SPRITE_INDEX_VERSION) {
+		fclose(f);
+		return NULL;
+	}
+
+	GRFSpriteIndex *index = new GRFSpriteIndex();
+	memcpy(index->md5sum, md5sum, sizeof(index->md5sum));
+	index->end = header.end;
+	for (uint i = 0; i < header.count; i++) index->sprites.Append();
+
+	if (fread(index->sprites.Begin(), sizeof(GRFSpriteIndexEntry), header.count, f) != header.count) {
+		delete index;
+		index = NULL;
+	}
+	fclose(f);
+
+	return index;
+}
+
+/**
+ * Store the sprite index of a NewGRF in the cache directory.
+ * Failing to do so is not fatal; the index is simply built again next time.
+ * @param index the index to store
+ */
+static void WriteGRFSpriteIndex(const GRFSpriteIndex *index)
+{
+	char filename[MAX_PATH];
+	GetGRFSpriteIndexFilename(filename, lastof(filename), index->md5sum);
+
+	FILE *f = fopen(filename, "wb");
+	if (f == NULL) {
+		DEBUG(grf, 3, "Could not write sprite index '%s'", filename);
+		return;
+	}
+
+	GRFSpriteIndexHeader header;
+	header.magic   = GRF_SPRITE_INDEX_MAGIC;
+	header.version = GRF_SPRITE_INDEX_VERSION;
+	header.end     = index->end;
+	header.count   = index->sprites.Length();
+
+	if (fwrite(&header, sizeof(header), 1, f) != 1 ||
+			fwrite(index->sprites.Begin(), sizeof(GRFSpriteIndexEntry), header.count, f) != header.count) {
+		DEBUG(grf, 3, "Could not write sprite index '%s'", filename);
+	}
+	fclose(f);
+}
+
+/**
+ * Walk all sprite headers of the currently opened NewGRF to build its index.
+ * The file position is left at the terminating sprite header.
+ * @param md5sum MD5 sum of the NewGRF
+ * @param base   file position of the first sprite header
+ * @return the new index
+ */
+static GRFSpriteIndex *BuildGRFSpriteIndex(const uint8 *md5sum, uint32 base)
+{
+	GRFSpriteIndex *index = new GRFSpriteIndex();
+	memcpy(index->md5sum, md5sum, sizeof(index->md5sum));
+
+	uint16 num;
+	while ((num = FioReadWord()) != 0) {
+		GRFSpriteIndexEntry *e = index->sprites.Append();
+		e->num  = num;
+		e->type = FioReadByte();
+		e->pos  = FioGetPos() - base;
+
+		if (e->type == 0xFF) {
+			e->action = FioReadByte();
+			FioSkipBytes(num - 1);
+		} else {
+			e->action = 0;
+			FioSkipBytes(7);
+			SkipSpriteData(e->type, num - 8);
+		}
+	}
+	index->end = FioGetPos() - 2 - base;
+	index->sprites.Compact();
+
+	return index;
+}
+
+/**
+ * Get the sprite index of the currently opened NewGRF, reading it from the
+ * cache or building it when needed.
+ * @param config the NewGRF
+ * @param base   file position of the first sprite header
+ * @return the index, or NULL if the NewGRF cannot be indexed
+ */
+static const GRFSpriteIndex *GetGRFSpriteIndex(const GRFConfig *config, uint32 base)
+{
+	static const uint8 no_md5sum[16] = { 0 };
+	if (memcmp(config->md5sum, no_md5sum, sizeof(no_md5sum)) == 0) return NULL;
+
+	for (const GRFSpriteIndex *index = _grf_sprite_indices; index != NULL; index = index->next) {
+		if (memcmp(index->md5sum, config->md5sum, sizeof(index->md5sum)) == 0) return index;
+	}
+
+	GRFSpriteIndex *index = ReadGRFSpriteIndex(config->md5sum);
+	if (index != NULL) {
+		/* Make sure the cached index really belongs to this file; the
+		 * first and the terminating sprite headers have to be where the
+		 * index claims they are. */
+		bool valid = index->sprites.Length() == 0 || index->sprites[0].pos == 3;
+		if (valid && index->sprites.Length() != 0) {
+			FioSeekTo(base, SEEK_SET);
+			valid = FioReadWord() == index->sprites[0].num && FioReadByte() == index->sprites[0].type;
+		}
+		if (valid) {
+			FioSeekTo(base + index->end, SEEK_SET);
+			valid = FioReadWord() == 0;
+		}
+		if (!valid) {
+			DEBUG(grf, 1, "Discarding invalid sprite index of '%s'", config->filename);
+			delete index;
+			index = NULL;
+		}
+	}
+
+	if (index == NULL) {
+		FioSeekTo(base, SEEK_SET);
+		index = BuildGRFSpriteIndex(config->md5sum, base);
+		WriteGRFSpriteIndex(index);
+		DEBUG(grf, 3, "Built sprite index of '%s' (%d sprites)", config->filename, index->sprites.Length());
+	}
+
+	FioSeekTo(base, SEEK_SET);
+	index->next = _grf_sprite_indices;
+	_grf_sprite_indices = index;
+	return index;
+}
+
+/**
+ * Find the sprite whose header starts at the given file offset.
+ * @param index  the index to search in
+ * @param offset offset of the sprite header relative to the first sprite header
+ * @return index of the sprite, the number of sprites for the terminating
+ *         header or -1 if there is no sprite header at the given offset
+ */
+static int FindGRFSpriteIndexEntry(const GRFSpriteIndex *index, uint32 offset)
+{
+	if (offset == index->end) return index->sprites.Length();
+
+	uint first = 0;
+	uint last  = index->sprites.Length();
+	while (first < last) {
+		uint mid = (first + last) / 2;
+		uint32 header = index->sprites[mid].pos - 3;
+		if (header == offset) return mid;
+		if (header < offset) {
+			first = mid + 1;
+		} else {
+			last = mid;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Process the sprites of the currently opened NewGRF using its index.
+ * Real sprites and pseudo sprites without a handler in this stage are not
+ * read at all. When a handler moves the file position (loading real sprites
+ * itself or jumping to a label) we continue at the sprite it points to.
+ * @param index the index of the NewGRF
+ * @param base  file position of the first sprite header
+ * @param stage the loading stage
+ * @return false if the file position could not be matched to a sprite
+ *         header; processing then has to continue sequentially from there
+ */
+static bool LoadNewGRFFileFromIndex(const GRFSpriteIndex *index, uint32 base, GrfLoadingStage stage)
+{
+	uint i = 0;
+	while (i < index->sprites.Length()) {
+		const GRFSpriteIndexEntry *e = index->sprites.Get(i);
+		_nfo_line = i + 1;
+
+		if (_skip_sprites != 0 || e->type != 0xFF) {
+			if (e->type != 0xFF && _skip_sprites == 0) grfmsg(7, "LoadNewGRFFile: Skipping unexpected sprite");
+			if (_skip_sprites > 0) _skip_sprites--;
+			i++;
+			continue;
+		}
+
+		/* Action 6 may have changed this sprite, even its action byte. */
+		if (e->action < lengthof(_special_sprite_handlers) && _special_sprite_handlers[e->action][stage] == NULL &&
+				_grf_line_to_action6_sprite_override.find(GRFLocation(_cur_grfconfig->grfid, _nfo_line)) == _grf_line_to_action6_sprite_override.end()) {
+			i++;
+			continue;
+		}
+
+		if (FioGetPos() != base + e->pos) FioSeekTo(base + e->pos, SEEK_SET);
+		DecodeSpecialSprite(e->num, stage);
+
+		/* Stop all processing if we are to skip the remaining sprites */
+		if (_skip_sprites == -1) return true;
+
+		uint32 pos = FioGetPos() - base;
+		if (pos == e->pos + e->num) {
+			i++;
+			continue;
+		}
+
+		int next = FindGRFSpriteIndexEntry(index, pos);
+		if (next < 0) return false;
+		i = next;
+	}
+
+	return true;
+}
+
 void LoadNewGRFFile(GRFConfig *config, uint file_index, GrfLoadingStage stage)
 {
 	const char *filename = config->filename;
@@ -5765,6 +6043,13 @@ void LoadNewGRFFile(GRFConfig *config, uint file_index, GrfLoadingStage stage)
 	_skip_sprites = 0; // XXX
 	_nfo_line = 0;
 
+	/* The file scans happen before the MD5 sum of the file is known. */
+	if (stage >= GLS_LABELSCAN) {
+		uint32 base = FioGetPos();
+		const GRFSpriteIndex *index = GetGRFSpriteIndex(config, base);
+		if (index != NULL && LoadNewGRFFileFromIndex(index, base, stage)) return;
+	}
+
 	while ((num = FioReadWord()) != 0) {
 		byte type = FioReadByte();
 		_nfo_line++;
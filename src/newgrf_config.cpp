@@ -266,6 +266,203 @@ compatible_grf:
 	return res;
 }
 
+/** Details of a scanned file as remembered by the NewGRF scan cache. */
+struct GRFScanCacheEntry {
+	size_t size;       ///< Size of the file (or of the file within its tar)
+	time_t mtime;      ///< Modification time of the file (or of the tar containing it)
+	bool valid;        ///< Whether the file is a usable NewGRF, i.e. FillGRFDetails succeeded
+	uint32 grfid;      ///< GRF ID of the NewGRF
+	uint8 flags;       ///< GCF_Flags the scan set for the NewGRF
+	uint8 md5sum[16];  ///< MD5 sum of the NewGRF
+	bool has_name;     ///< Whether the NewGRF has a name
+	bool has_info;     ///< Whether the NewGRF has a description
+	std::string name;  ///< Name of the NewGRF
+	std::string info;  ///< Description of the NewGRF
+	bool seen;         ///< Whether the file was found during the current scan
+};
+
+typedef std::map<std::string, GRFScanCacheEntry> GRFScanCache;
+
+/**
+ * Details of all files found by previous scans, keyed on their path, so a
+ * scan only has to read and hash the files that were added or changed.
+ */
+static GRFScanCache _grf_scan_cache;
+static bool _grf_scan_cache_loaded = false; ///< Whether the cache file has been read
+
+static const char GRF_SCAN_CACHE_FILENAME[] = "newgrf_scan.dat";                            ///< Name of the cache file in CACHE_DIR
+static const uint32 GRF_SCAN_CACHE_MAGIC    = 'O' | 'G' << 8 | 'S' << 16 | 'C' << 24; ///< Magic of the cache file
+static const uint32 GRF_SCAN_CACHE_VERSION  = 2;                                     ///< Version of the cache file format
+static const uint16 GRF_SCAN_CACHE_NO_STRING = 0xFFFF;                                ///< String length marking a missing string
+
+/* The cache is local to the machine, so it is stored in native byte order. */
+static bool ReadGRFScanCacheString(FILE *f, std::string *str, bool *present)
+{
+	uint16 len;
+	if (fread(&len, sizeof(len), 1, f) != 1) return false;
+
+	*present = len != GRF_SCAN_CACHE_NO_STRING;
+	if (!*present) len = 0;
+
+	str->resize(len);
+	return len == 0 || fread(&(*str)[0], 1, len, f) == len;
+}
+
+static void WriteGRFScanCacheString(FILE *f, const std::string &str, bool present)
+{
+	uint16 len = present ? min<size_t>(str.size(), GRF_SCAN_CACHE_NO_STRING - 1) : GRF_SCAN_CACHE_NO_STRING;
+	fwrite(&len, sizeof(len), 1, f);
+	if (present) fwrite(str.data(), 1, len, f);
+}
+
+/** Read the NewGRF scan cache from the cache directory, if there is one. */
+static void LoadGRFScanCache()
+{
+	_grf_scan_cache_loaded = true;
+
+	char filename[MAX_PATH];
+	snprintf(filename, lengthof(filename), "%s%s%s", _personal_dir, FioGetSubdirectory(CACHE_DIR), GRF_SCAN_CACHE_FILENAME);
+	FILE *f = fopen(filename, "rb");
+	if (f == NULL) return;
+
+	uint32 header[3];
+	if (fread(header, sizeof(header), 1, f) != 1 || header[0] != GRF_SCAN_CACHE_MAGIC || header[1] != GRF_SCAN_CACHE_VERSION) {
+		fclose(f);
+		return;
+	}
+
+	for (uint i = 0; i < header[2]; i++) {
+		std::string path;
+		GRFScanCacheEntry entry;
+		uint32 details[3];
+		bool present;
+		byte valid;
+
+		if (!ReadGRFScanCacheString(f, &path, &present) ||
+				fread(details, sizeof(details), 1, f) != 1 ||
+				fread(&valid, sizeof(valid), 1, f) != 1 ||
+				fread(&entry.flags, sizeof(entry.flags), 1, f) != 1 ||
+				fread(entry.md5sum, sizeof(entry.md5sum), 1, f) != 1 ||
+				!ReadGRFScanCacheString(f, &entry.name, &entry.has_name) ||
+				!ReadGRFScanCacheString(f, &entry.info, &entry.has_info)) {
+			DEBUG(grf, 1, "NewGRF scan cache is corrupt, ignoring it");
+			_grf_scan_cache.clear();
+			break;
+		}
+
+		entry.size  = details[0];
+		entry.mtime = details[1];
+		entry.grfid = details[2];
+		entry.valid = valid != 0;
+		entry.seen  = false;
+		_grf_scan_cache[path] = entry;
+	}
+
+	fclose(f);
+	DEBUG(grf, 2, "Read %d files from the NewGRF scan cache", (int)_grf_scan_cache.size());
+}
+
+/** Write the files found by the last scan to the NewGRF scan cache. */
+static void SaveGRFScanCache()
+{
+	char filename[MAX_PATH];
+	snprintf(filename, lengthof(filename), "%s%s%s", _personal_dir, FioGetSubdirectory(CACHE_DIR), GRF_SCAN_CACHE_FILENAME);
+	FILE *f = fopen(filename, "wb");
+	if (f == NULL) {
+		DEBUG(grf, 1, "Could not write the NewGRF scan cache '%s'", filename);
+		return;
+	}
+
+	uint32 header[3] = { GRF_SCAN_CACHE_MAGIC, GRF_SCAN_CACHE_VERSION, 0 };
+	for (GRFScanCache::const_iterator it = _grf_scan_cache.begin(); it != _grf_scan_cache.end(); it++) {
+		if (it->second.seen) header[2]++;
+	}
+	fwrite(header, sizeof(header), 1, f);
+
+	for (GRFScanCache::const_iterator it = _grf_scan_cache.begin(); it != _grf_scan_cache.end(); it++) {
+		const GRFScanCacheEntry &entry = it->second;
+		if (!entry.seen) continue;
+
+		uint32 details[3] = { (uint32)entry.size, (uint32)entry.mtime, entry.grfid };
+		byte valid = entry.valid;
+
+		WriteGRFScanCacheString(f, it->first, true);
+		fwrite(details, sizeof(details), 1, f);
+		fwrite(&valid, sizeof(valid), 1, f);
+		fwrite(&entry.flags, sizeof(entry.flags), 1, f);
+		fwrite(entry.md5sum, sizeof(entry.md5sum), 1, f);
+		WriteGRFScanCacheString(f, entry.name, entry.has_name);
+		WriteGRFScanCacheString(f, entry.info, entry.has_info);
+	}
+
+	fclose(f);
+}
+
+/**
+ * Get the size and modification time a scanned file is cached by.
+ * Files within tars use their own size and the modification time of the tar.
+ * @param filename the filename as given to the scanner
+ * @param size     the size of the file is written here
+ * @param mtime    the modification time is written here
+ * @return true if the file could be found
+ */
+static bool GetGRFScanCacheKey(const char *filename, size_t *size, time_t *mtime)
+{
+	TarFileList::iterator it = _tar_filelist.find(filename);
+	if (it == _tar_filelist.end()) return FioGetFileStat(filename, size, mtime);
+
+	size_t tar_size;
+	if (!FioGetFileStat(it->second.tar_filename, &tar_size, mtime)) return false;
+	*size = it->second.size;
+	return true;
+}
+
+/**
+ * Fill the details of a scanned NewGRF from the scan cache, or find them
+ * the hard way and remember them if the file is new or has changed.
+ * @param config   the NewGRF to fill the details of
+ * @param filename the filename as given to the scanner
+ * @return what FillGRFDetails returns for the file
+ */
+static bool FillGRFDetailsCached(GRFConfig *config, const char *filename)
+{
+	size_t size;
+	time_t mtime;
+	if (!GetGRFScanCacheKey(filename, &size, &mtime)) return FillGRFDetails(config, false);
+
+	GRFScanCache::iterator it = _grf_scan_cache.find(filename);
+	if (it != _grf_scan_cache.end() && it->second.size == size && it->second.mtime == mtime) {
+		GRFScanCacheEntry &entry = it->second;
+		entry.seen = true;
+		if (!entry.valid) return false;
+
+		config->grfid = entry.grfid;
+		config->flags = entry.flags;
+		memcpy(config->md5sum, entry.md5sum, sizeof(config->md5sum));
+		if (entry.has_name) config->name = strdup(entry.name.c_str());
+		if (entry.has_info) config->info = strdup(entry.info.c_str());
+		return true;
+	}
+
+	DEBUG(grf, 3, "Scanning new or changed NewGRF '%s'", filename);
+	bool valid = FillGRFDetails(config, false);
+
+	GRFScanCacheEntry &entry = _grf_scan_cache[filename];
+	entry.size     = size;
+	entry.mtime    = mtime;
+	entry.valid    = valid;
+	entry.grfid    = config->grfid;
+	entry.flags    = config->flags;
+	memcpy(entry.md5sum, config->md5sum, sizeof(entry.md5sum));
+	entry.has_name = config->name != NULL;
+	entry.has_info = config->info != NULL;
+	entry.name     = entry.has_name ? config->name : "";
+	entry.info     = entry.has_info ? config->info : "";
+	entry.seen     = true;
+
+	return valid;
+}
+
 /** Helper for scanning for files with GRF as extension */
 class GRFFileScanner : FileScanner {
 public:
@@ -285,7 +482,7 @@ bool GRFFileScanner::AddFile(const char *filename, size_t basepath_length)
 	c->filename = strdup(filename + basepath_length);
 
 	bool added = true;
-	if (FillGRFDetails(c, false)) {
+	if (FillGRFDetailsCached(c, filename)) {
 		if (_all_grfs == NULL) {
 			_all_grfs = c;
 		} else {
@@ -345,10 +542,16 @@ void ScanNewGRFFiles()
 {
 	ClearGRFConfigList(&_all_grfs);
 
+	if (!_grf_scan_cache_loaded) LoadGRFScanCache();
+	for (GRFScanCache::iterator it = _grf_scan_cache.begin(); it != _grf_scan_cache.end(); it++) {
+		it->second.seen = false;
+	}
+
 	DEBUG(grf, 1, "Scanning for NewGRFs");
 	uint num = GRFFileScanner::DoScan();
 
 	DEBUG(grf, 1, "Scan complete, found %d files", num);
+	SaveGRFScanCache();
 	if (num == 0 || _all_grfs == NULL) return;
 
 	/* Sort the linked list using quicksort.
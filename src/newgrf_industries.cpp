@@ -149,19 +149,6 @@ uint32 GetIndustryIDAtOffset(TileIndex tile, const Industry *i)
 	return 0xFF << 8 | indtsp->grf_prop.subst_id; // so just give him the substitute
 }
 
-static uint32 GetClosestIndustry(TileIndex tile, IndustryType type, const Industry *current)
-{
-	uint32 best_dist = MAX_UVALUE(uint32);
-	const Industry *i;
-	FOR_ALL_INDUSTRIES(i) {
-		if (i->type != type || i == current) continue;
-
-		best_dist = min(best_dist, DistanceManhattan(tile, i->xy));
-	}
-
-	return best_dist;
-}
-
 /** Implementation of both var 67 and 68
  * since the mechanism is almost the same, it is easier to regroup them on the same
  * function.
@@ -196,7 +183,7 @@ static uint32 GetCountAndDistanceOfClosestInstance(byte param_setID, byte layout
 	if (layout_filter == 0) {
 		/* If the filter is 0, it could be because none was specified as well as being really a 0.
 		 * In either case, just do the regular var67 */
-		closest_dist = GetClosestIndustry(current->xy, ind_index, current);
+		closest_dist = GetClosestIndustryDistance(current->xy, ind_index, current);
 		count = GetIndustryTypeCount(ind_index);
 	} else {
 		/* Count only those who match the same industry type and layout filter
@@ -318,7 +305,7 @@ uint32 IndustryGetVariable(const ResolverObject *object, byte variable, byte par
 			return 0xFFFFFFFF;
 
 		/* Distance of nearest industry of given type */
-		case 0x64: return GetClosestIndustry(tile, MapNewGRFIndustryType(parameter, indspec->grf_prop.grffile->grfid), industry);
+		case 0x64: return GetClosestIndustryDistance(tile, MapNewGRFIndustryType(parameter, indspec->grf_prop.grffile->grfid), industry);
 		/* Get town zone and Manhattan distance of closest town */
  		case 0x65: return GetTownRadiusGroup(industry->town, tile) << 16 | min(DistanceManhattan(tile, industry->town->xy), 0xFFFF);
 		/* Get square of Euclidian distance of closes town */
@@ -38,6 +38,7 @@
 #include "screenshot.h"
 #include "network/network.h"
 #include "network/network_internal.h"
+#include "network/network_replay.h"
 #include "signs.h"
 #include "depot.h"
 #include "waypoint.h"
@@ -156,6 +157,7 @@ static void ShowHelp()
 		"  -n [ip:port#player] = Start networkgame\n"
 		"  -D [ip][:port]      = Start dedicated server\n"
 		"  -l ip[:port]        = Redirect DEBUG()\n"
+		"  -R replay           = Play a network replay at full speed and quit\n"
 #if !defined(__MORPHOS__) && !defined(__AMIGA__) && !defined(WIN32)
 		"  -f                  = Fork into the background (dedicated only)\n"
 #endif
@@ -348,7 +350,9 @@ int ttd_main(int argc, char *argv[])
 	char *debuglog_conn = NULL;
 	char *dedicated_host = NULL;
 	uint16 dedicated_port = 0;
+	const char *replay_file = NULL;
 #endif /* ENABLE_NETWORK */
+	int ret = 0;
 
 	musicdriver[0] = sounddriver[0] = videodriver[0] = blitter[0] = '\0';
 
@@ -362,7 +366,7 @@ int ttd_main(int argc, char *argv[])
 	 *   a letter means: it accepts that param (e.g.: -h)
 	 *   a ':' behind it means: it need a param (e.g.: -m<driver>)
 	 *   a '::' behind it means: it can optional have a param (e.g.: -d<debug>) */
-	optformat = "m:s:v:b:hD::n::eit:d::r:g::G:c:xl:"
+	optformat = "m:s:v:b:hD::n::eit:d::r:g::G:c:xl:R:"
 #if !defined(__MORPHOS__) && !defined(__AMIGA__) && !defined(WIN32)
 		"f"
 #endif
@@ -401,6 +405,9 @@ int ttd_main(int argc, char *argv[])
 		case 'l':
 			debuglog_conn = mgo.opt;
 			break;
+		case 'R':
+			replay_file = mgo.opt;
+			break;
 #endif /* ENABLE_NETWORK */
 		case 'r': ParseResolution(resolution, mgo.opt); break;
 		case 't': startyear = atoi(mgo.opt); break;
@@ -614,11 +621,18 @@ int ttd_main(int argc, char *argv[])
 			NetworkClientConnectGame(network_conn, rport);
 		}
 	}
-#endif /* ENABLE_NETWORK */
 
-	_video_driver->MainLoop();
+	if (replay_file != NULL) {
+		/* Play the replay without ever entering the main loop; the exit code tells whether it stayed in sync */
+		if (!NetworkReplayPlay(replay_file)) ret = 1;
+	} else
+#endif /* ENABLE_NETWORK */
+	{
+		_video_driver->MainLoop();
+	}
 
 	WaitTillSaved();
+	WaitTillMapExported();
 	IConsoleFree();
 
 	if (_network_available) NetworkShutDown(); // Shut down the network and close any open connections
@@ -642,7 +656,7 @@ int ttd_main(int argc, char *argv[])
 	/* Close all and any open filehandles */
 	FioCloseAll();
 
-	return 0;
+	return ret;
 }
 
 void HandleExitGameRequest()
@@ -1106,6 +1120,7 @@ void GameLoop()
 	ThreadMsg message;
 
 	if ((message = OTTD_PollThreadEvent()) != 0) ProcessSentMessage(message);
+	PollMapExport();
 
 	/* autosave game? */
 	if (_do_autosave) {
@@ -1302,18 +1317,20 @@ static bool InitializeWindowsAndCaches()
 
 	/* Update coordinates of the signs. */
 	UpdateAllStationVirtCoord();
+	RebuildStationAcceptanceIndex();
+	RebuildStationRatingSchedule();
 	UpdateAllSignVirtCoords();
 	UpdateAllTownVirtCoords();
 	UpdateAllWaypointSigns();
 
-	/* Recalculate */
-	Group *g;
-	FOR_ALL_GROUPS(g) {
+	/* Recalculate the engine counts of the groups, in one pass over the vehicles */
+	{
 		const Vehicle *v;
 		FOR_ALL_VEHICLES(v) {
-			if (!IsEngineCountable(v)) continue;
+			if (!IsEngineCountable(v) || !IsValidGroupID(v->group_id)) continue;
 
-			if (v->group_id != g->index || v->type != g->vehicle_type || v->owner != g->owner) continue;
+			Group *g = GetGroup(v->group_id);
+			if (v->type != g->vehicle_type || v->owner != g->owner) continue;
 
 			g->num_engines[v->engine_type]++;
 		}
@@ -2506,6 +2523,7 @@ void ReloadNewGRFData()
 	AfterLoadStations();
 	/* Check and update house and town values */
 	UpdateHousesAndTowns();
+	RebuildStationAcceptanceIndex();
 	/* redraw the whole screen */
 	MarkWholeScreenDirty();
 	CheckTrainsLengths();
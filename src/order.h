@@ -11,6 +11,7 @@
 #include "vehicle_type.h"
 #include "tile_type.h"
 #include "date_type.h"
+#include <map>
 
 enum {
 	INVALID_VEH_ORDER_ID = 0xFF,
@@ -209,6 +210,7 @@ static inline Order UnpackOrder(uint32 packed)
 void BackupVehicleOrders(const Vehicle *v, BackuppedOrders *order = &_backup_orders_data);
 void RestoreVehicleOrders(const Vehicle *v, const BackuppedOrders *order = &_backup_orders_data);
 void RemoveOrderFromAllVehicles(OrderType type, DestinationID destination);
+void MoveVehicleInOrderDestinationIndex(const Vehicle *from, const Vehicle *to);
 void InvalidateVehicleOrder(const Vehicle *v);
 bool VehicleHasDepotOrders(const Vehicle *v);
 void CheckOrders(const Vehicle*);
@@ -218,6 +220,11 @@ bool ProcessOrders(Vehicle *v);
 
 Order UnpackOldOrder(uint16 packed);
 
+/** The vehicles with orders to a destination, with the number of those orders each vehicle has. */
+typedef std::map<VehicleID, uint> OrderDestinationVehicles;
+
+const OrderDestinationVehicles *GetVehiclesWithOrdersTo(OrderType type, DestinationID destination);
+
 #define MIN_SERVINT_PERCENT  5
 #define MAX_SERVINT_PERCENT 90
 #define MIN_SERVINT_DAYS    30
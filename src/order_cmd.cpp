@@ -24,6 +24,7 @@
 #include "string_func.h"
 #include "timetable.h"
 #include "vehicle_func.h"
+#include <set>
 
 #include "table/strings.h"
 
@@ -146,6 +147,115 @@ static void DeleteOrderWarnings(const Vehicle* v)
 }
 
 
+/*
+ * The order destination index; for each order type and destination the
+ * vehicles that have such orders in their order list. Vehicles sharing an
+ * order list are all in there. It is built when it is first needed.
+ */
+typedef std::map<uint32, OrderDestinationVehicles> OrderDestinationIndex;
+static OrderDestinationIndex _order_destination_index;
+static bool _order_destination_index_valid = false;
+
+static inline uint32 GetOrderDestinationKey(OrderType type, DestinationID destination)
+{
+	return type << 16 | destination;
+}
+
+/**
+ * Add or remove an order of a vehicle to/from the order destination index.
+ * @param v     the vehicle having the order in its order list
+ * @param order the order
+ * @param add   whether to add or to remove the order
+ */
+static void UpdateOrderDestinationIndex(const Vehicle *v, const Order *order, bool add)
+{
+	if (!_order_destination_index_valid) return;
+
+	switch (order->type) {
+		case OT_GOTO_STATION:
+		case OT_GOTO_DEPOT:
+		case OT_GOTO_WAYPOINT:
+			break;
+
+		default: return;
+	}
+
+	uint32 key = GetOrderDestinationKey(order->type, order->dest);
+	if (add) {
+		_order_destination_index[key][v->index]++;
+		return;
+	}
+
+	OrderDestinationIndex::iterator vehicles = _order_destination_index.find(key);
+	assert(vehicles != _order_destination_index.end());
+	OrderDestinationVehicles::iterator count = vehicles->second.find(v->index);
+	assert(count != vehicles->second.end());
+
+	if (--count->second != 0) return;
+	vehicles->second.erase(count);
+	if (vehicles->second.empty()) _order_destination_index.erase(vehicles);
+}
+
+/**
+ * Add or remove all orders of the order list of a vehicle to/from the
+ * order destination index.
+ * @param v   the vehicle
+ * @param add whether to add or to remove the orders
+ */
+static void UpdateOrderDestinationIndex(const Vehicle *v, bool add)
+{
+	if (!_order_destination_index_valid) return;
+
+	const Order *order;
+	FOR_VEHICLE_ORDERS(v, order) UpdateOrderDestinationIndex(v, order, add);
+}
+
+/** Forget the order destination index; it gets rebuilt when it is needed. */
+static void ResetOrderDestinationIndex()
+{
+	_order_destination_index.clear();
+	_order_destination_index_valid = false;
+}
+
+/** Make sure the order destination index exists, building it from all vehicles when needed. */
+static void BuildOrderDestinationIndex()
+{
+	if (_order_destination_index_valid) return;
+
+	_order_destination_index_valid = true;
+
+	const Vehicle *v;
+	FOR_ALL_VEHICLES(v) UpdateOrderDestinationIndex(v, true);
+}
+
+/**
+ * Get the vehicles that have orders to a destination in their order list.
+ * The vehicles are sorted by their index.
+ * @param type        the type of the orders (OT_GOTO_[STATION|DEPOT|WAYPOINT])
+ * @param destination the destination
+ * @return the vehicles, or NULL if there are none
+ */
+const OrderDestinationVehicles *GetVehiclesWithOrdersTo(OrderType type, DestinationID destination)
+{
+	BuildOrderDestinationIndex();
+
+	OrderDestinationIndex::const_iterator vehicles = _order_destination_index.find(GetOrderDestinationKey(type, destination));
+	return vehicles == _order_destination_index.end() ? NULL : &vehicles->second;
+}
+
+/**
+ * Hand the order list of a vehicle over to another vehicle in the order
+ * destination index, as the first vehicle is going to lose its orders.
+ * @param from the vehicle that still has the order list
+ * @param to   the vehicle that gets the order list
+ */
+void MoveVehicleInOrderDestinationIndex(const Vehicle *from, const Vehicle *to)
+{
+	UpdateOrderDestinationIndex(from, false);
+	UpdateOrderDestinationIndex(to, true);
+}
+
+
 static TileIndex GetOrderLocation(const Order& o)
 {
 	switch (o.type) {
@@ -397,6 +507,7 @@ CommandCost CmdInsertOrder(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 			if (u->orders == NULL) u->orders = v->orders;
 
 			assert(v->orders == u->orders);
+			UpdateOrderDestinationIndex(u, &new_order, true);
 
 			/* If there is added an order before the current one, we need
 			to update the selected order */
@@ -477,6 +588,10 @@ CommandCost CmdDeleteOrder(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 	if (order == NULL) return CMD_ERROR;
 
 	if (flags & DC_EXEC) {
+		for (u = GetFirstVehicleFromSharedList(v); u != NULL; u = u->next_shared) {
+			UpdateOrderDestinationIndex(u, order, false);
+		}
+
 		if (GetVehicleOrder(v, sel_ord - 1) == NULL) {
 			if (GetVehicleOrder(v, sel_ord + 1) != NULL) {
 				/* First item, but not the last, so we need to alter v->orders
@@ -792,6 +907,7 @@ CommandCost CmdCloneOrder(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 
 				dst->orders = src->orders;
 				dst->num_orders = src->num_orders;
+				UpdateOrderDestinationIndex(dst, true);
 
 				/* Link this vehicle in the shared-list */
 				dst->next_shared = src->next_shared;
@@ -858,6 +974,7 @@ CommandCost CmdCloneOrder(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 				}
 
 				dst->num_orders = src->num_orders;
+				UpdateOrderDestinationIndex(dst, true);
 
 				InvalidateVehicleOrder(dst);
 
@@ -1148,6 +1265,7 @@ void CheckOrders(const Vehicle* v)
 
 /**
  * Removes an order from all vehicles. Triggers when, say, a station is removed.
+ * Only the order lists of the vehicles in the order destination index are searched.
  * @param type The type of the order (OT_GOTO_[STATION|DEPOT|WAYPOINT]).
  * @param destination The destination. Can be a StationID, DepotID or WaypointID.
  */
@@ -1162,7 +1280,6 @@ void RemoveOrderFromAllVehicles(OrderType type, DestinationID destination)
 	/* Go through all vehicles */
 	FOR_ALL_VEHICLES(v) {
 		Order *order;
-		bool invalidate;
 
 		/* Forget about this station if this station is removed */
 		if (v->last_station_visited == destination && type == OT_GOTO_STATION) {
@@ -1176,23 +1293,44 @@ void RemoveOrderFromAllVehicles(OrderType type, DestinationID destination)
 			order->flags = 0;
 			InvalidateWindow(WC_VEHICLE_VIEW, v->index);
 		}
+	}
+
+	/* Find the (first vehicles of the) order lists with orders to the destination */
+	std::set<VehicleID> lists;
+	const OrderDestinationVehicles *vehicles = GetVehiclesWithOrdersTo(type, destination);
+	if (vehicles != NULL) {
+		for (OrderDestinationVehicles::const_iterator it = vehicles->begin(); it != vehicles->end(); it++) {
+			v = GetVehicle(it->first);
+			if (type != OT_GOTO_DEPOT || v->type != VEH_AIRCRAFT) lists.insert(GetFirstVehicleFromSharedList(v)->index);
+		}
+	}
+	vehicles = (type == OT_GOTO_STATION) ? GetVehiclesWithOrdersTo(OT_GOTO_DEPOT, destination) : NULL;
+	if (vehicles != NULL) {
+		for (OrderDestinationVehicles::const_iterator it = vehicles->begin(); it != vehicles->end(); it++) {
+			v = GetVehicle(it->first);
+			if (v->type == VEH_AIRCRAFT) lists.insert(GetFirstVehicleFromSharedList(v)->index);
+		}
+	}
+
+	for (std::set<VehicleID>::const_iterator it = lists.begin(); it != lists.end(); it++) {
+		Vehicle *first = GetVehicle(*it);
+		Vehicle *w;
+		Order *order;
+
+		for (w = first; w != NULL; w = w->next_shared) UpdateOrderDestinationIndex(w, false);
 
 		/* Clear the order from the order-list */
-		invalidate = false;
-		FOR_VEHICLE_ORDERS(v, order) {
-			if ((v->type == VEH_AIRCRAFT && order->type == OT_GOTO_DEPOT ? OT_GOTO_STATION : order->type) == type &&
+		FOR_VEHICLE_ORDERS(first, order) {
+			if ((first->type == VEH_AIRCRAFT && order->type == OT_GOTO_DEPOT ? OT_GOTO_STATION : order->type) == type &&
 					order->dest == destination) {
 				order->type = OT_DUMMY;
 				order->flags = 0;
-				invalidate = true;
 			}
 		}
 
-		/* Only invalidate once, and if needed */
-		if (invalidate) {
-			for (const Vehicle *w = GetFirstVehicleFromSharedList(v); w != NULL; w = w->next_shared) {
-				InvalidateVehicleOrder(w);
-			}
+		for (w = first; w != NULL; w = w->next_shared) {
+			UpdateOrderDestinationIndex(w, true);
+			InvalidateVehicleOrder(w);
 		}
 	}
 }
@@ -1224,6 +1362,7 @@ bool VehicleHasDepotOrders(const Vehicle *v)
 void DeleteVehicleOrders(Vehicle *v)
 {
 	DeleteOrderWarnings(v);
+	UpdateOrderDestinationIndex(v, false);
 
 	/* If we have a shared order-list, don't delete the list, but just
 	    remove our pointer */
@@ -1416,6 +1555,7 @@ void InitializeOrders()
 {
 	_Order_pool.CleanPool();
 	_Order_pool.AddBlockToPool();
+	ResetOrderDestinationIndex();
 
 	_backup_orders_tile = 0;
 }
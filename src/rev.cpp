@@ -37,7 +37,7 @@ bool IsReleasedVersion()
  *
  * <modified> shows a "M", if the binary is made from modified source code.
  */
-const char _openttd_revision[] = "norev000";
+const char _openttd_revision[] = "20261019-g7b0137a7fd";
 
 /**
  * The text version of OpenTTD's build date.
@@ -50,7 +50,7 @@ const char _openttd_build_date[] = __DATE__ " " __TIME__;
 /**
  * The git revision hash of this version.
  */
-const char _openttd_revision_hash[] = "";
+const char _openttd_revision_hash[] = "2";
 
 /**
  * Let us know if current build was modified. This detection
@@ -81,5 +81,5 @@ const uint32 _openttd_newgrf_version = 0 << 28 | 6 << 24 | 2 << 20 | 0 << 19;
 /**
  * Variable used by MorphOS to show the version.
  */
-extern const char morphos_versions_tag[] = "$VER: OpenTTD norev000 (10.11.21) OpenTTD Team [MorphOS, PowerPC]";
+extern const char morphos_versions_tag[] = "$VER: OpenTTD 20261019-g7b0137a7fd (19.10.26) OpenTTD Team [MorphOS, PowerPC]";
 #endif
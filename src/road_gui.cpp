@@ -946,10 +946,12 @@ static const WindowDesc _rv_station_picker_desc = {
 
 static void ShowRVStationPicker(RoadStop::Type rs)
 {
-	Window *w = AllocateWindowDesc(&_rv_station_picker_desc);
+	WindowDesc desc = _rv_station_picker_desc;
+	desc.cls = (rs == RoadStop::BUS) ? WC_BUS_STATION : WC_TRUCK_STATION;
+
+	Window *w = AllocateWindowDesc(&desc);
 	if (w == NULL) return;
 
-	w->window_class = (rs == RoadStop::BUS) ? WC_BUS_STATION : WC_TRUCK_STATION;
 	w->widget[BRSW_CAPTION].data = _road_type_infos[_cur_roadtype].picker_title[rs];
 	for (uint i = BRSW_STATION_NE; i < BRSW_LT_OFF; i++) w->widget[i].tooltips = _road_type_infos[_cur_roadtype].picker_tooltip[rs];
 }
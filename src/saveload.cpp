@@ -33,6 +33,7 @@
 #include "date_func.h"
 #include "autoreplace_base.h"
 #include <list>
+#include <deque>
 
 #include "table/strings.h"
 
@@ -709,6 +710,57 @@ void SlList(void *list, SLRefType conv)
 }
 
 
+/**
+ * Return the size in bytes of a deque
+ * @param deque The std::deque to find the size of
+ */
+static inline size_t SlCalcDequeLen(const void *deque)
+{
+	const std::deque<void *> *l = (const std::deque<void *> *) deque;
+
+	int type_size = CheckSavegameVersion(69) ? 2 : 4;
+	/* Each entry is saved as type_size bytes, plus type_size bytes are used for the length
+	 * of the deque; the same format as a list */
+	return l->size() * type_size + type_size;
+}
+
+
+/**
+ * Save/Load a deque; stored in the same format as a list.
+ * @param deque The deque being manipulated
+ * @param conv SLRefType type of the deque (Vehicle *, Station *, etc)
+ */
+void SlDeque(void *deque, SLRefType conv)
+{
+	/* Automatically calculate the length? */
+	if (_sl.need_length != NL_NONE) {
+		SlSetLength(SlCalcDequeLen(deque));
+		/* Determine length only? */
+		if (_sl.need_length == NL_CALCLENGTH) return;
+	}
+
+	std::deque<void *> *l = (std::deque<void *> *) deque;
+
+	if (_sl.save) {
+		SlWriteUint32(l->size());
+
+		std::deque<void *>::iterator iter;
+		for (iter = l->begin(); iter != l->end(); ++iter) {
+			void *ptr = *iter;
+			SlWriteUint32(ReferenceToInt(ptr, conv));
+		}
+	} else {
+		uint length = CheckSavegameVersion(69) ? SlReadUint16() : SlReadUint32();
+
+		/* Load each reference and push to the end of the deque */
+		for (uint i = 0; i < length; i++) {
+			void *ptr = IntToReference(CheckSavegameVersion(69) ? SlReadUint16() : SlReadUint32(), conv);
+			l->push_back(ptr);
+		}
+	}
+}
+
+
 /** Are we going to save this object or not? */
 static inline bool SlIsObjectValidInSavegame(const SaveLoad *sld)
 {
@@ -758,6 +810,7 @@ size_t SlCalcObjMemberLength(const void *object, const SaveLoad *sld)
 		case SL_ARR:
 		case SL_STR:
 		case SL_LST:
+		case SL_DEQUE:
 			/* CONDITIONAL saveload types depend on the savegame version */
 			if (!SlIsObjectValidInSavegame(sld)) break;
 
@@ -767,6 +820,7 @@ size_t SlCalcObjMemberLength(const void *object, const SaveLoad *sld)
 			case SL_ARR: return SlCalcArrayLen(sld->length, sld->conv);
 			case SL_STR: return SlCalcStringLen(GetVariableAddress(object, sld), sld->length, sld->conv);
 			case SL_LST: return SlCalcListLen(GetVariableAddress(object, sld));
+			case SL_DEQUE: return SlCalcDequeLen(GetVariableAddress(object, sld));
 			default: NOT_REACHED();
 			}
 			break;
@@ -787,6 +841,7 @@ bool SlObjectMember(void *ptr, const SaveLoad *sld)
 	case SL_ARR:
 	case SL_STR:
 	case SL_LST:
+	case SL_DEQUE:
 		/* CONDITIONAL saveload types depend on the savegame version */
 		if (!SlIsObjectValidInSavegame(sld)) return false;
 		if (SlSkipVariableOnLoad(sld)) return false;
@@ -803,6 +858,7 @@ bool SlObjectMember(void *ptr, const SaveLoad *sld)
 		case SL_ARR: SlArray(ptr, sld->length, conv); break;
 		case SL_STR: SlString(ptr, sld->length, conv); break;
 		case SL_LST: SlList(ptr, (SLRefType)conv); break;
+		case SL_DEQUE: SlDeque(ptr, (SLRefType)conv); break;
 		default: NOT_REACHED();
 		}
 		break;
@@ -22,6 +22,8 @@
 #include "gui.h"
 #include "window_gui.h"
 #include "window_func.h"
+#include "thread.h"
+#include "console.h"
 
 #include "table/strings.h"
 
@@ -46,6 +48,85 @@ struct ScreenshotFormat {
 	ScreenshotHandlerProc *proc;
 };
 
+/* called by GenerateScreenshotLines to write a block of generated lines to the image file. */
+typedef bool ScreenshotWriteProc(void *writer, void *buf, uint n);
+
+/** A block of generated lines that is being written to the image file. */
+struct ScreenshotWriteJob {
+	ScreenshotWriteProc *proc; ///< function doing the writing
+	void *writer;              ///< data of the image format writing the lines
+	void *buf;                 ///< the lines to write
+	uint n;                    ///< number of lines in buf
+	bool result;               ///< whether all blocks so far were written successfully
+};
+
+static void *ScreenshotWriteThread(void *arg)
+{
+	ScreenshotWriteJob *job = (ScreenshotWriteJob *)arg;
+	job->result = job->proc(job->writer, job->buf, job->n);
+	return NULL;
+}
+
+/**
+ * Generate all lines of an image and write them to the image file. The
+ * lines are generated in blocks of at most maxlines lines on the calling
+ * thread, as drawing uses the global drawing state and the sprite cache.
+ * Writing (and thus compressing) a block is done on another thread while
+ * the next block gets generated, so only two blocks are ever in memory.
+ * @param callb     function generating the lines
+ * @param userdata  data passed to callb
+ * @param h         height of the image
+ * @param pitch     width of a line in pixels
+ * @param bpp       bytes per pixel
+ * @param maxlines  maximum number of lines in a block
+ * @param bottom_up whether to generate the blocks from the bottom of the image to the top
+ * @param write     function writing a block of lines
+ * @param writer    data passed to write
+ * @return true iff all lines were written successfully
+ */
+static bool GenerateScreenshotLines(ScreenshotCallback *callb, void *userdata, uint h, uint pitch, uint bpp, uint maxlines, bool bottom_up, ScreenshotWriteProc *write, void *writer)
+{
+	/* zero the buffers to have the padding bytes set to 0 */
+	uint8 *buff[2] = { CallocT<uint8>(pitch * maxlines * bpp), CallocT<uint8>(pitch * maxlines * bpp) };
+	if (buff[0] == NULL || buff[1] == NULL) {
+		free(buff[0]);
+		free(buff[1]);
+		return false;
+	}
+
+	ScreenshotWriteJob job;
+	job.proc = write;
+	job.writer = writer;
+	job.result = true;
+
+	OTTDThread *thread = NULL;
+	uint cur = 0;
+
+	for (uint done = 0; done != h; cur ^= 1) {
+		uint n = min(h - done, maxlines);
+		uint y = bottom_up ? h - done - n : done;
+		done += n;
+
+		/* render the pixels while the previous block is being written */
+		callb(userdata, buff[cur], y, pitch, n);
+
+		if (thread != NULL) OTTDJoinThread(thread);
+		if (!job.result) break;
+
+		job.buf = buff[cur];
+		job.n = n;
+		thread = OTTDCreateThread(ScreenshotWriteThread, &job);
+		/* no threads available, so just write it ourselves */
+		if (thread == NULL) ScreenshotWriteThread(&job);
+	}
+	if (thread != NULL) OTTDJoinThread(thread);
+
+	free(buff[0]);
+	free(buff[1]);
+
+	return job.result;
+}
+
 #define MKCOLOUR(x)         TO_LE32X(x)
 
 /*************************************************
@@ -81,6 +162,24 @@ struct RgbQuad {
 assert_compile(sizeof(RgbQuad) == 4);
 
 /* generic .BMP writer */
+/** Data of the .BMP writer needed to write blocks of lines. */
+struct BmpWriter {
+	FILE *f;   ///< the file to write to
+	uint padw; ///< width of a line in pixels, including padding
+	uint bpp;  ///< bytes per pixel
+};
+
+static bool WriteBmpLines(void *writer, void *buf, uint n)
+{
+	const BmpWriter *bw = (const BmpWriter *)writer;
+
+	/* write each line, the last line first as bitmaps are stored bottom up */
+	while (n != 0) {
+		if (fwrite((uint8 *)buf + (--n) * bw->padw * bw->bpp, bw->padw * bw->bpp, 1, bw->f) != 1) return false;
+	}
+	return true;
+}
+
 static bool MakeBmpImage(const char *name, ScreenshotCallback *callb, void *userdata, uint w, uint h, int pixelformat, const Colour *palette)
 {
 	BitmapFileHeader bfh;
@@ -88,7 +187,7 @@ static bool MakeBmpImage(const char *name, ScreenshotCallback *callb, void *user
 	RgbQuad rq[256];
 	FILE *f;
 	uint i, padw;
-	uint n, maxlines;
+	uint maxlines;
 	uint pal_size = 0;
 	uint bpp = pixelformat / 8;
 
@@ -140,36 +239,17 @@ static bool MakeBmpImage(const char *name, ScreenshotCallback *callb, void *user
 	/* use by default 64k temp memory */
 	maxlines = Clamp(65536 / padw, 16, 128);
 
-	/* now generate the bitmap bits */
-	void *buff = MallocT<uint8>(padw * maxlines * bpp); // by default generate 128 lines at a time.
-	if (buff == NULL) {
-		fclose(f);
-		return false;
-	}
-	memset(buff, 0, padw * maxlines); // zero the buffer to have the padding bytes set to 0
-
-	/* start at the bottom, since bitmaps are stored bottom up. */
-	do {
-		/* determine # lines */
-		n = min(h, maxlines);
-		h -= n;
-
-		/* render the pixels */
-		callb(userdata, buff, h, padw, n);
+	BmpWriter bw;
+	bw.f = f;
+	bw.padw = padw;
+	bw.bpp = bpp;
 
-		/* write each line */
-		while (n)
-			if (fwrite((uint8 *)buff + (--n) * padw * bpp, padw * bpp, 1, f) != 1) {
-				free(buff);
-				fclose(f);
-				return false;
-			}
-	} while (h != 0);
+	/* now generate the bitmap bits; start at the bottom, since bitmaps are stored bottom up. */
+	bool ret = GenerateScreenshotLines(callb, userdata, h, padw, bpp, maxlines, true, WriteBmpLines, &bw);
 
-	free(buff);
 	fclose(f);
 
-	return true;
+	return ret;
 }
 
 //********************************************************
@@ -189,11 +269,31 @@ static void PNGAPI png_my_warning(png_structp png_ptr, png_const_charp message)
 	DEBUG(misc, 1, "[libpng] warning: %s - %s", message, (char *)png_get_error_ptr(png_ptr));
 }
 
+/** Data of the .PNG writer needed to write blocks of lines. */
+struct PNGWriter {
+	png_structp png_ptr; ///< the PNG being written
+	uint w;              ///< width of a line in pixels
+	uint bpp;            ///< bytes per pixel
+};
+
+static bool WritePNGLines(void *writer, void *buf, uint n)
+{
+	const PNGWriter *pw = (const PNGWriter *)writer;
+
+	/* errors jump back to the thread doing the writing, so catch them here */
+	if (setjmp(png_jmpbuf(pw->png_ptr))) return false;
+
+	for (uint i = 0; i != n; i++) {
+		png_write_row(pw->png_ptr, (png_bytep)buf + i * pw->w * pw->bpp);
+	}
+	return true;
+}
+
 static bool MakePNGImage(const char *name, ScreenshotCallback *callb, void *userdata, uint w, uint h, int pixelformat, const Colour *palette)
 {
 	png_color rq[256];
 	FILE *f;
-	uint i, y, n;
+	uint i;
 	uint maxlines;
 	uint bpp = pixelformat / 8;
 	png_structp png_ptr;
@@ -268,33 +368,24 @@ static bool MakePNGImage(const char *name, ScreenshotCallback *callb, void *user
 	/* use by default 64k temp memory */
 	maxlines = Clamp(65536 / w, 16, 128);
 
+	PNGWriter pw;
+	pw.png_ptr = png_ptr;
+	pw.w = w;
+	pw.bpp = bpp;
+
 	/* now generate the bitmap bits */
-	void *buff = MallocT<uint8>(w * maxlines * bpp); // by default generate 128 lines at a time.
-	if (buff == NULL) {
+	bool ret = GenerateScreenshotLines(callb, userdata, h, w, bpp, maxlines, false, WritePNGLines, &pw);
+
+	/* the lines were written with another jump buffer, so set ours again */
+	if (!ret || setjmp(png_jmpbuf(png_ptr))) {
 		png_destroy_write_struct(&png_ptr, &info_ptr);
 		fclose(f);
 		return false;
 	}
-	memset(buff, 0, w * maxlines * bpp);
-
-	y = 0;
-	do {
-		/* determine # lines to write */
-		n = min(h - y, maxlines);
-
-		/* render the pixels into the buffer */
-		callb(userdata, buff, y, w, n);
-		y += n;
-
-		/* write them to png */
-		for (i = 0; i != n; i++)
-			png_write_row(png_ptr, (png_bytep)buff + i * w * bpp);
-	} while (y != h);
 
 	png_write_end(png_ptr, info_ptr);
 	png_destroy_write_struct(&png_ptr, &info_ptr);
 
-	free(buff);
 	fclose(f);
 	return true;
 }
@@ -830,6 +921,118 @@ bool MakeMinimapWorldScreenshot()
 	return sf->proc(MakeScreenshotName(SCREENSHOT_NAME, sf->extension), MinimapScreenCallback, nullptr, MapSizeX(), MapSizeY(), 32, _cur_palette);
 }
 
+/** Snapshot of the map that is exported in the background. */
+struct MapExport {
+	byte *colours;                 ///< palette index of each tile, indexed by tile
+	uint size_x;                   ///< width of the map at the time of the snapshot
+	uint size_y;                   ///< height of the map at the time of the snapshot
+	Colour palette[256];           ///< palette at the time of the snapshot
+	ScreenshotHandlerProc *proc;   ///< image format to write
+	char name[MAX_PATH];           ///< file to write to
+};
+
+/** State of the map export; only changed by the export thread while it is running. */
+enum MapExportState {
+	MES_NONE,    ///< no export is running, or its result has been reported
+	MES_RUNNING, ///< the image is being written
+	MES_DONE,    ///< the image has been written, but this is not reported yet
+	MES_FAILED,  ///< writing the image failed, but this is not reported yet
+};
+
+static MapExport _map_export;
+static OTTDThread *_map_export_thread = NULL;
+static volatile MapExportState _map_export_state = MES_NONE;
+
+static void MapExportCallback(void *userdata, void *buf, uint y, uint pitch, uint n)
+{
+	const MapExport *me = (const MapExport *)userdata;
+	byte *dst = (byte *)buf;
+
+	for (; n != 0; n--, y++, dst += pitch) {
+		/* mirror the map like the minimap screenshot, so north is at the top */
+		const byte *src = me->colours + y * me->size_x + me->size_x - 1;
+		for (uint x = 0; x != me->size_x; x++) dst[x] = *src--;
+	}
+}
+
+static bool WriteMapExport()
+{
+	bool ret = _map_export.proc(_map_export.name, MapExportCallback, &_map_export, _map_export.size_x, _map_export.size_y, 8, _map_export.palette);
+
+	free(_map_export.colours);
+	_map_export.colours = NULL;
+	return ret;
+}
+
+static void *MapExportThread(void *arg)
+{
+	_map_export_state = WriteMapExport() ? MES_DONE : MES_FAILED;
+	return NULL;
+}
+
+/**
+ * Export the map as the small map shows it, one pixel per tile. Only a
+ * snapshot of the tile colours is made here; writing the image, which is
+ * the slow part, is done on a separate thread so the game keeps running.
+ * Nothing is drawn, so this works without any video output too.
+ * @param type type of small map to export (contours, vehicles, etc)
+ * @param name name of the file, or NULL for a generated name
+ * @return false if an export is still running, true otherwise
+ */
+bool MakeMapExport(int type, const char *name)
+{
+	PollMapExport();
+	if (_map_export_state == MES_RUNNING) return false;
+
+	_screenshot_name[0] = '\0';
+	if (name != NULL) strecpy(_screenshot_name, name, lastof(_screenshot_name));
+
+	const ScreenshotFormat *sf = _screenshot_formats + _cur_screenshot_format;
+	_map_export.proc = sf->proc;
+	strecpy(_map_export.name, MakeScreenshotName(SCREENSHOT_NAME, sf->extension), lastof(_map_export.name));
+
+	_map_export.size_x = MapSizeX();
+	_map_export.size_y = MapSizeY();
+	memcpy(_map_export.palette, _cur_palette, sizeof(_map_export.palette));
+	_map_export.colours = MallocT<byte>(MapSize());
+	GetSmallMapColours(_map_export.colours, type);
+
+	_map_export_state = MES_RUNNING;
+	_map_export_thread = OTTDCreateThread(&MapExportThread, NULL);
+	if (_map_export_thread == NULL) {
+		DEBUG(misc, 1, "Cannot create map export thread, reverting to single-threaded mode...");
+		_map_export_state = WriteMapExport() ? MES_DONE : MES_FAILED;
+		PollMapExport();
+	}
+	return true;
+}
+
+/**
+ * Report the result of a finished map export and allow a new one to start.
+ * Called every game loop, as the export thread does not send any message.
+ */
+void PollMapExport()
+{
+	MapExportState state = _map_export_state;
+	if (state == MES_NONE || state == MES_RUNNING) return;
+
+	WaitTillMapExported();
+	_map_export_state = MES_NONE;
+
+	if (state == MES_DONE) {
+		IConsolePrintF(_icolour_def, "Map exported to '%s'", _map_export.name);
+	} else {
+		IConsolePrintF(_icolour_err, "Exporting the map to '%s' failed", _map_export.name);
+	}
+}
+
+/** Wait for the thread exporting the map, if any, to finish. */
+void WaitTillMapExported()
+{
+	OTTDJoinThread(_map_export_thread);
+	_map_export_thread = NULL;
+}
+
 /**
  * Make a single-window screenshot.
  */
@@ -27,6 +27,10 @@ bool MakeScreenshot(ScreenshotType t, const char *name);
 bool MakeWindowScreenshot(Window *w, const char *filename);
 bool MakeMinimapWorldScreenshot();
 
+bool MakeMapExport(int type, const char *name);
+void PollMapExport();
+void WaitTillMapExported();
+
 extern char _screenshot_format_name[8];
 extern uint _num_screenshot_formats;
 extern uint _cur_screenshot_format;
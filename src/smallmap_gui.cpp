@@ -25,6 +25,7 @@
 #include "strings_func.h"
 #include "zoom_func.h"
 #include "core/endian_func.hpp"
+#include "core/alloc_func.hpp"
 #include "vehicle_base.h"
 #include "sound_func.h"
 #include "settings_type.h"
@@ -563,6 +564,149 @@ enum SmallMapType {
 	SMT_OWNER = 5,
 };
 
+/*
+ * Cache of the colours of the tiles for the small map type currently shown,
+ * so redrawing and scrolling the small map does not need to look at every
+ * tile again. A tile is refreshed when it is marked dirty; as not every
+ * change marks its tile dirty, a part of the rows is also refreshed at each
+ * periodic update of the small map window.
+ */
+static uint32 *_smallmap_cache = NULL;       ///< colours of the tiles, indexed by tile
+static bool *_smallmap_cache_valid = NULL;   ///< whether the cached colours of a tile are up to date
+static uint _smallmap_cache_size = 0;        ///< number of tiles in the cache
+static int _smallmap_cache_type = -1;        ///< type of small map the cache is filled for
+static uint32 _smallmap_cache_owner_colors[OWNER_END + 1]; ///< owner colours the cache is filled with
+static uint _smallmap_cache_refresh_row = 0; ///< next row of tiles to refresh periodically
+
+/** Forget all cached tile colours. */
+static void InvalidateSmallMapCache()
+{
+	if (_smallmap_cache_valid != NULL) memset(_smallmap_cache_valid, 0, _smallmap_cache_size * sizeof(*_smallmap_cache_valid));
+}
+
+/** Free the tile colour cache, when the small map is closed. */
+static void FreeSmallMapCache()
+{
+	free(_smallmap_cache);
+	free(_smallmap_cache_valid);
+	_smallmap_cache = NULL;
+	_smallmap_cache_valid = NULL;
+	_smallmap_cache_size = 0;
+	_smallmap_cache_type = -1;
+}
+
+/**
+ * Make sure the tile colour cache can be used to draw a small map.
+ * @param type type of map to draw
+ */
+static void PrepareSmallMapCache(int type)
+{
+	if (_smallmap_cache_size != MapSize()) {
+		FreeSmallMapCache();
+		_smallmap_cache = MallocT<uint32>(MapSize());
+		_smallmap_cache_valid = CallocT<bool>(MapSize());
+		_smallmap_cache_size = MapSize();
+	}
+
+	if (type != _smallmap_cache_type) {
+		InvalidateSmallMapCache();
+		_smallmap_cache_type = type;
+	}
+
+	if (type == SMT_OWNER && memcmp(_smallmap_cache_owner_colors, _owner_colors, sizeof(_owner_colors)) != 0) {
+		InvalidateSmallMapCache();
+		memcpy(_smallmap_cache_owner_colors, _owner_colors, sizeof(_owner_colors));
+	}
+}
+
+/**
+ * Refresh some rows of the tile colour cache, so changes to tiles that are
+ * not marked dirty show up on the small map within a few updates.
+ */
+static void RefreshSmallMapCacheRows()
+{
+	if (_smallmap_cache_valid == NULL) return;
+
+	uint rows = max(MapSizeY() / 8, 1U);
+	for (uint i = 0; i != rows; i++) {
+		if (_smallmap_cache_refresh_row >= MapSizeY()) _smallmap_cache_refresh_row = 0;
+		memset(_smallmap_cache_valid + TileXY(0, _smallmap_cache_refresh_row), 0, MapSizeX() * sizeof(*_smallmap_cache_valid));
+		_smallmap_cache_refresh_row++;
+	}
+}
+
+/**
+ * Mark the cached small map colour of a tile as outdated.
+ * @param tile the tile that changed
+ */
+void InvalidateSmallMapTile(TileIndex tile)
+{
+	if (tile < _smallmap_cache_size) _smallmap_cache_valid[tile] = false;
+}
+
+/**
+ * Get the colours of a tile for the small map from the cache, looking them
+ * up when they are not cached yet.
+ * @param tile the tile to get the colours of
+ * @return the colours of the tile
+ * @see PrepareSmallMapCache
+ */
+static uint32 GetSmallMapCachedPixels(TileIndex tile)
+{
+	if (!_smallmap_cache_valid[tile]) {
+		_smallmap_cache[tile] = _smallmap_draw_procs[_smallmap_cache_type](tile);
+		_smallmap_cache_valid[tile] = true;
+	}
+	return _smallmap_cache[tile];
+}
+
+/** Fill the colours of the players for the small map in mode "Owner". */
+static void SetupSmallMapOwnerColours()
+{
+	const Player *p;
+
+	/* fill with some special colors */
+	_owner_colors[OWNER_TOWN] = MKCOLOR(0xB4B4B4B4);
+	_owner_colors[OWNER_NONE] = MKCOLOR(0x54545454);
+	_owner_colors[OWNER_WATER] = MKCOLOR(0xCACACACA);
+	_owner_colors[OWNER_END]   = MKCOLOR(0x20202020); /* industry */
+
+	/* now fill with the player colors */
+	FOR_ALL_PLAYERS(p) {
+		if (p->is_active) {
+			_owner_colors[p->index] =
+				_colour_gradient[p->player_color][5] * 0x01010101;
+		}
+	}
+}
+
+/**
+ * Get the colours of all tiles as the small map shows them, one palette
+ * index per tile. Vehicles and town names are not included, as the small
+ * map draws those on top of the tiles.
+ * @param buf  destination of MapSize() bytes, indexed by tile
+ * @param type type of map requested (vegetation, owners, routes, etc), see SmallMapType
+ */
+void GetSmallMapColours(byte *buf, int type)
+{
+	assert(IsInsideMM(type, 0, lengthof(_smallmap_draw_procs)));
+
+	if (type == SMT_OWNER) SetupSmallMapOwnerColours();
+
+	GetSmallMapPixels *proc = _smallmap_draw_procs[type];
+	for (TileIndex tile = 0; tile != MapSize(); tile++) {
+		if (IsTileType(tile, MP_VOID)) {
+			buf[tile] = 0;
+			continue;
+		}
+
+		/* The small map draws four pixels per tile; alternate between them
+		 * so the dithering of the contours survives */
+		uint32 val = proc(tile);
+		buf[tile] = ((const uint8 *)&val)[(TileX(tile) + TileY(tile)) & 3];
+	}
+}
+
 /**
  * Draws the small map.
  *
@@ -594,23 +738,9 @@ static void DrawSmallMap(DrawPixelInfo *dpi, Window *w, int type, bool show_town
 	GfxFillRect(dpi->left, dpi->top, dpi->left + dpi->width - 1, dpi->top + dpi->height - 1, 0);
 
 	/* setup owner table */
-	if (type == SMT_OWNER) {
-		const Player *p;
-
-		/* fill with some special colors */
-		_owner_colors[OWNER_TOWN] = MKCOLOR(0xB4B4B4B4);
-		_owner_colors[OWNER_NONE] = MKCOLOR(0x54545454);
-		_owner_colors[OWNER_WATER] = MKCOLOR(0xCACACACA);
-		_owner_colors[OWNER_END]   = MKCOLOR(0x20202020); /* industry */
-
-		/* now fill with the player colors */
-		FOR_ALL_PLAYERS(p) {
-			if (p->is_active) {
-				_owner_colors[p->index] =
-					_colour_gradient[p->player_color][5] * 0x01010101;
-			}
-		}
-	}
+	if (type == SMT_OWNER) SetupSmallMapOwnerColours();
+
+	PrepareSmallMapCache(type);
 
 	tile_x = WP(w, smallmap_d).scroll_x / TILE_SIZE;
 	tile_y = WP(w, smallmap_d).scroll_y / TILE_SIZE;
@@ -661,7 +791,7 @@ static void DrawSmallMap(DrawPixelInfo *dpi, Window *w, int type, bool show_town
 		/* number of lines */
 		reps = (dpi->height - y + 1) / 2;
 		if (reps > 0) {
-			DrawSmallMapStuff(ptr, tile_x, tile_y, dpi->pitch * 2, reps, mask, _smallmap_draw_procs[type]);
+			DrawSmallMapStuff(ptr, tile_x, tile_y, dpi->pitch * 2, reps, mask, GetSmallMapCachedPixels);
 		}
 
 skip_column:
@@ -936,6 +1066,7 @@ static void SmallMapWindowProc(Window *w, WindowEvent *e)
 								if (i == column && line <= max_column_lines - 1) {
 									industry_pos = industry_pos + line;
 									_legend_from_industries[industry_pos].show_on_map = !_legend_from_industries[industry_pos].show_on_map;
+									InvalidateSmallMapCache();
 								}
 								if( free > 0) free--;
 							}
@@ -951,6 +1082,7 @@ static void SmallMapWindowProc(Window *w, WindowEvent *e)
 					for (int i = 0; i != _smallmap_industry_count; i++) {
 						_legend_from_industries[i].show_on_map = true;
 					}
+					InvalidateSmallMapCache();
 					/* toggle appeareance indicating the choice */
 					w->LowerWidget(SM_WIDGET_ENABLEINDUSTRIES);
 					w->RaiseWidget(SM_WIDGET_DISABLEINDUSTRIES);
@@ -961,6 +1093,7 @@ static void SmallMapWindowProc(Window *w, WindowEvent *e)
 					for (int i = 0; i != _smallmap_industry_count; i++) {
 						_legend_from_industries[i].show_on_map = false;
 					}
+					InvalidateSmallMapCache();
 					/* toggle appeareance indicating the choice */
 					w->RaiseWidget(SM_WIDGET_ENABLEINDUSTRIES);
 					w->LowerWidget(SM_WIDGET_DISABLEINDUSTRIES);
@@ -980,7 +1113,14 @@ static void SmallMapWindowProc(Window *w, WindowEvent *e)
 
 		case WE_MOUSELOOP:
 			/* update the window every now and then */
-			if ((++w->vscroll.pos & 0x1F) == 0) SetWindowDirty(w);
+			if ((++w->vscroll.pos & 0x1F) == 0) {
+				RefreshSmallMapCacheRows();
+				SetWindowDirty(w);
+			}
+			break;
+
+		case WE_DESTROY:
+			FreeSmallMapCache();
 			break;
 
 		case WE_SCROLL: {
@@ -15,13 +15,14 @@
 #include "spriteloader/png.hpp"
 #endif /* WITH_PNG */
 #include "blitter/factory.hpp"
+#include "thread.h"
 
 #include "table/sprites.h"
 
 #include "safeguards.h"
 
-/* Default of 4MB spritecache */
-uint _sprite_cache_size = 4;
+/* Default of 128MB spritecache */
+uint _sprite_cache_size = 128;
 
 
 struct SpriteCache {
@@ -29,7 +30,6 @@ struct SpriteCache {
 	uint32 id;
  	uint32 file_pos;
 	uint16 file_slot;
- 	int16 lru;
 	bool real_sprite; ///< In some cases a single sprite is misused by two NewGRFs. Once as real sprite and once as non-real sprite. If the non-real sprite gets into the cache it might be drawn as real sprite which causes enormous trouble.
 };
 
@@ -63,16 +63,34 @@ static SpriteCache *AllocateSpriteCache(uint index)
 }
 
 
+/**
+ * Header of the memory of a cached sprite. Each cached sprite has its own
+ * allocation; all of them are kept in a list ordered from the most to the
+ * least recently used, so finding the sprite to evict is O(1).
+ */
 struct MemBlock {
-	uint32 size;
+	uint32 size;       ///< size of the allocation, including this header
+	SpriteID sprite;   ///< the sprite this memory belongs to, INVALID_SPRITE_ID while it is being loaded
+	MemBlock *prev;    ///< more recently used sprite
+	MemBlock *next;    ///< less recently used sprite
 	byte data[VARARRAY_SIZE];
 };
 
-static uint _sprite_lru_counter;
-static MemBlock *_spritecache_ptr;
-static int _compact_cache_counter;
+static const SpriteID INVALID_SPRITE_ID = (SpriteID)-1; ///< MemBlock::sprite of memory not yet belonging to a sprite
+
+static MemBlock *_sprite_lru_first = NULL; ///< most recently used sprite
+static MemBlock *_sprite_lru_last  = NULL; ///< least recently used sprite
+static size_t _sprite_cache_used = 0;      ///< bytes used by all cached sprites
 
-static void CompactSpriteCache();
+/** Statistics about the use of the sprite cache. */
+struct SpriteCacheStats {
+	uint hits;      ///< requested sprites that were in the cache
+	uint misses;    ///< requested sprites that had to be loaded
+	uint evictions; ///< sprites removed to make room for others
+};
+
+static SpriteCacheStats _sprite_cache_stats;
+static uint _sprite_cache_stats_counter;
 
 /**
  * Skip the given amount of sprite graphics data.
@@ -277,7 +295,6 @@ bool LoadNextSprite(int load_index, byte file_slot, uint file_sprite_id)
 	sc->file_slot = file_slot;
 	sc->file_pos = file_pos;
 	sc->ptr = NULL;
-	sc->lru = 0;
 	sc->id = file_sprite_id;
 	sc->real_sprite = false;
 
@@ -298,170 +315,91 @@ void DupSprite(SpriteID old_spr, SpriteID new_spr)
 }
 
 
-#define S_FREE_MASK 1
-
-static inline MemBlock* NextBlock(MemBlock* block)
+static inline MemBlock *GetSpriteMemBlock(void *ptr)
 {
-	return (MemBlock*)((byte*)block + (block->size & ~S_FREE_MASK));
+	return (MemBlock*)ptr - 1;
 }
 
-static uint32 GetSpriteCacheUsage()
+/**
+ * Add a sprite to the front of the LRU list.
+ * @param s the memory of the sprite
+ */
+static void LinkSpriteLRU(MemBlock *s)
 {
-	uint32 tot_size = 0;
-	MemBlock* s;
-
-	for (s = _spritecache_ptr; s->size != 0; s = NextBlock(s)) {
-		if (!(s->size & S_FREE_MASK)) tot_size += s->size;
-	}
-
-	return tot_size;
+	s->prev = NULL;
+	s->next = _sprite_lru_first;
+	if (_sprite_lru_first != NULL) _sprite_lru_first->prev = s;
+	_sprite_lru_first = s;
+	if (_sprite_lru_last == NULL) _sprite_lru_last = s;
 }
 
-
-void IncreaseSpriteLRU()
+/**
+ * Remove a sprite from the LRU list.
+ * @param s the memory of the sprite
+ */
+static void UnlinkSpriteLRU(MemBlock *s)
 {
-	/* Increase all LRU values */
-	if (_sprite_lru_counter > 16384) {
-		SpriteID i;
-
-		DEBUG(sprite, 3, "Fixing lru %d, inuse=%d", _sprite_lru_counter, GetSpriteCacheUsage());
-
-		for (i = 0; i != _spritecache_items; i++) {
-			SpriteCache *sc = GetSpriteCache(i);
-			if (sc->ptr != NULL) {
-				if (sc->lru >= 0) {
-					sc->lru = -1;
-				} else if (sc->lru != -32768) {
-					sc->lru--;
-				}
-			}
-		}
-		_sprite_lru_counter = 0;
-	}
-
-	/* Compact sprite cache every now and then. */
-	if (++_compact_cache_counter >= 740) {
-		CompactSpriteCache();
-		_compact_cache_counter = 0;
-	}
+	if (s->prev != NULL) s->prev->next = s->next; else _sprite_lru_first = s->next;
+	if (s->next != NULL) s->next->prev = s->prev; else _sprite_lru_last = s->prev;
+	s->prev = NULL;
+	s->next = NULL;
 }
 
-/** Called when holes in the sprite cache should be removed.
- * That is accomplished by moving the cached data. */
-static void CompactSpriteCache()
+/**
+ * Free the memory of a cached sprite.
+ * @param sc the sprite to remove from the cache
+ */
+static void DeleteEntryFromSpriteCache(SpriteCache *sc)
 {
-	MemBlock *s;
-
-	DEBUG(sprite, 3, "Compacting sprite cache, inuse=%d", GetSpriteCacheUsage());
-
-	for (s = _spritecache_ptr; s->size != 0;) {
-		if (s->size & S_FREE_MASK) {
-			MemBlock* next = NextBlock(s);
-			MemBlock temp;
-			SpriteID i;
+	MemBlock *s = GetSpriteMemBlock(sc->ptr);
 
-			/* Since free blocks are automatically coalesced, this should hold true. */
-			assert(!(next->size & S_FREE_MASK));
-
-			/* If the next block is the sentinel block, we can safely return */
-			if (next->size == 0)
-				break;
-
-			/* Locate the sprite belonging to the next pointer. */
-			for (i = 0; GetSpriteCache(i)->ptr != next->data; i++) {
-				assert(i != _spritecache_items);
-			}
-
-			GetSpriteCache(i)->ptr = s->data; // Adjust sprite array entry
-			/* Swap this and the next block */
-			temp = *s;
-			memmove(s, next, next->size);
-			s = NextBlock(s);
-			*s = temp;
-
-			/* Coalesce free blocks */
-			while (NextBlock(s)->size & S_FREE_MASK) {
-				s->size += NextBlock(s)->size & ~S_FREE_MASK;
-			}
-		} else {
-			s = NextBlock(s);
-		}
-	}
+	UnlinkSpriteLRU(s);
+	_sprite_cache_used -= s->size;
+	free(s);
+	sc->ptr = NULL;
 }
 
-static void DeleteEntryFromSpriteCache()
+void IncreaseSpriteLRU()
 {
-	SpriteID i;
-	uint best = UINT_MAX;
-	MemBlock* s;
-	int cur_lru;
-
-	DEBUG(sprite, 3, "DeleteEntryFromSpriteCache, inuse=%d", GetSpriteCacheUsage());
-
-	cur_lru = 0xffff;
-	for (i = 0; i != _spritecache_items; i++) {
-		SpriteCache *sc = GetSpriteCache(i);
-		if (sc->ptr != NULL && sc->lru < cur_lru) {
-			cur_lru = sc->lru;
-			best = i;
-		}
-	}
-
-	/* Display an error message and die, in case we found no sprite at all.
-	 * This shouldn't really happen, unless all sprites are locked. */
-	if (best == (uint)-1) error("Out of sprite memory");
-
-	/* Mark the block as free (the block must be in use) */
-	s = (MemBlock*)GetSpriteCache(best)->ptr - 1;
-	assert(!(s->size & S_FREE_MASK));
-	s->size |= S_FREE_MASK;
-	GetSpriteCache(best)->ptr = NULL;
-
-	/* And coalesce adjacent free blocks */
-	for (s = _spritecache_ptr; s->size != 0; s = NextBlock(s)) {
-		if (s->size & S_FREE_MASK) {
-			while (NextBlock(s)->size & S_FREE_MASK) {
-				s->size += NextBlock(s)->size & ~S_FREE_MASK;
-			}
-		}
+	/* Show how well the cache does every now and then */
+	if (++_sprite_cache_stats_counter >= 740) {
+		DEBUG(sprite, 3, "Sprite cache: inuse=%u, hits=%u, misses=%u, evictions=%u",
+			(uint)_sprite_cache_used, _sprite_cache_stats.hits, _sprite_cache_stats.misses, _sprite_cache_stats.evictions);
+		_sprite_cache_stats_counter = 0;
 	}
 }
 
-void* AllocSprite(size_t mem_req)
+/**
+ * Allocate the memory of a sprite without accounting for it in the cache,
+ * so it is safe to call from other threads.
+ * @param mem_req the amount of memory the sprite needs
+ * @return the memory for the sprite
+ */
+static void *AllocSpriteBlock(size_t mem_req)
 {
 	mem_req += sizeof(MemBlock);
 
-	/* Align this to an uint32 boundary. This also makes sure that the 2 least
-	 * bits are not used, so we could use those for other things. */
-	mem_req = Align(mem_req, sizeof(uint32));
-
-	for (;;) {
-		MemBlock* s;
-
-		for (s = _spritecache_ptr; s->size != 0; s = NextBlock(s)) {
-			if (s->size & S_FREE_MASK) {
-				size_t cur_size = s->size & ~S_FREE_MASK;
+	MemBlock *s = (MemBlock*)MallocT<byte>(mem_req);
+	s->size = mem_req;
+	s->sprite = INVALID_SPRITE_ID;
+	s->prev = NULL;
+	s->next = NULL;
 
-				/* Is the block exactly the size we need or
-				 * big enough for an additional free block? */
-				if (cur_size == mem_req ||
-						cur_size >= mem_req + sizeof(MemBlock)) {
-					/* Set size and in use */
-					s->size = mem_req;
+	return s->data;
+}
 
-					/* Do we need to inject a free block too? */
-					if (cur_size != mem_req) {
-						NextBlock(s)->size = (cur_size - mem_req) | S_FREE_MASK;
-					}
+void* AllocSprite(size_t mem_req)
+{
+	/* Make room by removing the least recently used sprites */
+	while (_sprite_lru_last != NULL && _sprite_cache_used + mem_req + sizeof(MemBlock) > (size_t)_sprite_cache_size * 1024 * 1024) {
+		DeleteEntryFromSpriteCache(GetSpriteCache(_sprite_lru_last->sprite));
+		_sprite_cache_stats.evictions++;
+	}
 
-					return s->data;
-				}
-			}
-		}
+	void *ptr = AllocSpriteBlock(mem_req);
+	_sprite_cache_used += GetSpriteMemBlock(ptr)->size;
 
-		/* Reached sentinel, but no block found yet. Delete some old entry. */
-		DeleteEntryFromSpriteCache();
-	}
+	return ptr;
 }
 
 
@@ -474,13 +412,31 @@ const void *GetRawSprite(SpriteID sprite, bool real_sprite)
 
 	sc = GetSpriteCache(sprite);
 
-	/* Update LRU */
-	sc->lru = ++_sprite_lru_counter;
-
 	p = sc->ptr;
 
-	/* Load the sprite, if it is not loaded, yet */
-	if (p == NULL || sc->real_sprite != real_sprite) p = ReadSprite(sc, sprite, real_sprite);
+	if (p != NULL && sc->real_sprite == real_sprite) {
+		/* Move it to the front of the LRU list */
+		_sprite_cache_stats.hits++;
+		MemBlock *s = GetSpriteMemBlock(p);
+		if (s != _sprite_lru_first) {
+			UnlinkSpriteLRU(s);
+			LinkSpriteLRU(s);
+		}
+		return p;
+	}
+
+	/* Load the sprite, as it is not loaded yet or loaded as the wrong kind of sprite */
+	_sprite_cache_stats.misses++;
+	if (p != NULL) DeleteEntryFromSpriteCache(sc);
+	p = ReadSprite(sc, sprite, real_sprite);
+
+	/* Reading might have loaded the sprite already by recursing, otherwise
+	 * the just allocated memory now belongs to this sprite. */
+	if (sc->ptr != NULL && GetSpriteMemBlock(sc->ptr)->sprite == INVALID_SPRITE_ID) {
+		MemBlock *s = GetSpriteMemBlock(sc->ptr);
+		s->sprite = sprite;
+		LinkSpriteLRU(s);
+	}
 
 	return p;
 }
@@ -488,18 +444,144 @@ const void *GetRawSprite(SpriteID sprite, bool real_sprite)
 
 void GfxInitSpriteMem()
 {
-	/* initialize sprite cache heap */
-	if (_spritecache_ptr == NULL) _spritecache_ptr = (MemBlock*)MallocT<byte>(_sprite_cache_size * 1024 * 1024);
-
-	/* A big free block */
-	_spritecache_ptr->size = ((_sprite_cache_size * 1024 * 1024) - sizeof(MemBlock)) | S_FREE_MASK;
-	/* Sentinel block (identified by size == 0) */
-	NextBlock(_spritecache_ptr)->size = 0;
+	/* Free all cached sprites */
+	while (_sprite_lru_first != NULL) {
+		MemBlock *s = _sprite_lru_first;
+		_sprite_lru_first = s->next;
+		free(s);
+	}
+	_sprite_lru_last = NULL;
+	_sprite_cache_used = 0;
+	memset(&_sprite_cache_stats, 0, sizeof(_sprite_cache_stats));
 
 	/* Reset the spritecache 'pool' */
 	free(_spritecache);
 	_spritecache_items = 0;
 	_spritecache = NULL;
+}
+
+/** A sprite that is decoded ahead of its first use by PrewarmSpriteCache. */
+struct PrewarmSprite {
+	SpriteID id;       ///< the sprite to decode
+	uint8 file_slot;   ///< file slot the sprite is in
+	uint32 file_pos;   ///< position of the sprite in the file
+	void *ptr;         ///< the encoded sprite, or NULL when it could not be decoded
+};
+
+/**
+ * Decode and encode a range of the sprites to pre-warm. This runs on
+ * several threads at once, so it only reads the memory mapped files or
+ * file handles of its own, and does not touch the cache itself.
+ * @param first the first sprite to decode
+ * @param last  the sprite after the last one to decode
+ * @param data  the PrewarmSprite array
+ */
+static void PrewarmSpriteRange(uint first, uint last, void *data)
+{
+	PrewarmSprite *sprites = (PrewarmSprite*)data;
+	Blitter *blitter = BlitterFactoryBase::GetCurrentBlitter();
+	SpriteLoaderGrf sprite_loader;
+	uint8 file_slot = 0;
+	FILE *f = NULL;
+
+	for (uint i = first; i < last; i++) {
+		PrewarmSprite *ps = &sprites[i];
+		ps->ptr = NULL;
+
+		SpriteLoader::Sprite sprite;
+		size_t file_size;
+		const byte *file = FioGetMappedFile(ps->file_slot, &file_size);
+		if (file != NULL) {
+			/* The mapped file can be shared by all threads */
+			if (!sprite_loader.LoadSprite(&sprite, file, file_size, ps->file_pos)) continue;
+		} else {
+			/* Sprites are sorted by the file they come from, so only open a
+			 * file when the previous sprite came from another one */
+			if (f == NULL || ps->file_slot != file_slot) {
+				if (f != NULL) fclose(f);
+				file_slot = ps->file_slot;
+				f = FioFOpenFile(FioGetOpenedFilename(file_slot));
+				if (f == NULL) continue;
+			}
+
+			if (!sprite_loader.LoadSprite(&sprite, f, ps->file_pos)) continue;
+		}
+		if (ps->id == 142) sprite.height = 10; // Compensate for a TTD bug
+		ps->ptr = blitter->Encode(&sprite, &AllocSpriteBlock);
+		free(sprite.data);
+	}
+
+	if (f != NULL) fclose(f);
+}
+
+/**
+ * Decode sprites into the cache before they are used for the first time,
+ * so the first frames that show them do not have to decode them. Loading
+ * the graphics empties the cache, so this is done every time they are
+ * loaded. To bound the time that takes, only the sprites of the base set
+ * are decoded, on all available cores.
+ */
+void PrewarmSpriteCache()
+{
+	/* Nothing is ever drawn */
+	if (BlitterFactoryBase::GetCurrentBlitter()->GetScreenDepth() == 0) return;
+#ifdef WITH_PNG
+	/* 32bpp sprites are loaded from PNGs through the shared file slots */
+	if (BlitterFactoryBase::GetCurrentBlitter()->GetScreenDepth() == 32) return;
+#endif /* WITH_PNG */
+
+	static const uint PREWARM_BATCH = 1024; ///< number of sprites decoded at once
+	const size_t budget = (size_t)_sprite_cache_size * 1024 * 1024 / 2;
+
+	const uint last = min(_spritecache_items, (uint)SPR_OPENTTD_BASE);
+
+	PrewarmSprite *sprites = MallocT<PrewarmSprite>(PREWARM_BATCH);
+	uint prewarmed = 0;
+	SpriteID id = 1;
+
+	while (id < last && _sprite_cache_used < budget) {
+		/* Gather the next batch of sprites that are not cached yet */
+		uint count = 0;
+		for (; id < last && count < PREWARM_BATCH; id++) {
+			const SpriteCache *sc = GetSpriteCache(id);
+			if (!SpriteExists(id) || sc->ptr != NULL) continue;
+			/* These are not encoded by the blitter; see ReadSprite */
+			if (id >= 4845 && id <= 4881) continue;
+#if defined(LIMITED_FDS)
+			/* Without a mapping the threads need file handles of their own */
+			size_t file_size;
+			if (FioGetMappedFile(sc->file_slot, &file_size) == NULL) continue;
+#endif /* LIMITED_FDS */
+
+			sprites[count].id        = id;
+			sprites[count].file_slot = sc->file_slot;
+			sprites[count].file_pos  = sc->file_pos;
+			count++;
+		}
+
+		OTTDParallelFor(0, count, &PrewarmSpriteRange, sprites);
+
+		/* Hand the decoded sprites over to the cache */
+		for (uint i = 0; i < count; i++) {
+			if (sprites[i].ptr == NULL) continue;
+
+			MemBlock *s = GetSpriteMemBlock(sprites[i].ptr);
+			if (_sprite_cache_used + s->size > budget) {
+				free(s);
+				continue;
+			}
+
+			SpriteCache *sc = GetSpriteCache(sprites[i].id);
+			sc->ptr = sprites[i].ptr;
+			sc->real_sprite = true;
+			s->sprite = sprites[i].id;
+			_sprite_cache_used += s->size;
+			LinkSpriteLRU(s);
+			prewarmed++;
+		}
+	}
+
+	free(sprites);
 
-	_compact_cache_counter = 0;
+	DEBUG(sprite, 2, "Pre-warmed %u sprites in the sprite cache (%u bytes)", prewarmed, (uint)_sprite_cache_used);
 }
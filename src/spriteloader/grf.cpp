@@ -7,26 +7,76 @@
 #include "../fileio.h"
 #include "../debug.h"
 #include "../core/alloc_func.hpp"
+#include "../core/math_func.hpp"
 #include "grf.hpp"
 
 #include "../safeguards.h"
 
-bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, uint8 file_slot, uint32 file_pos)
+/** Reads the sprite data through the shared file slots. */
+struct GrfFioReader {
+	inline byte ReadByte() { return FioReadByte(); }
+};
+
+/** Reads the sprite data from a file handle and buffer of its own. */
+struct GrfFileReader {
+	FILE *f;          ///< the file to read from
+	byte *pos;        ///< next byte to read in the buffer
+	byte *end;        ///< end of the valid data in the buffer
+	byte buffer[512]; ///< data read from the file
+
+	GrfFileReader(FILE *f, uint32 file_pos) : f(f), pos(buffer), end(buffer)
+	{
+		fseek(f, file_pos, SEEK_SET);
+	}
+
+	inline byte ReadByte()
+	{
+		if (pos == end) {
+			pos = buffer;
+			end = buffer + fread(buffer, 1, sizeof(buffer), f);
+			/* Reading past the end; a broken file, but do not crash */
+			if (pos == end) return 0;
+		}
+		return *pos++;
+	}
+};
+
+/** Reads the sprite data from the memory mapped contents of a file. */
+struct GrfMemoryReader {
+	const byte *pos; ///< next byte to read
+	const byte *end; ///< end of the file
+
+	GrfMemoryReader(const byte *file, size_t file_size, uint32 file_pos) : pos(file + min((size_t)file_pos, file_size)), end(file + file_size) {}
+
+	inline byte ReadByte()
+	{
+		/* Reading past the end; a broken file, but do not crash */
+		if (pos == end) return 0;
+		return *pos++;
+	}
+};
+
+template <class T>
+static inline uint16 GrfReadWord(T &reader)
 {
-	/* Open the right file and go to the correct position */
-	FioSeekToFile(file_slot, file_pos);
+	byte b = reader.ReadByte();
+	return (reader.ReadByte() << 8) | b;
+}
 
+template <class T>
+static bool DecodeGrfSprite(SpriteLoader::Sprite *sprite, T &reader)
+{
 	/* Read the size and type */
-	int num = FioReadWord();
-	byte type = FioReadByte();
+	int num = GrfReadWord(reader);
+	byte type = reader.ReadByte();
 
 	/* Type 0xFF indicates either a colormap or some other non-sprite info; we do not handle them here */
 	if (type == 0xFF) return false;
 
-	sprite->height = FioReadByte();
-	sprite->width  = FioReadWord();
-	sprite->x_offs = FioReadWord();
-	sprite->y_offs = FioReadWord();
+	sprite->height = reader.ReadByte();
+	sprite->width  = GrfReadWord(reader);
+	sprite->x_offs = GrfReadWord(reader);
+	sprite->y_offs = GrfReadWord(reader);
 
 	/* 0x02 indicates it is a compressed sprite, so we can't rely on 'num' to be valid.
 	 *  In case it is uncompressed, the size is 'num' - 8 (header-size). */
@@ -38,19 +88,19 @@ bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, uint8 file_slot,
 
 	/* Read the file, which has some kind of compression */
 	while (num > 0) {
-		int8 code = FioReadByte();
+		int8 code = reader.ReadByte();
 
 		if (code >= 0) {
 			/* Plain bytes to read */
 			int size = (code == 0) ? 0x80 : code;
 			num -= size;
 			for (; size > 0; size--) {
-				*dest = FioReadByte();
+				*dest = reader.ReadByte();
 				dest++;
 			}
 		} else {
 			/* Copy bytes from earlier in the sprite */
-			const uint data_offset = ((code & 7) << 8) | FioReadByte();
+			const uint data_offset = ((code & 7) << 8) | reader.ReadByte();
 			int size = -(code >> 3);
 			num -= size;
 			for (; size > 0; size--) {
@@ -105,3 +155,24 @@ bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, uint8 file_slot,
 	free(dest_orig);
 	return true;
 }
+
+bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, uint8 file_slot, uint32 file_pos)
+{
+	/* Open the right file and go to the correct position */
+	FioSeekToFile(file_slot, file_pos);
+
+	GrfFioReader reader;
+	return DecodeGrfSprite(sprite, reader);
+}
+
+bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, FILE *f, uint32 file_pos)
+{
+	GrfFileReader reader(f, file_pos);
+	return DecodeGrfSprite(sprite, reader);
+}
+
+bool SpriteLoaderGrf::LoadSprite(SpriteLoader::Sprite *sprite, const byte *file, size_t file_size, uint32 file_pos)
+{
+	GrfMemoryReader reader(file, file_size, file_pos);
+	return DecodeGrfSprite(sprite, reader);
+}
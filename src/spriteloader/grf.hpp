@@ -13,6 +13,18 @@ public:
 	 * Load a sprite from the disk and return a sprite struct which is the same for all loaders.
 	 */
 	bool LoadSprite(SpriteLoader::Sprite *sprite, uint8 file_slot, uint32 file_pos);
+
+	/**
+	 * Load a sprite from a file handle of its own instead of the shared file
+	 * slots, so sprites can be loaded on other threads.
+	 */
+	bool LoadSprite(SpriteLoader::Sprite *sprite, FILE *f, uint32 file_pos);
+
+	/**
+	 * Load a sprite from the memory mapped contents of its file, see
+	 * FioGetMappedFile, so sprites can be loaded on other threads.
+	 */
+	bool LoadSprite(SpriteLoader::Sprite *sprite, const byte *file, size_t file_size, uint32 file_pos);
 };
 
 #endif /* SPRITELOADER_GRF_HPP */
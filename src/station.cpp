@@ -55,6 +55,12 @@ Station::Station(TileIndex tile)
 
 	random_bits = 0; // Random() must be called when station is really built (DC_EXEC)
 	waiting_triggers = 0;
+
+	rating_slot = INVALID_RATING_SLOT;
+
+	catchment.left = catchment.top = 0;
+	catchment.right = catchment.bottom = -1;
+	memset(static_acceptance, 0, sizeof(static_acceptance));
 }
 
 /**
@@ -72,6 +78,8 @@ Station::~Station()
 
 	if (CleaningPool()) return;
 
+	RemoveStationAcceptance(this);
+
 	while (!loading_vehicles.empty()) {
 		loading_vehicles.front()->LeaveStation();
 	}
@@ -96,6 +104,7 @@ Station::~Station()
 	DeleteSubsidyWithStation(index);
 
 	xy = 0;
+	UpdateStationRatingSchedule(this);
 
 	for (CargoID c = 0; c < NUM_CARGO; c++) {
 		goods[c].cargo.Truncate(0);
@@ -136,6 +145,8 @@ void Station::AddFacility(byte new_facility_bit, TileIndex facil_xy)
 	facilities |= new_facility_bit;
 	owner = _current_player;
 	build_date = _date;
+
+	UpdateStationRatingSchedule(this);
 }
 
 void Station::MarkDirty() const
@@ -310,6 +321,9 @@ bool StationRect::BeforeAddTile(TileIndex tile, StationRectMode mode)
 	} else {
 		; // new point is inside the rect, we don't need to do anything
 	}
+
+	/* The new tile may also change the catchment radius of the whole station */
+	if (mode != ADD_TEST) InvalidateStationCatchmentCache(*this);
 	return true;
 }
 
@@ -336,6 +350,9 @@ bool StationRect::AfterRemoveTile(Station *st, TileIndex tile)
 	int x = TileX(tile);
 	int y = TileY(tile);
 
+	/* Removing the tile may also change the catchment radius of the whole station */
+	InvalidateStationCatchmentCache(*this);
+
 	/* look if removed tile was on the bounding rect edge
 	 * and try to reduce the rect by this edge
 	 * do it until we have empty rect or nothing to do */
@@ -16,6 +16,7 @@
 #include "core/geometry_type.hpp"
 #include <list>
 #include <set>
+#include <vector>
 
 struct Station;
 struct RoadStop;
@@ -145,7 +146,7 @@ public:
 
 	byte time_since_load;
 	byte time_since_unload;
-	byte delete_ctr;
+	byte delete_ctr;        ///< Ticks since the last rating update, or big ticks since the station became empty; not up to date while scheduled, see rating_slot
 	PlayerByte owner;
 	byte facilities;
 	byte airport_type;
@@ -170,6 +171,13 @@ public:
 
 	StationRect rect; ///< Station spread out rectangle (not saved) maintained by StationRect_xxx() functions
 
+	Rect catchment;                               ///< Tiles counted for the acceptance (not saved), empty when right < left
+	AcceptedCargo static_acceptance;              ///< Summed acceptance of the tiles in the catchment without acceptance callbacks (not saved)
+	std::vector<TileIndex> dynamic_acceptance;    ///< Tiles in the catchment whose acceptance is decided by callbacks (not saved)
+
+	byte rating_slot;       ///< Slot in the rating schedule, INVALID_RATING_SLOT when not scheduled (not saved)
+	static const byte INVALID_RATING_SLOT = 0xFF;
+
 	static const int cDebugCtorLevel = 5;
 
 	Station(TileIndex tile = 0);
@@ -250,6 +258,7 @@ void ModifyStationRatingAround(TileIndex tile, PlayerID owner, int amount, uint
 typedef std::set<Station*> StationSet;
 
 StationSet FindStationsAroundIndustryTile(TileIndex tile, int w, int h);
+void InvalidateStationCatchmentCache(const Rect &r);
 
 void ShowStationViewWindow(StationID station);
 void UpdateAllStationVirtCoord();
@@ -289,6 +298,11 @@ static inline bool IsValidStationID(StationID index)
 void AfterLoadStations();
 void GetProductionAroundTiles(AcceptedCargo produced, TileIndex tile, int w, int h, int rad);
 void GetAcceptanceAroundTiles(AcceptedCargo accepts, TileIndex tile, int w, int h, int rad);
+void UpdateTileAcceptance(TileIndex tile);
+void RemoveStationAcceptance(Station *st);
+void RebuildStationAcceptanceIndex();
+void UpdateStationRatingSchedule(Station *st);
+void RebuildStationRatingSchedule();
 
 
 const DrawTileSprites *GetStationTileLayout(StationType st, byte gfx);
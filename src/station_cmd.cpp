@@ -15,6 +15,7 @@
 #include "viewport_func.h"
 #include "command_func.h"
 #include "town.h"
+#include "town_map.h"
 #include "news.h"
 #include "saveload.h"
 #include "airport.h"
@@ -24,6 +25,7 @@
 #include "roadveh.h"
 #include "water_map.h"
 #include "industry_map.h"
+#include "industry.h"
 #include "newgrf_callbacks.h"
 #include "newgrf_station.h"
 #include "yapf/yapf.h"
@@ -43,6 +45,10 @@
 #include "string_func.h"
 #include "signal_func.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include "table/sprites.h"
 #include "table/strings.h"
 
@@ -543,24 +549,289 @@ static inline void MergePoint(ottd_Rectangle* rect, TileIndex tile)
 	if (rect->max_y < y) rect->max_y = y;
 }
 
-/** Update the acceptance for a station.
- * @param st Station to update
- * @param show_msg controls whether to display a message that acceptance was changed.
+/** Acceptance of a single tile as it is summed into the acceptance of the stations around it. */
+struct TileAcceptance {
+	CargoID cargo[4]; ///< Accepted cargo types, CT_INVALID for unused entries
+	byte amount[4];   ///< Acceptance for each of the cargo types, in 1/8 units
+	bool dynamic;     ///< Acceptance is decided by callbacks, so it is evaluated anew each time
+};
+
+/** Number of bits of the tile coordinates within one block of the acceptance index. */
+static const uint ACCEPTANCE_BLOCK_BITS = 4;
+
+typedef std::map<TileIndex, TileAcceptance> TileAcceptanceMap;
+static TileAcceptanceMap _tile_acceptance;                    ///< Acceptance of the tiles within a catchment, only non-empty ones are stored
+static std::vector<StationID> *_acceptance_blocks = NULL;      ///< Per block of the map the stations whose catchment touches that block
+static uint _acceptance_blocks_x;                             ///< Number of blocks along the X axis
+static uint _acceptance_blocks_y;                             ///< Number of blocks along the Y axis
+
+static inline bool IsCatchmentEmpty(const Rect &r)
+{
+	return r.right < r.left;
+}
+
+static inline bool IsTileInCatchment(const Rect &r, TileIndex tile)
+{
+	int x = TileX(tile);
+	int y = TileY(tile);
+	return x >= r.left && x <= r.right && y >= r.top && y <= r.bottom;
+}
+
+static inline const std::vector<StationID> &GetAcceptanceBlock(TileIndex tile)
+{
+	return _acceptance_blocks[(TileY(tile) >> ACCEPTANCE_BLOCK_BITS) * _acceptance_blocks_x + (TileX(tile) >> ACCEPTANCE_BLOCK_BITS)];
+}
+
+/**
+ * Check whether the acceptance of a tile is decided by NewGRF callbacks.
+ * Those may depend on the time or random bits, so they cannot be cached.
+ * @param tile the tile to check
+ * @return true when the acceptance must be evaluated every time
  */
-static void UpdateStationAcceptance(Station *st, bool show_msg)
+static bool IsTileAcceptanceDynamic(TileIndex tile)
 {
-	/* Don't update acceptance for a buoy */
-	if (st->IsBuoy()) return;
+	switch (GetTileType(tile)) {
+		case MP_HOUSE: {
+			const HouseSpec *hs = GetHouseSpecs(GetHouseType(tile));
+			return HasBit(hs->callback_mask, CBM_HOUSE_ACCEPT_CARGO) || HasBit(hs->callback_mask, CBM_HOUSE_CARGO_ACCEPTANCE);
+		}
+
+		case MP_INDUSTRY: {
+			const IndustryTileSpec *its = GetIndustryTileSpec(GetIndustryGfx(tile));
+			return HasBit(its->callback_flags, CBM_INDT_ACCEPT_CARGO) || HasBit(its->callback_flags, CBM_INDT_CARGO_ACCEPTANCE);
+		}
+
+		default: return false;
+	}
+}
+
+static void ClearTileAcceptance(TileAcceptance *ta)
+{
+	for (uint i = 0; i < lengthof(ta->cargo); i++) {
+		ta->cargo[i] = CT_INVALID;
+		ta->amount[i] = 0;
+	}
+	ta->dynamic = false;
+}
+
+static bool IsTileAcceptanceEmpty(const TileAcceptance &ta)
+{
+	return !ta.dynamic && ta.cargo[0] == CT_INVALID;
+}
+
+static bool IsSameTileAcceptance(const TileAcceptance &a, const TileAcceptance &b)
+{
+	if (a.dynamic != b.dynamic) return false;
+	for (uint i = 0; i < lengthof(a.cargo); i++) {
+		if (a.cargo[i] != b.cargo[i] || a.amount[i] != b.amount[i]) return false;
+	}
+	return true;
+}
+
+/**
+ * Get the acceptance a tile contributes to the stations around it.
+ * @param tile the tile to get the acceptance of
+ * @param ta   the resulting acceptance
+ */
+static void GetTileAcceptance(TileIndex tile, TileAcceptance *ta)
+{
+	ClearTileAcceptance(ta);
+
+	/* Station tiles never count for the acceptance */
+	if (IsTileType(tile, MP_STATION)) return;
+
+	if (IsTileAcceptanceDynamic(tile)) {
+		ta->dynamic = true;
+		return;
+	}
 
+	AcceptedCargo ac;
+	GetAcceptedCargo(tile, ac);
+
+	uint n = 0;
+	for (CargoID c = 0; c < NUM_CARGO; c++) {
+		if (ac[c] == 0) continue;
+
+		if (n == lengthof(ta->cargo) || ac[c] > 0xFF) {
+			/* Does not fit; just evaluate it every time */
+			ClearTileAcceptance(ta);
+			ta->dynamic = true;
+			return;
+		}
+		ta->cargo[n] = c;
+		ta->amount[n] = ac[c];
+		n++;
+	}
+}
+
+/**
+ * Add (or remove) the acceptance of a tile to (from) a station.
+ * @param st   the station whose catchment contains the tile
+ * @param tile the tile
+ * @param ta   the acceptance of the tile
+ * @param add  whether to add or to remove the acceptance
+ */
+static void AddTileAcceptanceToStation(Station *st, TileIndex tile, const TileAcceptance &ta, bool add)
+{
+	if (ta.dynamic) {
+		if (add) {
+			st->dynamic_acceptance.push_back(tile);
+		} else {
+			std::vector<TileIndex>::iterator it = std::find(st->dynamic_acceptance.begin(), st->dynamic_acceptance.end(), tile);
+			assert(it != st->dynamic_acceptance.end());
+			*it = st->dynamic_acceptance.back();
+			st->dynamic_acceptance.pop_back();
+		}
+		return;
+	}
+
+	for (uint i = 0; i < lengthof(ta.cargo) && ta.cargo[i] != CT_INVALID; i++) {
+		if (add) {
+			st->static_acceptance[ta.cargo[i]] += ta.amount[i];
+		} else {
+			assert(st->static_acceptance[ta.cargo[i]] >= ta.amount[i]);
+			st->static_acceptance[ta.cargo[i]] -= ta.amount[i];
+		}
+	}
+}
+
+/**
+ * Check whether a tile is within the catchment of any station.
+ * @param tile the tile to check
+ * @return true if some station counts the acceptance of the tile
+ */
+static bool IsTileInAnyCatchment(TileIndex tile)
+{
+	if (_acceptance_blocks == NULL) return false;
+
+	const std::vector<StationID> &block = GetAcceptanceBlock(tile);
+	for (std::vector<StationID>::const_iterator it = block.begin(); it != block.end(); ++it) {
+		if (IsTileInCatchment(GetStation(*it)->catchment, tile)) return true;
+	}
+	return false;
+}
+
+static void UpdateStationAcceptanceBits(Station *st, bool show_msg);
+
+/**
+ * Determine the current acceptance of a tile and, when it differs from
+ * the stored one, apply the difference to all stations counting the tile.
+ * @param tile the tile to refresh
+ * @return the current acceptance of the tile
+ */
+static const TileAcceptance RefreshTileAcceptance(TileIndex tile)
+{
+	TileAcceptance ta;
+	GetTileAcceptance(tile, &ta);
+
+	TileAcceptance old;
+	TileAcceptanceMap::iterator it = _tile_acceptance.find(tile);
+	if (it != _tile_acceptance.end()) {
+		old = it->second;
+	} else {
+		ClearTileAcceptance(&old);
+	}
+
+	if (IsSameTileAcceptance(old, ta)) return ta;
+
+	if (IsTileAcceptanceEmpty(ta)) {
+		_tile_acceptance.erase(it);
+	} else {
+		_tile_acceptance[tile] = ta;
+	}
+
+	if (_acceptance_blocks == NULL) return ta;
+
+	const std::vector<StationID> &block = GetAcceptanceBlock(tile);
+	for (std::vector<StationID>::const_iterator sit = block.begin(); sit != block.end(); ++sit) {
+		Station *st = GetStation(*sit);
+		if (!IsTileInCatchment(st->catchment, tile)) continue;
+
+		AddTileAcceptanceToStation(st, tile, old, false);
+		AddTileAcceptanceToStation(st, tile, ta, true);
+		UpdateStationAcceptanceBits(st, true);
+	}
+
+	return ta;
+}
+
+/**
+ * Add a station to, or remove it from, the blocks its catchment touches.
+ * @param st   the station
+ * @param link whether to add or to remove the station
+ */
+static void LinkStationAcceptance(Station *st, bool link)
+{
+	if (_acceptance_blocks == NULL) {
+		_acceptance_blocks_x = (MapSizeX() + (1 << ACCEPTANCE_BLOCK_BITS) - 1) >> ACCEPTANCE_BLOCK_BITS;
+		_acceptance_blocks_y = (MapSizeY() + (1 << ACCEPTANCE_BLOCK_BITS) - 1) >> ACCEPTANCE_BLOCK_BITS;
+		_acceptance_blocks = new std::vector<StationID>[_acceptance_blocks_x * _acceptance_blocks_y];
+	}
+
+	const Rect &r = st->catchment;
+	for (uint by = r.top >> ACCEPTANCE_BLOCK_BITS; by <= (uint)r.bottom >> ACCEPTANCE_BLOCK_BITS; by++) {
+		for (uint bx = r.left >> ACCEPTANCE_BLOCK_BITS; bx <= (uint)r.right >> ACCEPTANCE_BLOCK_BITS; bx++) {
+			std::vector<StationID> &block = _acceptance_blocks[by * _acceptance_blocks_x + bx];
+			if (link) {
+				block.push_back(st->index);
+			} else {
+				std::vector<StationID>::iterator it = std::find(block.begin(), block.end(), st->index);
+				assert(it != block.end());
+				*it = block.back();
+				block.pop_back();
+			}
+		}
+	}
+}
+
+/**
+ * Change the catchment of a station and recount the acceptance within it.
+ * @param st the station
+ * @param r  the new catchment, may be empty
+ */
+static void SetStationCatchment(Station *st, const Rect &r)
+{
+	if (!IsCatchmentEmpty(st->catchment)) {
+		LinkStationAcceptance(st, false);
+
+		/* Forget the tiles nobody counts anymore */
+		for (int y = st->catchment.top; y <= st->catchment.bottom; y++) {
+			for (int x = st->catchment.left; x <= st->catchment.right; x++) {
+				TileIndex tile = TileXY(x, y);
+				if (!IsTileInAnyCatchment(tile)) _tile_acceptance.erase(tile);
+			}
+		}
+	}
+
+	st->catchment = r;
+	memset(st->static_acceptance, 0, sizeof(st->static_acceptance));
+	st->dynamic_acceptance.clear();
+
+	if (IsCatchmentEmpty(r)) return;
+
+	for (int y = r.top; y <= r.bottom; y++) {
+		for (int x = r.left; x <= r.right; x++) {
+			TileIndex tile = TileXY(x, y);
+			AddTileAcceptanceToStation(st, tile, RefreshTileAcceptance(tile), true);
+		}
+	}
+
+	LinkStationAcceptance(st, true);
+}
+
+/**
+ * Get the area whose acceptance counts for a station.
+ * @param st the station
+ * @return the catchment of the station, empty if the station has no parts
+ */
+static Rect GetStationCatchment(const Station *st)
+{
 	ottd_Rectangle rect;
 	rect.min_x = MapSizeX();
 	rect.min_y = MapSizeY();
 	rect.max_x = 0;
 	rect.max_y = 0;
 
-	/* old accepted goods types */
-	uint old_acc = GetAcceptanceMask(st);
-
 	/* Put all the tiles that span an area in the table. */
 	if (st->train_tile != 0) {
 		MergePoint(&rect, st->train_tile);
@@ -588,18 +859,100 @@ static void UpdateStationAcceptance(Station *st, bool show_msg)
 		MergePoint(&rect, rs->xy);
 	}
 
-	/* And retrieve the acceptance. */
+	Rect r;
+	if (rect.max_x < rect.min_x || st->IsBuoy()) {
+		r.left = r.top = 0;
+		r.right = r.bottom = -1;
+		return r;
+	}
+
+	/* expand the region by the radius on each side
+	 * while making sure that we remain inside the board;
+	 * just like GetAcceptanceAroundTiles does. */
+	int rad = _patches.modified_catchment ? FindCatchmentRadius(st) : (uint)CA_UNMODIFIED;
+	r.left   = max((int)rect.min_x - rad, 0);
+	r.top    = max((int)rect.min_y - rad, 0);
+	r.right  = min((int)rect.max_x + 1 + rad, (int)MapSizeX()) - 1;
+	r.bottom = min((int)rect.max_y + 1 + rad, (int)MapSizeY()) - 1;
+	return r;
+}
+
+/**
+ * Update the acceptance of the stations around a tile after the tile
+ * changed. Only stations for which the tile makes a difference get
+ * their acceptance updated.
+ * @param tile the tile that changed
+ */
+void UpdateTileAcceptance(TileIndex tile)
+{
+	if (!IsTileInAnyCatchment(tile)) {
+		if (!_tile_acceptance.empty()) _tile_acceptance.erase(tile);
+		return;
+	}
+
+	RefreshTileAcceptance(tile);
+}
+
+/**
+ * Remove a station from the acceptance index, e.g. when it gets deleted.
+ * @param st the station to remove
+ */
+void RemoveStationAcceptance(Station *st)
+{
+	Rect r;
+	r.left = r.top = 0;
+	r.right = r.bottom = -1;
+	SetStationCatchment(st, r);
+}
+
+/** Forget all acceptance counted for the stations. */
+static void ResetStationAcceptanceIndex()
+{
+	delete[] _acceptance_blocks;
+	_acceptance_blocks = NULL;
+	_tile_acceptance.clear();
+}
+
+/**
+ * Recount the acceptance around all stations, without changing whether
+ * the stations accept a cargo. Used after loading a game and after the
+ * NewGRFs changed, as then the acceptance of the tiles might have changed.
+ */
+void RebuildStationAcceptanceIndex()
+{
+	ResetStationAcceptanceIndex();
+
+	Station *st;
+	FOR_ALL_STATIONS(st) {
+		st->catchment.left = st->catchment.top = 0;
+		st->catchment.right = st->catchment.bottom = -1;
+		memset(st->static_acceptance, 0, sizeof(st->static_acceptance));
+		st->dynamic_acceptance.clear();
+	}
+
+	FOR_ALL_STATIONS(st) {
+		SetStationCatchment(st, GetStationCatchment(st));
+	}
+}
+
+/**
+ * Update whether the station accepts the cargos, based on the counted
+ * acceptance of the tiles in its catchment.
+ * @param st Station to update
+ * @param show_msg controls whether to display a message that acceptance was changed.
+ */
+static void UpdateStationAcceptanceBits(Station *st, bool show_msg)
+{
+	/* old accepted goods types */
+	uint old_acc = GetAcceptanceMask(st);
+
+	/* Retrieve the acceptance; the tiles with callbacks are evaluated each time */
 	AcceptedCargo accepts;
-	if (rect.max_x >= rect.min_x) {
-		GetAcceptanceAroundTiles(
-			accepts,
-			TileXY(rect.min_x, rect.min_y),
-			rect.max_x - rect.min_x + 1,
-			rect.max_y - rect.min_y + 1,
-			_patches.modified_catchment ? FindCatchmentRadius(st) : (uint)CA_UNMODIFIED
-		);
-	} else {
-		memset(accepts, 0, sizeof(accepts));
+	memcpy(accepts, st->static_acceptance, sizeof(accepts));
+	for (std::vector<TileIndex>::const_iterator it = st->dynamic_acceptance.begin(); it != st->dynamic_acceptance.end(); ++it) {
+		AcceptedCargo ac;
+		GetAcceptedCargo(*it, ac);
+		for (uint i = 0; i < lengthof(ac); ++i) accepts[i] += ac[i];
 	}
 
 	/* Adjust in case our station only accepts fewer kinds of goods */
@@ -663,6 +1016,24 @@ static void UpdateStationAcceptance(Station *st, bool show_msg)
 	InvalidateWindowWidget(WC_STATION_VIEW, st->index, SVW_ACCEPTLIST);
 }
 
+/** Update the acceptance for a station.
+ * @param st Station to update
+ * @param show_msg controls whether to display a message that acceptance was changed.
+ */
+static void UpdateStationAcceptance(Station *st, bool show_msg)
+{
+	/* Don't update acceptance for a buoy */
+	if (st->IsBuoy()) return;
+
+	/* Only recount the tiles when the catchment changed */
+	Rect r = GetStationCatchment(st);
+	if (r.left != st->catchment.left || r.top != st->catchment.top || r.right != st->catchment.right || r.bottom != st->catchment.bottom) {
+		SetStationCatchment(st, r);
+	}
+
+	UpdateStationAcceptanceBits(st, show_msg);
+}
+
 static void UpdateStationSignCoord(Station *st)
 {
 	const StationRect *r = &st->rect;
@@ -681,6 +1052,10 @@ static void UpdateStationSignCoord(Station *st)
  */
 static void DeleteStationIfEmpty(Station *st)
 {
+	/* the catchment might have shrunk; drop the acceptance of the tiles that are not covered anymore */
+	UpdateStationAcceptance(st, false);
+	UpdateStationRatingSchedule(st);
+
 	if (st->facilities == 0) {
 		st->delete_ctr = 0;
 		RebuildStationLists();
@@ -1840,6 +2215,7 @@ CommandCost CmdBuildBuoy(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 		st->sign.width_1 = 0;
 		st->dock_tile = tile;
 		st->facilities |= FACIL_DOCK;
+		UpdateStationRatingSchedule(st);
 		/* Buoys are marked in the Station struct by this flag. Yes, it is this
 		 * braindead.. */
 		st->had_vehicle_of_type |= HVOT_BUOY;
@@ -1867,16 +2243,13 @@ CommandCost CmdBuildBuoy(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
  */
 bool HasStationInUse(StationID station, PlayerID player)
 {
-	const Vehicle *v;
-	FOR_ALL_VEHICLES(v) {
-		if (player == INVALID_PLAYER || v->owner == player) {
-			const Order *order;
-			FOR_VEHICLE_ORDERS(v, order) {
-				if (order->type == OT_GOTO_STATION && order->dest == station) {
-					return true;
-				}
-			}
-		}
+	const OrderDestinationVehicles *vehicles = GetVehiclesWithOrdersTo(OT_GOTO_STATION, station);
+	if (vehicles == NULL) return false;
+
+	if (player == INVALID_PLAYER) return true;
+
+	for (OrderDestinationVehicles::const_iterator it = vehicles->begin(); it != vehicles->end(); it++) {
+		if (GetVehicle(it->first)->owner == player) return true;
 	}
 	return false;
 }
@@ -2561,16 +2934,81 @@ static void UpdateStationRating(Station *st)
 	}
 }
 
-/* called for every station each tick */
-static void StationHandleSmallTick(Station *st)
+/** Number of ticks between two rating updates of a station. */
+static const uint STATION_RATING_TICKS = 185;
+
+/**
+ * The rating schedule; a timing wheel with a slot for each tick of the
+ * rating cycle, holding the (sorted) stations whose rating is updated
+ * in that tick. Every station with facilities counts delete_ctr up each
+ * tick and updates the rating when it wraps to 0; instead of doing that
+ * the station is put in the slot in which its counter would wrap, and
+ * the counter is derived from the slot when it is needed.
+ */
+static std::vector<StationID> _station_rating_wheel[STATION_RATING_TICKS];
+static uint _station_rating_pos; ///< The slot of the last handled tick
+
+/**
+ * Get the value delete_ctr of a scheduled station would have had.
+ * @param st the scheduled station
+ * @return the number of ticks since the last rating update
+ */
+static byte GetStationRatingCounter(const Station *st)
+{
+	return (_station_rating_pos + STATION_RATING_TICKS - st->rating_slot) % STATION_RATING_TICKS;
+}
+
+/**
+ * (Un)schedule the rating updates of a station after its facilities
+ * changed from or to none, or after it got deleted.
+ * @param st the station to update the schedule of
+ */
+void UpdateStationRatingSchedule(Station *st)
+{
+	bool active = st->IsValid() && st->facilities != 0;
+	if (active == (st->rating_slot != Station::INVALID_RATING_SLOT)) return;
+
+	if (active) {
+		/* The counter continues where it stopped; it wraps on the next tick when it is at the end already */
+		uint ctr = min<uint>(st->delete_ctr, STATION_RATING_TICKS - 1);
+		st->rating_slot = (_station_rating_pos + STATION_RATING_TICKS - ctr) % STATION_RATING_TICKS;
+
+		std::vector<StationID> &slot = _station_rating_wheel[st->rating_slot];
+		slot.insert(std::lower_bound(slot.begin(), slot.end(), st->index), st->index);
+	} else {
+		st->delete_ctr = GetStationRatingCounter(st);
+
+		std::vector<StationID> &slot = _station_rating_wheel[st->rating_slot];
+		std::vector<StationID>::iterator it = std::lower_bound(slot.begin(), slot.end(), st->index);
+		assert(it != slot.end() && *it == st->index);
+		slot.erase(it);
+
+		st->rating_slot = Station::INVALID_RATING_SLOT;
+	}
+}
+
+/** Forget the rating schedule of all stations. */
+static void ResetStationRatingSchedule()
 {
-	if (st->facilities == 0) return;
+	for (uint i = 0; i < STATION_RATING_TICKS; i++) _station_rating_wheel[i].clear();
+	_station_rating_pos = 0;
+}
 
-	byte b = st->delete_ctr + 1;
-	if (b >= 185) b = 0;
-	st->delete_ctr = b;
+/**
+ * Rebuild the rating schedule from the counters of the stations, e.g.
+ * after loading a game.
+ */
+void RebuildStationRatingSchedule()
+{
+	Station *st;
+	FOR_ALL_STATIONS(st) {
+		if (st->rating_slot != Station::INVALID_RATING_SLOT) st->delete_ctr = GetStationRatingCounter(st);
+		st->rating_slot = Station::INVALID_RATING_SLOT;
+	}
+
+	ResetStationRatingSchedule();
 
-	if (b == 0) UpdateStationRating(st);
+	FOR_ALL_STATIONS(st) UpdateStationRatingSchedule(st);
 }
 
 void OnTick_Station()
@@ -2582,8 +3020,10 @@ void OnTick_Station()
 
 	if (IsValidStationID(i)) StationHandleBigTick(GetStation(i));
 
-	Station *st;
-	FOR_ALL_STATIONS(st) StationHandleSmallTick(st);
+	/* Update the ratings of the stations whose counter wraps this tick, in order of their index */
+	_station_rating_pos = (_station_rating_pos + 1) % STATION_RATING_TICKS;
+	const std::vector<StationID> &slot = _station_rating_wheel[_station_rating_pos];
+	for (uint j = 0; j < slot.size(); j++) UpdateStationRating(GetStation(slot[j]));
 }
 
 void StationMonthlyLoop()
@@ -2736,6 +3176,134 @@ StationSet FindStationsAroundIndustryTile(TileIndex tile, int w, int h)
 	return station_set;
 }
 
+/** Cached result of FindStationsAroundIndustryTile for one producer of cargo. */
+struct ProducerCatchment {
+	uint16 w;                        ///< Width of the producer
+	uint16 h;                        ///< Height of the producer
+	uint32 stamp;                    ///< Value of _catchment_stamp when the stations were looked up
+	std::vector<StationID> stations; ///< The stations around the producer, sorted by index
+};
+
+typedef std::map<TileIndex, ProducerCatchment> ProducerCatchmentCache;
+
+/**
+ * The stations around each producer of cargo, so MoveGoodsToStation does not
+ * have to scan the area around a house or industry every time it produces.
+ * The map is divided in blocks of CATCHMENT_BLOCK_SIZE tiles; changing a
+ * station stamps the blocks it covers, and a cached entry is stale when any
+ * block within its search area was stamped after the entry was made.
+ */
+static ProducerCatchmentCache _producer_catchment_cache;
+static uint32 *_catchment_block_stamps = NULL; ///< Stamp of the last change in each block
+static uint32 _catchment_stamp;                ///< Stamp of the last change anywhere
+static uint _catchment_blocks_x;               ///< Number of blocks in the X direction
+static uint _catchment_blocks_y;               ///< Number of blocks in the Y direction
+static bool _catchment_modified;               ///< Value of _patches.modified_catchment the cache was made for
+
+static const uint CATCHMENT_BLOCK_BITS = 4;
+
+/** Forget all cached producer catchments. */
+static void ResetStationCatchmentCache()
+{
+	_producer_catchment_cache.clear();
+	free(_catchment_block_stamps);
+	_catchment_block_stamps = NULL;
+	_catchment_blocks_x = 0;
+	_catchment_blocks_y = 0;
+	_catchment_stamp = 0;
+}
+
+/**
+ * Mark the stations in the given area as changed, so the cached stations
+ * around producers near them are looked up again.
+ * @param r the area, in tile coordinates, that contains the changed station tiles
+ */
+void InvalidateStationCatchmentCache(const Rect &r)
+{
+	if (_catchment_block_stamps == NULL) return;
+
+	uint x1 = min<uint>(max(r.left, 0),  MapMaxX()) >> CATCHMENT_BLOCK_BITS;
+	uint y1 = min<uint>(max(r.top, 0),   MapMaxY()) >> CATCHMENT_BLOCK_BITS;
+	uint x2 = min<uint>(max(r.right, 0), MapMaxX()) >> CATCHMENT_BLOCK_BITS;
+	uint y2 = min<uint>(max(r.bottom, 0), MapMaxY()) >> CATCHMENT_BLOCK_BITS;
+
+	_catchment_stamp++;
+	for (uint y = y1; y <= y2; y++) {
+		for (uint x = x1; x <= x2; x++) {
+			_catchment_block_stamps[y * _catchment_blocks_x + x] = _catchment_stamp;
+		}
+	}
+}
+
+/**
+ * Mark the station tile at the given position as changed.
+ * @param tile the changed station tile
+ */
+static void InvalidateStationCatchmentCache(TileIndex tile)
+{
+	Rect r = {(int)TileX(tile), (int)TileY(tile), (int)TileX(tile), (int)TileY(tile)};
+	InvalidateStationCatchmentCache(r);
+}
+
+/**
+ * Get the stations around a producer of cargo, using the cache when possible.
+ * @param tile north tile of the producer
+ * @param w    width of the producer
+ * @param h    height of the producer
+ * @return the stations, sorted by index; valid until the next call
+ */
+static const std::vector<StationID> &GetStationsAroundProducer(TileIndex tile, int w, int h)
+{
+	static std::vector<StationID> uncached;
+
+	uint blocks_x = MapSizeX() >> CATCHMENT_BLOCK_BITS;
+	uint blocks_y = MapSizeY() >> CATCHMENT_BLOCK_BITS;
+	if (_catchment_block_stamps == NULL || _catchment_blocks_x != blocks_x || _catchment_blocks_y != blocks_y || _catchment_modified != _patches.modified_catchment) {
+		ResetStationCatchmentCache();
+		_catchment_blocks_x = blocks_x;
+		_catchment_blocks_y = blocks_y;
+		_catchment_block_stamps = CallocT<uint32>(blocks_x * blocks_y);
+		_catchment_modified = _patches.modified_catchment;
+	}
+
+	/* The search area of FindStationsAroundIndustryTile; near the map edge
+	 * it wraps around, which the blocks cannot describe, so don't cache. */
+	int x1 = (int)TileX(tile) - MAX_CATCHMENT;
+	int y1 = (int)TileY(tile) - MAX_CATCHMENT;
+	int x2 = (int)TileX(tile) + w + MAX_CATCHMENT;
+	int y2 = (int)TileY(tile) + h + MAX_CATCHMENT;
+	bool cacheable = x1 >= 0 && y1 >= 0 && x2 <= (int)MapMaxX() && y2 <= (int)MapMaxY();
+
+	ProducerCatchment *pc = NULL;
+	if (cacheable) {
+		pc = &_producer_catchment_cache[tile];
+
+		uint32 stamp = 0;
+		for (uint y = y1 >> CATCHMENT_BLOCK_BITS; y <= (uint)y2 >> CATCHMENT_BLOCK_BITS; y++) {
+			for (uint x = x1 >> CATCHMENT_BLOCK_BITS; x <= (uint)x2 >> CATCHMENT_BLOCK_BITS; x++) {
+				stamp = max(stamp, _catchment_block_stamps[y * _catchment_blocks_x + x]);
+			}
+		}
+
+		/* A new entry has stamp 0 and no size, so it never matches. */
+		if (pc->w == w && pc->h == h && pc->stamp >= stamp) return pc->stations;
+
+		pc->w = w;
+		pc->h = h;
+		pc->stamp = _catchment_stamp;
+	}
+
+	std::vector<StationID> *list = (pc != NULL) ? &pc->stations : &uncached;
+	StationSet all_stations = FindStationsAroundIndustryTile(tile, w, h);
+	list->clear();
+	for (StationSet::iterator st_iter = all_stations.begin(); st_iter != all_stations.end(); ++st_iter) {
+		list->push_back((*st_iter)->index);
+	}
+	std::sort(list->begin(), list->end());
+
+	return *list;
+}
+
 uint MoveGoodsToStation(TileIndex tile, int w, int h, CargoID type, uint amount)
 {
 	Station *st1 = NULL;	// Station with best rating
@@ -2743,9 +3311,9 @@ uint MoveGoodsToStation(TileIndex tile, int w, int h, CargoID type, uint amount)
 	uint best_rating1 = 0;	// rating of st1
 	uint best_rating2 = 0;	// rating of st2
 
-	StationSet all_stations = FindStationsAroundIndustryTile(tile, w, h);
-	for (StationSet::iterator st_iter = all_stations.begin(); st_iter != all_stations.end(); ++st_iter) {
-		Station *st = *st_iter;
+	const std::vector<StationID> &all_stations = GetStationsAroundProducer(tile, w, h);
+	for (std::vector<StationID>::const_iterator st_iter = all_stations.begin(); st_iter != all_stations.end(); ++st_iter) {
+		Station *st = GetStation(*st_iter);
 
 		/* Is the station reserved exclusively for somebody else? */
 		if (st->town->exclusive_counter > 0 && st->town->exclusivity != st->owner) continue;
@@ -2820,6 +3388,8 @@ void BuildOilRig(TileIndex tile)
 	GenerateStationName(st, tile, STATIONNAMING_OILRIG);
 
 	MakeOilrig(tile, st->index);
+	InvalidateStationCatchmentCache(tile);
+	UpdateTileAcceptance(tile);
 
 	st->owner = OWNER_NONE;
 	st->airport_flags = 0;
@@ -2837,6 +3407,7 @@ void BuildOilRig(TileIndex tile)
 	st->last_vehicle_type = VEH_INVALID;
 	st->facilities = FACIL_AIRPORT | FACIL_DOCK;
 	st->build_date = _date;
+	UpdateStationRatingSchedule(st);
 
 	for (CargoID j = 0; j < NUM_CARGO; j++) {
 		st->goods[j].acceptance_pickup = 0;
@@ -2855,6 +3426,7 @@ void DeleteOilRig(TileIndex tile)
 	Station* st = GetStationByTile(tile);
 
 	MakeWater(tile);
+	InvalidateStationCatchmentCache(tile);
 
 	st->dock_tile = 0;
 	st->airport_tile = 0;
@@ -2958,6 +3530,9 @@ void InitializeStations()
 
 	_station_tick_ctr = 0;
 
+	ResetStationCatchmentCache();
+	ResetStationAcceptanceIndex();
+	ResetStationRatingSchedule();
 }
 
 
@@ -3136,7 +3711,7 @@ void SaveLoad_STNS(Station *st)
 		     SLE_VAR(GoodsEntry, last_age,            SLE_UINT8),
 		SLEG_CONDVAR(            _cargo_feeder_share, SLE_FILE_U32 | SLE_VAR_I64, 14, 64),
 		SLEG_CONDVAR(            _cargo_feeder_share, SLE_INT64,                  65, 67),
-		 SLE_CONDLST(GoodsEntry, cargo.packets,       REF_CARGO_PACKET,           68, SL_MAX_VERSION),
+		SLE_CONDDEQUE(GoodsEntry, cargo.packets,      REF_CARGO_PACKET,           68, SL_MAX_VERSION),
 
 		SLE_END()
 };
@@ -3183,6 +3758,9 @@ static void Save_STNS()
 	Station *st;
 	/* Write the stations */
 	FOR_ALL_STATIONS(st) {
+		/* The counter of scheduled stations is only known via the schedule */
+		if (st->rating_slot != Station::INVALID_RATING_SLOT) st->delete_ctr = GetStationRatingCounter(st);
+
 		SlSetArrayIndex(st->index);
 		SlAutolength((AutolengthProc*)SaveLoad_STNS, st);
 	}
@@ -15,6 +15,11 @@
 #include "core/alloc_func.hpp"
 #include "core/random_func.hpp"
 #include "settings_type.h"
+#include "thread.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* __SSE2__ */
 
 #include "table/strings.h"
 
@@ -264,9 +269,9 @@ static inline void FreeHeightMap()
 }
 
 /** RandomHeight() generator */
-static inline height_t RandomHeight(amplitude_t rMax)
+static inline height_t RandomHeight(Randomizer &r, amplitude_t rMax)
 {
-	amplitude_t ra = (Random() << 16) | (Random() & 0x0000FFFF);
+	amplitude_t ra = (r.Next() << 16) | (r.Next() & 0x0000FFFF);
 	height_t rh;
 	/* Scale the amplitude for better resolution */
 	rMax *= 16;
@@ -275,56 +280,170 @@ static inline height_t RandomHeight(amplitude_t rMax)
 	return rh;
 }
 
-/** One interpolation and noise round */
-static bool ApplyNoise(uint log_frequency, amplitude_t amplitude)
+/**
+ * Seed the random generator for one row of one noise round. Every row has
+ * its own stream derived from the generation seed, so the rows can be done
+ * by any thread in any order and the same seed still gives the same map.
+ * @param r             the random generator to seed
+ * @param log_frequency the noise round
+ * @param y             the row
+ */
+static void SetNoiseRowSeed(Randomizer &r, uint log_frequency, uint y)
 {
-	uint size_min = min(_height_map.size_x, _height_map.size_y);
-	uint step = size_min >> log_frequency;
-	uint x, y;
+	uint32 seed = _patches.generation_seed ^ (log_frequency * 0x9E3779B9U) ^ (y * 0x85EBCA6BU);
 
-	assert(_height_map.h != NULL);
+	/* Mix the bits, so neighbouring rows do not get similar streams */
+	seed ^= seed >> 16;
+	seed *= 0x7FEB352DU;
+	seed ^= seed >> 15;
+	seed *= 0x846CA68BU;
+	seed ^= seed >> 16;
 
-	/* Are we finished? */
-	if (step == 0) return false;
+	r.SetSeed(seed);
+}
 
-	if (log_frequency == 0) {
-		/* This is first round, we need to establish base heights with step = size_min */
-		for (y = 0; y <= _height_map.size_y; y += step) {
-			for (x = 0; x <= _height_map.size_x; x += step) {
-				height_t height = (amplitude > 0) ? RandomHeight(amplitude) : 0;
-				HeightMapXY(x, y) = height;
-			}
+/** Parameters of one interpolation and noise round, shared by the threads doing it */
+struct NoiseRound {
+	uint log_frequency;    ///< log2 of the frequency of this round
+	uint step;             ///< distance between the points of this round
+	amplitude_t amplitude; ///< amplitude of the noise added in this round
+};
+
+/** Establish base heights for the rows [first, last) of points of the first round */
+static void ApplyBaseNoise(uint first, uint last, void *data)
+{
+	const NoiseRound *nr = (const NoiseRound*)data;
+	Randomizer r;
+
+	for (uint i = first; i < last; i++) {
+		uint y = i * nr->step;
+		SetNoiseRowSeed(r, nr->log_frequency, y);
+		for (uint x = 0; x <= _height_map.size_x; x += nr->step) {
+			height_t height = (nr->amplitude > 0) ? RandomHeight(r, nr->amplitude) : 0;
+			HeightMapXY(x, y) = height;
 		}
-		return true;
 	}
+}
 
-	/* It is regular iteration round.
-	 * Interpolate height values at odd x, even y tiles */
-	for (y = 0; y <= _height_map.size_y; y += 2 * step) {
-		for (x = 0; x < _height_map.size_x; x += 2 * step) {
+/** Interpolate height values at odd x, even y points for the even rows [first, last) */
+static void InterpolateNoiseX(uint first, uint last, void *data)
+{
+	uint step = ((const NoiseRound*)data)->step;
+
+	for (uint i = first; i < last; i++) {
+		uint y = i * 2 * step;
+		for (uint x = 0; x < _height_map.size_x; x += 2 * step) {
 			height_t h00 = HeightMapXY(x + 0 * step, y);
 			height_t h02 = HeightMapXY(x + 2 * step, y);
 			height_t h01 = (h00 + h02) / 2;
 			HeightMapXY(x + 1 * step, y) = h01;
 		}
 	}
+}
 
-	/* Interpolate height values at odd y tiles */
-	for (y = 0; y < _height_map.size_y; y += 2 * step) {
-		for (x = 0; x <= _height_map.size_x; x += step) {
+/**
+ * Set the heights of a row to the average of the heights in two other rows,
+ * rounded the same way as (a + b) / 2 does.
+ * @param dst   the row to write
+ * @param a     the first row to read
+ * @param b     the second row to read
+ * @param count the number of heights in the rows
+ */
+static void InterpolateHeightRow(height_t *dst, const height_t *a, const height_t *b, uint count)
+{
+	uint x = 0;
+
+#if defined(__SSE2__)
+	/* Eight heights at a time. They are sign extended to 32 bits first, so
+	 * the sum cannot overflow; negative sums get one added before the shift
+	 * to round towards zero like the division does. */
+	for (; x + 8 <= count; x += 8) {
+		__m128i va = _mm_loadu_si128((const __m128i*)(a + x));
+		__m128i vb = _mm_loadu_si128((const __m128i*)(b + x));
+
+		__m128i lo = _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(va, va), 16), _mm_srai_epi32(_mm_unpacklo_epi16(vb, vb), 16));
+		__m128i hi = _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(va, va), 16), _mm_srai_epi32(_mm_unpackhi_epi16(vb, vb), 16));
+		lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_srli_epi32(lo, 31)), 1);
+		hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_srli_epi32(hi, 31)), 1);
+
+		_mm_storeu_si128((__m128i*)(dst + x), _mm_packs_epi32(lo, hi));
+	}
+#endif /* __SSE2__ */
+
+	for (; x < count; x++) dst[x] = (a[x] + b[x]) / 2;
+}
+
+/** Interpolate height values at the odd rows [first, last) */
+static void InterpolateNoiseY(uint first, uint last, void *data)
+{
+	uint step = ((const NoiseRound*)data)->step;
+
+	for (uint i = first; i < last; i++) {
+		uint y = i * 2 * step;
+
+		if (step == 1) {
+			/* The last round interpolates whole rows of tiles */
+			InterpolateHeightRow(&HeightMapXY(0, y + 1), &HeightMapXY(0, y), &HeightMapXY(0, y + 2), _height_map.dim_x);
+			continue;
+		}
+
+		for (uint x = 0; x <= _height_map.size_x; x += step) {
 			height_t h00 = HeightMapXY(x, y + 0 * step);
 			height_t h20 = HeightMapXY(x, y + 2 * step);
 			height_t h10 = (h00 + h20) / 2;
 			HeightMapXY(x, y + 1 * step) = h10;
 		}
 	}
+}
 
-	for (y = 0; y <= _height_map.size_y; y += step) {
-		for (x = 0; x <= _height_map.size_x; x += step) {
-			HeightMapXY(x, y) += RandomHeight(amplitude);
+/** Add noise to the rows [first, last) of points of a round */
+static void AddNoise(uint first, uint last, void *data)
+{
+	const NoiseRound *nr = (const NoiseRound*)data;
+	Randomizer r;
+
+	for (uint i = first; i < last; i++) {
+		uint y = i * nr->step;
+		SetNoiseRowSeed(r, nr->log_frequency, y);
+		for (uint x = 0; x <= _height_map.size_x; x += nr->step) {
+			HeightMapXY(x, y) += RandomHeight(r, nr->amplitude);
 		}
 	}
-	return (step > 1);
+}
+
+/** One interpolation and noise round */
+static bool ApplyNoise(uint log_frequency, amplitude_t amplitude)
+{
+	uint size_min = min(_height_map.size_x, _height_map.size_y);
+	NoiseRound nr;
+
+	assert(_height_map.h != NULL);
+
+	nr.log_frequency = log_frequency;
+	nr.step = size_min >> log_frequency;
+	nr.amplitude = amplitude;
+
+	/* Are we finished? */
+	if (nr.step == 0) return false;
+
+	/* The rows of each pass do not depend on each other, so the threads
+	 * each get some of them; every pass has to finish before the next
+	 * one can start though. */
+	if (log_frequency == 0) {
+		/* This is first round, we need to establish base heights with step = size_min */
+		OTTDParallelFor(0, _height_map.size_y / nr.step + 1, &ApplyBaseNoise, &nr);
+		return true;
+	}
+
+	/* It is regular iteration round.
+	 * Interpolate height values at odd x, even y tiles */
+	OTTDParallelFor(0, _height_map.size_y / (2 * nr.step) + 1, &InterpolateNoiseX, &nr);
+
+	/* Interpolate height values at odd y tiles */
+	OTTDParallelFor(0, _height_map.size_y / (2 * nr.step), &InterpolateNoiseY, &nr);
+
+	OTTDParallelFor(0, _height_map.size_y / nr.step + 1, &AddNoise, &nr);
+	return (nr.step > 1);
 }
 
 /** Base Perlin noise generator - fills height map with raw Perlin noise */
@@ -391,12 +510,20 @@ static int *HeightMapMakeHistogram(height_t h_min, height_t h_max, int *hist_buf
 	return hist;
 }
 
-/** Applies sine wave redistribution onto height map */
-static void HeightMapSineTransform(height_t h_min, height_t h_max)
+/** Range of heights to transform, shared by the threads doing it */
+struct HeightRange {
+	height_t h_min; ///< lowest height of the range
+	height_t h_max; ///< highest height of the range
+};
+
+/** Applies sine wave redistribution onto the rows [first, last) of the height map */
+static void HeightMapSineTransformRows(uint first, uint last, void *data)
 {
+	height_t h_min = ((const HeightRange*)data)->h_min;
+	height_t h_max = ((const HeightRange*)data)->h_max;
 	height_t *h;
 
-	FOR_ALL_TILES_IN_HEIGHT(h) {
+	for (h = &HeightMapXY(0, first); h < &HeightMapXY(0, last); h++) {
 		double fheight;
 
 		if (*h < h_min) continue;
@@ -468,12 +595,42 @@ static void HeightMapSineTransform(height_t h_min, height_t h_max)
 	}
 }
 
+/** Applies sine wave redistribution onto height map */
+static void HeightMapSineTransform(height_t h_min, height_t h_max)
+{
+	HeightRange range = { h_min, h_max };
+	OTTDParallelFor(0, _height_map.size_y + 1, &HeightMapSineTransformRows, &range);
+}
+
+/** Parameters of the water level transformation, shared by the threads doing it */
+struct WaterLevelTransform {
+	height_t h_water_level; ///< height that becomes the sea level
+	height_t h_max;         ///< highest height of the height map
+	height_t h_max_new;     ///< highest height after the transformation
+};
+
+/** Transform the rows [first, last) of the height map for the new water level */
+static void HeightMapTransformWaterLevelRows(uint first, uint last, void *data)
+{
+	height_t h_water_level = ((const WaterLevelTransform*)data)->h_water_level;
+	height_t h_max         = ((const WaterLevelTransform*)data)->h_max;
+	height_t h_max_new     = ((const WaterLevelTransform*)data)->h_max_new;
+	height_t *h;
+
+	for (h = &HeightMapXY(0, first); h < &HeightMapXY(0, last); h++) {
+		/* Transform height from range h_water_level..h_max into 0..h_max_new range */
+		*h = (height_t)(((int)h_max_new) * (*h - h_water_level) / (h_max - h_water_level)) + I2H(1);
+		/* Make sure all values are in the proper range (0..h_max_new) */
+		if (*h < 0) *h = I2H(0);
+		if (*h >= h_max_new) *h = h_max_new - 1;
+	}
+}
+
 /** Adjusts heights in height map to contain required amount of water tiles */
 static void HeightMapAdjustWaterLevel(amplitude_t water_percent, height_t h_max_new)
 {
 	height_t h_min, h_max, h_avg, h_water_level;
 	int water_tiles, desired_water_tiles;
-	height_t *h;
 	int *hist;
 
 	HeightMapGetMinMaxAvg(&h_min, &h_max, &h_avg);
@@ -498,49 +655,24 @@ static void HeightMapAdjustWaterLevel(amplitude_t water_percent, height_t h_max_
 	 *   values from range: h_water_level..h_max are transformed into 0..h_max_new
 	 * , where h_max_new is 4, 8, 12 or 16 depending on terrain type (very flat, flat, hilly, mountains)
 	 */
-	FOR_ALL_TILES_IN_HEIGHT(h) {
-		/* Transform height from range h_water_level..h_max into 0..h_max_new range */
-		*h = (height_t)(((int)h_max_new) * (*h - h_water_level) / (h_max - h_water_level)) + I2H(1);
-		/* Make sure all values are in the proper range (0..h_max_new) */
-		if (*h < 0) *h = I2H(0);
-		if (*h >= h_max_new) *h = h_max_new - 1;
-	}
+	WaterLevelTransform wlt = { h_water_level, h_max, h_max_new };
+	OTTDParallelFor(0, _height_map.size_y + 1, &HeightMapTransformWaterLevelRows, &wlt);
 
 	free(hist_buf);
 }
 
 static double perlin_coast_noise_2D(const double x, const double y, const double p, const int prime);
 
-/**
- * This routine sculpts in from the edge a random amount, again a Perlin
- * sequence, to avoid the rigid flat-edge slopes that were present before. The
- * Perlin noise map doesnt know where we are going to slice across, and so we
- * often cut straight through high terrain. the smoothing routine makes it
- * legal, gradually increasing up from the edge to the original terrain height.
- * By cutting parts of this away, it gives a far more irregular edge to the
- * map-edge. Sometimes it works beautifully with the existing sea & lakes, and
- * creates a very realistic coastline. Other times the variation is less, and
- * the map-edge shows its cliff-like roots.
- *
- * This routine may be extended to randomly sculpt the height of the terrain
- * near the edge. This will have the coast edge at low level (1-3), rising in
- * smoothed steps inland to about 15 tiles in. This should make it look as
- * though the map has been built for the map size, rather than a slice through
- * a larger map.
- *
- * Please note that all the small numbers; 53, 101, 167, etc. are small primes
- * to help give the perlin noise a bit more of a random feel.
- */
-static void HeightMapCoastLines()
+/** The rows [first, last) part of HeightMapCoastLines */
+static void HeightMapCoastLineRows(uint first, uint last, void *data)
 {
 	int smallest_size = min(_patches.map_x, _patches.map_y);
 	const int margin = 4;
 	uint y, x;
 	double max_x;
-	double max_y;
 
 	/* Lower to sea level */
-	for (y = 0; y <= _height_map.size_y; y++) {
+	for (y = first; y < last; y++) {
 		/* Top right */
 		max_x = abs((perlin_coast_noise_2D(_height_map.size_y - y, y, 0.9, 53) + 0.25) * 5 + (perlin_coast_noise_2D(y, y, 0.35, 179) + 1) * 12);
 		max_x = max((smallest_size * smallest_size / 16) + max_x, (smallest_size * smallest_size / 16) + margin - max_x);
@@ -557,9 +689,18 @@ static void HeightMapCoastLines()
 			HeightMapXY(x, y) = 0;
 		}
 	}
+}
+
+/** The columns [first, last) part of HeightMapCoastLines */
+static void HeightMapCoastLineColumns(uint first, uint last, void *data)
+{
+	int smallest_size = min(_patches.map_x, _patches.map_y);
+	const int margin = 4;
+	uint y, x;
+	double max_y;
 
 	/* Lower to sea level */
-	for (x = 0; x <= _height_map.size_x; x++) {
+	for (x = first; x < last; x++) {
 		/* Top left */
 		max_y = abs((perlin_coast_noise_2D(x, _height_map.size_y / 2, 0.9, 167) + 0.4) * 5 + (perlin_coast_noise_2D(x, _height_map.size_y / 3, 0.4, 211) + 0.7) * 9);
 		max_y = max((smallest_size * smallest_size / 16) + max_y, (smallest_size * smallest_size / 16) + margin - max_y);
@@ -579,6 +720,33 @@ static void HeightMapCoastLines()
 	}
 }
 
+/**
+ * This routine sculpts in from the edge a random amount, again a Perlin
+ * sequence, to avoid the rigid flat-edge slopes that were present before. The
+ * Perlin noise map doesnt know where we are going to slice across, and so we
+ * often cut straight through high terrain. the smoothing routine makes it
+ * legal, gradually increasing up from the edge to the original terrain height.
+ * By cutting parts of this away, it gives a far more irregular edge to the
+ * map-edge. Sometimes it works beautifully with the existing sea & lakes, and
+ * creates a very realistic coastline. Other times the variation is less, and
+ * the map-edge shows its cliff-like roots.
+ *
+ * This routine may be extended to randomly sculpt the height of the terrain
+ * near the edge. This will have the coast edge at low level (1-3), rising in
+ * smoothed steps inland to about 15 tiles in. This should make it look as
+ * though the map has been built for the map size, rather than a slice through
+ * a larger map.
+ *
+ * Please note that all the small numbers; 53, 101, 167, etc. are small primes
+ * to help give the perlin noise a bit more of a random feel.
+ */
+static void HeightMapCoastLines()
+{
+	/* The noise of every row and column only depends on its coordinate */
+	OTTDParallelFor(0, _height_map.size_y + 1, &HeightMapCoastLineRows, NULL);
+	OTTDParallelFor(0, _height_map.size_x + 1, &HeightMapCoastLineColumns, NULL);
+}
+
 /** Start at given point, move in given direction, find and Smooth coast in that direction */
 static void HeightMapSmoothCoastInDirection(int org_x, int org_y, int dir_x, int dir_y)
 {
@@ -632,28 +800,114 @@ static void HeightMapSmoothCoasts()
 	}
 }
 
+/** Parameters of a slope smoothing pass, shared by the threads doing it */
+struct SmoothSlopesPass {
+	height_t dh_max; ///< maximum height difference between neighbouring tiles
+	height_t *edge;  ///< the smoothed row the columns start from
+};
+
+/** Smooth the rows [first, last) from west to east */
+static void HeightMapSmoothSlopesRowsForward(uint first, uint last, void *data)
+{
+	height_t dh_max = ((const SmoothSlopesPass*)data)->dh_max;
+
+	for (uint y = first; y < last; y++) {
+		for (uint x = 1; x <= _height_map.size_x; x++) {
+			height_t h_max = HeightMapXY(x - 1, y) + dh_max;
+			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
+		}
+	}
+}
+
+/** Smooth the columns [first, last) from north to south */
+static void HeightMapSmoothSlopesColumnsForward(uint first, uint last, void *data)
+{
+	height_t dh_max = ((const SmoothSlopesPass*)data)->dh_max;
+	const height_t *edge = ((const SmoothSlopesPass*)data)->edge;
+
+	for (uint x = first; x < last; x++) {
+		height_t h_max = edge[x] + dh_max;
+		if (HeightMapXY(x, 1) > h_max) HeightMapXY(x, 1) = h_max;
+	}
+	for (uint y = 2; y <= _height_map.size_y; y++) {
+		for (uint x = first; x < last; x++) {
+			height_t h_max = HeightMapXY(x, y - 1) + dh_max;
+			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
+		}
+	}
+}
+
+/** Smooth the rows [first, last) from east to west */
+static void HeightMapSmoothSlopesRowsBackward(uint first, uint last, void *data)
+{
+	height_t dh_max = ((const SmoothSlopesPass*)data)->dh_max;
+
+	for (uint y = first; y < last; y++) {
+		for (int x = _height_map.size_x - 1; x >= 0; x--) {
+			height_t h_max = HeightMapXY(x + 1, y) + dh_max;
+			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
+		}
+	}
+}
+
+/** Smooth the columns [first, last) from south to north */
+static void HeightMapSmoothSlopesColumnsBackward(uint first, uint last, void *data)
+{
+	height_t dh_max = ((const SmoothSlopesPass*)data)->dh_max;
+	const height_t *edge = ((const SmoothSlopesPass*)data)->edge;
+
+	for (uint x = first; x < last; x++) {
+		height_t h_max = edge[x] + dh_max;
+		if (HeightMapXY(x, _height_map.size_y - 1) > h_max) HeightMapXY(x, _height_map.size_y - 1) = h_max;
+	}
+	for (int y = _height_map.size_y - 2; y >= 0; y--) {
+		for (uint x = first; x < last; x++) {
+			height_t h_max = HeightMapXY(x, y + 1) + dh_max;
+			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
+		}
+	}
+}
+
 /**
  * This routine provides the essential cleanup necessary before OTTD can
  * display the terrain. When generated, the terrain heights can jump more than
  * one level between tiles. This routine smooths out those differences so that
  * the most it can change is one level. When OTTD can support cliffs, this
  * routine may not be necessary.
+ *
+ * Each pass limits a tile by its already limited neighbours with a lower
+ * (first pass) or higher (second pass) x and y. So a tile ends up at most
+ * dh_max times the distance higher than any of the tiles in that direction,
+ * which gives the same result when all rows are done first and all columns
+ * next; both of those parallelise well. The edge row and column a pass
+ * starts from are not changed by it.
  */
 static void HeightMapSmoothSlopes(height_t dh_max)
 {
-	int x, y;
-	for (y = 1; y <= (int)_height_map.size_y; y++) {
-		for (x = 1; x <= (int)_height_map.size_x; x++) {
-			height_t h_max = min(HeightMapXY(x - 1, y), HeightMapXY(x, y - 1)) + dh_max;
-			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
-		}
+	SmoothSlopesPass ssp;
+	ssp.dh_max = dh_max;
+	ssp.edge = MallocT<height_t>(_height_map.dim_x);
+
+	/* Smooth towards the south; the north edge only affects the tiles
+	 * directly south of it, so smooth a copy of it */
+	ssp.edge[0] = _invalid_height;
+	ssp.edge[1] = HeightMapXY(1, 0);
+	for (uint x = 2; x <= _height_map.size_x; x++) {
+		ssp.edge[x] = min<int>(HeightMapXY(x, 0), ssp.edge[x - 1] + dh_max);
 	}
-	for (y = _height_map.size_y - 1; y >= 0; y--) {
-		for (x = _height_map.size_x - 1; x >= 0; x--) {
-			height_t h_max = min(HeightMapXY(x + 1, y), HeightMapXY(x, y + 1)) + dh_max;
-			if (HeightMapXY(x, y) > h_max) HeightMapXY(x, y) = h_max;
-		}
+	OTTDParallelFor(1, _height_map.size_y + 1, &HeightMapSmoothSlopesRowsForward, &ssp);
+	OTTDParallelFor(1, _height_map.size_x + 1, &HeightMapSmoothSlopesColumnsForward, &ssp);
+
+	/* Smooth towards the north */
+	ssp.edge[_height_map.size_x] = _invalid_height;
+	ssp.edge[_height_map.size_x - 1] = HeightMapXY(_height_map.size_x - 1, _height_map.size_y);
+	for (int x = _height_map.size_x - 2; x >= 0; x--) {
+		ssp.edge[x] = min<int>(HeightMapXY(x, _height_map.size_y), ssp.edge[x + 1] + dh_max);
 	}
+	OTTDParallelFor(0, _height_map.size_y, &HeightMapSmoothSlopesRowsBackward, &ssp);
+	OTTDParallelFor(0, _height_map.size_x, &HeightMapSmoothSlopesColumnsBackward, &ssp);
+
+	free(ssp.edge);
 }
 
 /** Height map terraform post processing:
@@ -700,9 +954,12 @@ static const double _perlin_p_values[][7] = {    // perlin frequency per power
  * prime is used to allow the perlin noise generator to create useful random
  * numbers from slightly different series.
  */
-static double int_noise(const long x, const long y, const int prime)
+static double int_noise(const int x, const int y, const int prime)
 {
-	long n = x + y * prime + _patches.generation_seed;
+	/* Only the lowest 31 bits of the result are used, so doing this with
+	 * unsigned 32 bits integers gives the same result as with 64 bits, and
+	 * it cannot overflow into undefined behaviour. */
+	uint32 n = (uint32)x + (uint32)y * (uint32)prime + _patches.generation_seed;
 
 	n = (n << 13) ^ n;
 
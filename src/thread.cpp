@@ -5,6 +5,7 @@
 #include "stdafx.h"
 #include "thread.h"
 #include "core/alloc_func.hpp"
+#include "core/math_func.hpp"
 #include <stdlib.h>
 
 #if defined(__AMIGA__) || defined(PSP) || defined(NO_THREADS)
@@ -311,3 +312,97 @@ void OTTDExitThread()
 }
 
 #endif
+
+
+#if defined(WIN32)
+#include <windows.h>
+#elif defined(UNIX)
+#include <unistd.h>
+#endif
+
+/**
+ * Get the number of processors that can run threads at the same time.
+ * @return the number of processors, at least 1
+ */
+uint OTTDGetNumberOfCPUs()
+{
+	static uint count = 0;
+	if (count != 0) return count;
+
+#if defined(__AMIGA__) || defined(PSP) || defined(NO_THREADS)
+	count = 1;
+#elif defined(WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	count = max<uint>(info.dwNumberOfProcessors, 1);
+#elif defined(UNIX) && defined(_SC_NPROCESSORS_ONLN)
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	count = (n > 0) ? (uint)n : 1;
+#else
+	count = 1;
+#endif
+	return count;
+}
+
+/** A part of the work of an OTTDParallelFor. */
+struct OTTDParallelPart {
+	OTTDParallelFunc func; ///< function to call
+	void *data;            ///< data to pass to the function
+	uint first;            ///< first item of this part
+	uint last;             ///< one past the last item of this part
+};
+
+static void *OTTDParallelProxy(void *arg)
+{
+	OTTDParallelPart *part = (OTTDParallelPart*)arg;
+	part->func(part->first, part->last, part->data);
+	return NULL;
+}
+
+/**
+ * Call a function for the range [first, last), split over as many threads
+ * as there are processors. Each thread gets one contiguous part of the
+ * range; this function returns when all parts are done. When threads
+ * cannot be made, the parts are handled by the calling thread.
+ * @param first first item of the range
+ * @param last  one past the last item of the range
+ * @param func  the function to call for each part
+ * @param data  data to pass to the function
+ */
+void OTTDParallelFor(uint first, uint last, OTTDParallelFunc func, void *data)
+{
+	if (first >= last) return;
+
+	uint num_parts = min(OTTDGetNumberOfCPUs(), last - first);
+	if (num_parts <= 1) {
+		func(first, last, data);
+		return;
+	}
+
+	OTTDParallelPart *parts = MallocT<OTTDParallelPart>(num_parts);
+	OTTDThread **threads = CallocT<OTTDThread*>(num_parts);
+
+	for (uint i = 0; i < num_parts; i++) {
+		parts[i].func  = func;
+		parts[i].data  = data;
+		parts[i].first = first + (uint)((uint64)(last - first) * i / num_parts);
+		parts[i].last  = first + (uint)((uint64)(last - first) * (i + 1) / num_parts);
+	}
+
+	/* The first part is done by this thread */
+	for (uint i = 1; i < num_parts; i++) {
+		threads[i] = OTTDCreateThread(&OTTDParallelProxy, &parts[i]);
+	}
+	OTTDParallelProxy(&parts[0]);
+
+	for (uint i = 1; i < num_parts; i++) {
+		if (threads[i] != NULL) {
+			OTTDJoinThread(threads[i]);
+		} else {
+			OTTDParallelProxy(&parts[i]);
+		}
+	}
+
+	free(threads);
+	free(parts);
+}
@@ -13,4 +13,15 @@ OTTDThread *OTTDCreateThread(OTTDThreadFunc, void*);
 void       *OTTDJoinThread(OTTDThread*);
 void        OTTDExitThread();
 
+/**
+ * Function running a part of an OTTDParallelFor.
+ * @param first first item of the part to handle
+ * @param last  one past the last item of the part to handle
+ * @param data  the data passed to OTTDParallelFor
+ */
+typedef void (*OTTDParallelFunc)(uint first, uint last, void *data);
+
+uint OTTDGetNumberOfCPUs();
+void OTTDParallelFor(uint first, uint last, OTTDParallelFunc func, void *data);
+
 #endif /* THREAD_H */
@@ -877,6 +877,7 @@ CommandCost CmdBuildRailVehicle(TileIndex tile, uint32 flags, uint32 p1, uint32
 				NormalizeTrainVehInDepot(v);
 			}
 
+			AddVehicleToPlayerVehicles(v);
 			InvalidateWindowData(WC_VEHICLE_DEPOT, v->tile);
 			RebuildVehicleLists();
 			InvalidateWindow(WC_COMPANY, v->owner);
@@ -1476,6 +1477,7 @@ CommandCost CmdSellRailWagon(TileIndex tile, uint32 flags, uint32 p1, uint32 p2)
 					new_f->orders          = first->orders;
 					new_f->num_orders      = first->num_orders;
 					new_f->group_id        = first->group_id;
+					MoveVehicleInOrderDestinationIndex(first, new_f);
 
 					if (first->prev_shared != NULL) {
 						first->prev_shared->next_shared = new_f;
@@ -20,6 +20,7 @@
 #include "player_func.h"
 #include "sound_func.h"
 #include "settings_type.h"
+#include "core/random_func.hpp"
 #include "water_map.h"
 #include "water.h"
 
@@ -162,18 +163,19 @@ static void PlaceTree(TileIndex tile, uint32 r)
 /**
  * Place some amount of trees around a given tile.
  *
- * This function adds some trees around a given tile. As this function use
- * the Random() call it depends on the random how many trees are actually placed
- * around the given tile.
+ * This function adds some trees around a given tile. As this function uses
+ * the given random generator it depends on that generator how many trees are
+ * actually placed around the given tile.
  *
  * @param tile The center of the trees to add
+ * @param rnd The random generator to use
  */
-static void DoPlaceMoreTrees(TileIndex tile)
+static void DoPlaceMoreTrees(TileIndex tile, Randomizer &rnd)
 {
 	uint i;
 
 	for (i = 0; i < 1000; i++) {
-		uint32 r = Random();
+		uint32 r = rnd.Next();
 		int x = GB(r, 0, 5) - 16;
 		int y = GB(r, 8, 5) - 16;
 		uint dist = abs(x) + abs(y);
@@ -185,6 +187,15 @@ static void DoPlaceMoreTrees(TileIndex tile)
 	}
 }
 
+/** The part of PlaceMoreTrees for one region of the map */
+static void PlaceMoreTreesInRegion(uint region, Randomizer &rnd, void *data)
+{
+	uint i = GetGenerateWorldRegionShare(*(const uint*)data, region);
+	for (; i != 0; i--) {
+		DoPlaceMoreTrees(RandomTileInRegionSeed(region, rnd.Next()), rnd);
+	}
+}
+
 /**
  * Place more trees on the map.
  *
@@ -193,9 +204,7 @@ static void DoPlaceMoreTrees(TileIndex tile)
 static void PlaceMoreTrees()
 {
 	uint i = ScaleByMapSize(GB(Random(), 0, 5) + 25);
-	do {
-		DoPlaceMoreTrees(RandomTile());
-	} while (--i);
+	GenerateWorldInRegions(GWP_TREE, &PlaceMoreTreesInRegion, &i);
 }
 
 /**
@@ -206,13 +215,14 @@ static void PlaceMoreTrees()
  *
  * @param tile The base tile to add a new tree somewhere around
  * @param height The height (like the one from the tile)
+ * @param rnd The random generator to use
  */
-static void PlaceTreeAtSameHeight(TileIndex tile, uint height)
+static void PlaceTreeAtSameHeight(TileIndex tile, uint height, Randomizer &rnd)
 {
 	uint i;
 
 	for (i = 0; i < 1000; i++) {
-		uint32 r = Random();
+		uint32 r = rnd.Next();
 		int x = GB(r, 0, 5) - 16;
 		int y = GB(r, 8, 5) - 16;
 		TileIndex cur_tile = TILE_MASK(tile + TileDiffXY(x, y));
@@ -232,21 +242,14 @@ static void PlaceTreeAtSameHeight(TileIndex tile, uint height)
 	}
 }
 
-/**
- * Place some trees randomly
- *
- * This function just place some trees randomly on the map.
- */
-void PlaceTreesRandomly()
+/** The part of PlaceTreesRandomly for one region of the map */
+static void PlaceTreesRandomlyInRegion(uint region, Randomizer &rnd, void *data)
 {
 	uint i, j, ht;
 
-	i = ScaleByMapSize(1000);
-	do {
-		uint32 r = Random();
-		TileIndex tile = RandomTileSeed(r);
-
-		IncreaseGeneratingWorldProgress(GWP_TREE);
+	for (i = GetGenerateWorldRegionShare(ScaleByMapSize(1000), region); i != 0; i--) {
+		uint32 r = rnd.Next();
+		TileIndex tile = RandomTileInRegionSeed(region, r);
 
 		if (CanPlantTreesOnTile(tile, true)) {
 			PlaceTree(tile, r);
@@ -261,32 +264,40 @@ void PlaceTreesRandomly()
 			while (j--) {
 				/* Above snowline more trees! */
 				if (_opt.landscape == LT_ARCTIC && ht > GetSnowLine()) {
-					PlaceTreeAtSameHeight(tile, ht);
-					PlaceTreeAtSameHeight(tile, ht);
+					PlaceTreeAtSameHeight(tile, ht, rnd);
+					PlaceTreeAtSameHeight(tile, ht, rnd);
 				};
 
-				PlaceTreeAtSameHeight(tile, ht);
+				PlaceTreeAtSameHeight(tile, ht, rnd);
 			}
 		}
-	} while (--i);
+	}
 
 	/* place extra trees at rainforest area */
 	if (_opt.landscape == LT_TROPIC) {
-		i = ScaleByMapSize(15000);
-
-		do {
-			uint32 r = Random();
-			TileIndex tile = RandomTileSeed(r);
-
-			IncreaseGeneratingWorldProgress(GWP_TREE);
+		for (i = GetGenerateWorldRegionShare(ScaleByMapSize(15000), region); i != 0; i--) {
+			uint32 r = rnd.Next();
+			TileIndex tile = RandomTileInRegionSeed(region, r);
 
 			if (GetTropicZone(tile) == TROPICZONE_RAINFOREST && CanPlantTreesOnTile(tile, false)) {
 				PlaceTree(tile, r);
 			}
-		} while (--i);
+		}
 	}
 }
 
+/**
+ * Place some trees randomly
+ *
+ * This function just place some trees randomly on the map. The trees are
+ * placed at most 16 tiles from the tile that is picked, so the regions of
+ * the map can be done at the same time.
+ */
+void PlaceTreesRandomly()
+{
+	GenerateWorldInRegions(GWP_TREE, &PlaceTreesRandomlyInRegion, NULL);
+}
+
 /**
  * Place new trees.
  *
@@ -299,18 +310,18 @@ void GenerateTrees()
 
 	if (_patches.tree_placer == TP_NONE) return;
 
-	if (_opt.landscape != LT_TOYLAND) PlaceMoreTrees();
-
 	switch (_patches.tree_placer) {
 		case TP_ORIGINAL: i = _opt.landscape == LT_ARCTIC ? 15 : 6; break;
 		case TP_IMPROVED: i = _opt.landscape == LT_ARCTIC ?  4 : 2; break;
 		default: NOT_REACHED(); return;
 	}
 
-	total = ScaleByMapSize(1000);
-	if (_opt.landscape == LT_TROPIC) total += ScaleByMapSize(15000);
-	total *= i;
-	SetGeneratingWorldProgress(GWP_TREE, total);
+	/* The progress is increased twice for every pass over the map */
+	total = i;
+	if (_opt.landscape != LT_TOYLAND) total++;
+	SetGeneratingWorldProgress(GWP_TREE, 2 * total);
+
+	if (_opt.landscape != LT_TOYLAND) PlaceMoreTrees();
 
 	for (; i != 0; i--) {
 		PlaceTreesRandomly();
@@ -71,6 +71,11 @@ void UpdateCompanyHQ(Player *p, uint score)
 
 	EnlargeCompanyHQ(tile, val);
 
+	UpdateTileAcceptance(tile + TileDiffXY(0, 0));
+	UpdateTileAcceptance(tile + TileDiffXY(0, 1));
+	UpdateTileAcceptance(tile + TileDiffXY(1, 0));
+	UpdateTileAcceptance(tile + TileDiffXY(1, 1));
+
 	MarkTileDirtyByTile(tile + TileDiffXY(0, 0));
 	MarkTileDirtyByTile(tile + TileDiffXY(0, 1));
 	MarkTileDirtyByTile(tile + TileDiffXY(1, 0));
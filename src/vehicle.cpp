@@ -573,12 +573,90 @@ void ResetVehicleColorMap()
 	FOR_ALL_VEHICLES(v) { v->colormap = PAL_NONE; }
 }
 
+/*
+ * The vehicles of each player and vehicle type that are, or can become,
+ * primary vehicles; front engines can be attached to other trains and become
+ * a primary vehicle again later on. It is built when it is first needed.
+ */
+static PlayerVehicles _player_vehicles[MAX_PLAYERS][VEH_AIRCRAFT + 1];
+static bool _player_vehicles_valid = false;
+
+/**
+ * Check whether a vehicle belongs in the player vehicle lists.
+ * @param v the vehicle to check
+ * @return true if it is, or can become, the primary vehicle of a player
+ */
+static bool IsInPlayerVehicles(const Vehicle *v)
+{
+	if (!IsValidPlayer(v->owner)) return false;
+
+	switch (v->type) {
+		case VEH_TRAIN:    return IsTrainEngine(v);
+		case VEH_ROAD:     return IsRoadVehFront(v);
+		case VEH_SHIP:     return true;
+		case VEH_AIRCRAFT: return IsNormalAircraft(v);
+		default:           return false;
+	}
+}
+
+/** Forget the player vehicle lists; they get rebuilt when they are needed. */
+static void ResetPlayerVehicles()
+{
+	for (PlayerID p = PLAYER_FIRST; p < MAX_PLAYERS; p++) {
+		for (VehicleType type = VEH_TRAIN; type <= VEH_AIRCRAFT; type++) _player_vehicles[p][type].clear();
+	}
+	_player_vehicles_valid = false;
+}
+
+/**
+ * Add a vehicle to the vehicle list of its owner; to be called when it has
+ * been built or got a new owner.
+ * @param v the vehicle
+ */
+void AddVehicleToPlayerVehicles(const Vehicle *v)
+{
+	if (_player_vehicles_valid && IsInPlayerVehicles(v)) _player_vehicles[v->owner][v->type].insert(v->index);
+}
+
+/**
+ * Remove a vehicle from the vehicle list of its owner; to be called when it
+ * is deleted or is going to get a new owner.
+ * @param v the vehicle
+ */
+void RemoveVehicleFromPlayerVehicles(const Vehicle *v)
+{
+	if (_player_vehicles_valid && IsInPlayerVehicles(v)) _player_vehicles[v->owner][v->type].erase(v->index);
+}
+
+/**
+ * Get the vehicles of a player and vehicle type that are, or can become,
+ * primary vehicles. They are sorted by their index.
+ * @param owner the player
+ * @param type  the vehicle type
+ * @return the vehicles; empty for invalid players and types
+ */
+const PlayerVehicles &GetPlayerVehicles(PlayerID owner, VehicleType type)
+{
+	static const PlayerVehicles empty;
+	if (!IsValidPlayer(owner) || type > VEH_AIRCRAFT) return empty;
+
+	if (!_player_vehicles_valid) {
+		_player_vehicles_valid = true;
+
+		const Vehicle *v;
+		FOR_ALL_VEHICLES(v) AddVehicleToPlayerVehicles(v);
+	}
+
+	return _player_vehicles[owner][type];
+}
+
 void InitializeVehicles()
 {
 	_Vehicle_pool.CleanPool();
 	_Vehicle_pool.AddBlockToPool();
 
 	ResetVehiclePosHash();
+	ResetPlayerVehicles();
 }
 
 Vehicle *GetLastVehicleInChain(Vehicle *v)
@@ -644,6 +722,7 @@ void Vehicle::PreDestructor()
 
 	this->cargo.Truncate(0);
 	DeleteVehicleOrders(this);
+	RemoveVehicleFromPlayerVehicles(this);
 
 	/* Now remove any artic part. This will trigger an other
 	 *  destroy vehicle, which on his turn can remove any
@@ -2093,17 +2172,14 @@ uint GenerateVehicleSortList(const Vehicle ***sort_list, uint16 *length_of_array
 
 	switch (window_type) {
 		case VLW_STATION_LIST: {
-			FOR_ALL_VEHICLES(v) {
-				if (v->type == type && v->IsPrimaryVehicle()) {
-					const Order *order;
+			const OrderDestinationVehicles *vehicles = GetVehiclesWithOrdersTo(OT_GOTO_STATION, index);
+			if (vehicles == NULL) break;
 
-					FOR_VEHICLE_ORDERS(v, order) {
-						if (order->type == OT_GOTO_STATION && order->dest == index) {
-							if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, 50);
-							(*sort_list)[n++] = v;
-							break;
-						}
-					}
+			for (OrderDestinationVehicles::const_iterator it = vehicles->begin(); it != vehicles->end(); it++) {
+				v = GetVehicle(it->first);
+				if (v->type == type && v->IsPrimaryVehicle()) {
+					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, 50);
+					(*sort_list)[n++] = v;
 				}
 			}
 			break;
@@ -2126,10 +2202,11 @@ uint GenerateVehicleSortList(const Vehicle ***sort_list, uint16 *length_of_array
 		}
 
 		case VLW_STANDARD: {
-			FOR_ALL_VEHICLES(v) {
-				if (v->type == type && v->owner == owner && v->IsPrimaryVehicle()) {
-					/* TODO find a better estimate on the total number of vehicles for current player */
-					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, GetNumVehicles()/4);
+			const PlayerVehicles &vehicles = GetPlayerVehicles(owner, type);
+			for (PlayerVehicles::const_iterator it = vehicles.begin(); it != vehicles.end(); it++) {
+				v = GetVehicle(*it);
+				if (v->IsPrimaryVehicle()) {
+					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, vehicles.size() - n);
 					(*sort_list)[n++] = v;
 				}
 			}
@@ -2137,32 +2214,31 @@ uint GenerateVehicleSortList(const Vehicle ***sort_list, uint16 *length_of_array
 		}
 
 		case VLW_DEPOT_LIST: {
-			FOR_ALL_VEHICLES(v) {
-				if (v->type == type && v->IsPrimaryVehicle()) {
-					const Order *order;
+			const OrderDestinationVehicles *vehicles = GetVehiclesWithOrdersTo(OT_GOTO_DEPOT, index);
+			if (vehicles == NULL) break;
 
-					FOR_VEHICLE_ORDERS(v, order) {
-						if (order->type == OT_GOTO_DEPOT && order->dest == index) {
-							if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, 25);
-							(*sort_list)[n++] = v;
-							break;
-						}
-					}
+			for (OrderDestinationVehicles::const_iterator it = vehicles->begin(); it != vehicles->end(); it++) {
+				v = GetVehicle(it->first);
+				if (v->type == type && v->IsPrimaryVehicle()) {
+					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, 25);
+					(*sort_list)[n++] = v;
 				}
 			}
 			break;
 		}
 
- 		case VLW_GROUP_LIST:
-			FOR_ALL_VEHICLES(v) {
-				if (v->type == type && v->IsPrimaryVehicle() &&
-						v->owner == owner && v->group_id == index) {
-					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, GetNumVehicles() / 4);
+ 		case VLW_GROUP_LIST: {
+			const PlayerVehicles &vehicles = GetPlayerVehicles(owner, type);
+			for (PlayerVehicles::const_iterator it = vehicles.begin(); it != vehicles.end(); it++) {
+				v = GetVehicle(*it);
+				if (v->IsPrimaryVehicle() && v->group_id == index) {
+					if (n == *length_of_array) ExtendVehicleListSize(sort_list, length_of_array, vehicles.size() - n);
 
 					(*sort_list)[n++] = v;
 				}
 			}
 			break;
+		}
 
 		default: NOT_REACHED(); break;
 	}
@@ -2880,7 +2956,7 @@ static const SaveLoad _common_veh_desc[] = {
 	SLEG_CONDVAR(         _cargo_source_xy,     SLE_UINT32,                 44, 67),
 	     SLE_VAR(Vehicle, cargo_cap,            SLE_UINT16),
 	SLEG_CONDVAR(         _cargo_count,         SLE_UINT16,                  0, 67),
-	 SLE_CONDLST(Vehicle, cargo,                REF_CARGO_PACKET,           68, SL_MAX_VERSION),
+	SLE_CONDDEQUE(Vehicle, cargo,               REF_CARGO_PACKET,           68, SL_MAX_VERSION),
 
 	    SLE_VAR(Vehicle, day_counter,          SLE_UINT8),
 	    SLE_VAR(Vehicle, tick_counter,         SLE_UINT8),
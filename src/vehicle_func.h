@@ -12,6 +12,8 @@
 #include "cargo_type.h"
 #include "command_type.h"
 #include "vehicle_type.h"
+#include "player_type.h"
+#include <set>
 
 #define is_custom_sprite(x) (x >= 0xFD)
 #define IS_CUSTOM_FIRSTHEAD_SPRITE(x) (x == 0xFD)
@@ -67,6 +69,13 @@ void TrainConsistChanged(Vehicle *v, bool same_length);
 void TrainPowerChanged(Vehicle *v);
 Money GetTrainRunningCost(const Vehicle *v);
 
+/** The vehicles of a player and vehicle type that are, or can become, primary vehicles. */
+typedef std::set<VehicleID> PlayerVehicles;
+
+void AddVehicleToPlayerVehicles(const Vehicle *v);
+void RemoveVehicleFromPlayerVehicles(const Vehicle *v);
+const PlayerVehicles &GetPlayerVehicles(PlayerID owner, VehicleType type);
+
 uint GenerateVehicleSortList(const Vehicle*** sort_list, uint16 *length_of_array, VehicleType type, PlayerID owner, uint32 index, uint16 window_type);
 void BuildDepotVehicleList(VehicleType type, TileIndex tile, Vehicle ***engine_list, uint16 *engine_list_length, uint16 *engine_count, Vehicle ***wagon_list, uint16 *wagon_list_length, uint16 *wagon_count);
 CommandCost SendAllVehiclesToDepot(VehicleType type, uint32 flags, bool service, PlayerID owner, uint16 vlw_flag, uint32 id);
@@ -142,6 +142,8 @@ const char *VideoDriver_Dedicated::Start(const char * const *parm)
 
 	_screen.width = _screen.pitch = _cur_resolution[0];
 	_screen.height = _cur_resolution[1];
+	/* Without a blitter nothing gets drawn, so do not bother marking things dirty */
+	_screen_headless = (bpp == 0);
 
 	SetDebugString("net=6");
 
@@ -247,6 +249,7 @@ static void DedicatedHandleKeyInput()
 void VideoDriver_Dedicated::MainLoop()
 {
 	uint32 cur_ticks = GetTime();
+	uint32 last_cur_ticks = cur_ticks;
 	uint32 next_tick = cur_ticks + 30;
 
 	/* Signal handlers */
@@ -297,6 +300,8 @@ void VideoDriver_Dedicated::MainLoop()
 
 		cur_ticks = GetTime();
 		if (cur_ticks >= next_tick || cur_ticks < prev_cur_ticks) {
+			_realtime_tick += cur_ticks - last_cur_ticks;
+			last_cur_ticks = cur_ticks;
 			next_tick = cur_ticks + 30;
 
 			GameLoop();
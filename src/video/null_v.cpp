@@ -20,6 +20,7 @@ const char *VideoDriver_Null::Start(const char* const *parm)
 	/* Do not render, nor blit */
 	DEBUG(misc, 1, "Forcing blitter 'null'...");
 	BlitterFactoryBase::SelectBlitter("null");
+	_screen_headless = true;
 	return NULL;
 }
 
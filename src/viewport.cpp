@@ -1748,6 +1748,8 @@ static void MarkViewportDirty(const ViewPort *vp, int left, int top, int right,
 
 void MarkAllViewportsDirty(int left, int top, int right, int bottom)
 {
+	if (_screen_headless) return;
+
 	const ViewPort *vp = _viewports;
 	uint32 act = _active_viewports;
 	do {
@@ -1760,6 +1762,10 @@ void MarkAllViewportsDirty(int left, int top, int right, int bottom)
 
 void MarkTileDirtyByTile(TileIndex tile)
 {
+	InvalidateSmallMapTile(tile);
+
+	if (_screen_headless) return;
+
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, GetTileZ(tile));
 	MarkAllViewportsDirty(
 		pt.x - 31,
@@ -1774,6 +1780,8 @@ void MarkTileDirty(int x, int y)
 	uint z = 0;
 	Point pt;
 
+	if (_screen_headless) return;
+
 	if (IsInsideMM(x, 0, MapSizeX() * TILE_SIZE) &&
 			IsInsideMM(y, 0, MapSizeY() * TILE_SIZE))
 		z = GetTileZ(TileVirtXY(x, y));
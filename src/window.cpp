@@ -30,6 +30,7 @@ static Point _drag_delta;
 static Window _windows[MAX_NUMBER_OF_WINDOWS];
 Window *_z_windows[lengthof(_windows)];
 Window **_last_z_window; ///< always points to the next free space in the z-array
+static byte _window_class_count[WC_END]; ///< number of windows of each class in the z-array
 
 Point _cursorpos_drag_start;
 
@@ -381,12 +382,28 @@ void DeleteWindow(Window *w)
 	if (wz == NULL) return;
 	memmove(wz, wz + 1, (byte*)_last_z_window - (byte*)wz);
 	_last_z_window--;
+	assert(_window_class_count[w->window_class] != 0);
+	_window_class_count[w->window_class]--;
+}
+
+/**
+ * Is there any window of the given class open? Most invalidations are for
+ * classes without any open window (and a dedicated server has no windows at
+ * all), so this lets the lookups below skip scanning the z-array.
+ * @param cls the window class to look for
+ * @return true if at least one window of this class is open
+ */
+static inline bool HasWindowOfClass(WindowClass cls)
+{
+	return _window_class_count[cls] != 0;
 }
 
 Window *FindWindowById(WindowClass cls, WindowNumber number)
 {
 	Window* const *wz;
 
+	if (!HasWindowOfClass(cls)) return NULL;
+
 	FOR_ALL_WINDOWS(wz) {
 		Window *w = *wz;
 		if (w->window_class == cls && w->window_number == number) return w;
@@ -404,6 +421,8 @@ void DeleteWindowByClass(WindowClass cls)
 {
 	Window* const *wz;
 
+	if (!HasWindowOfClass(cls)) return;
+
 restart_search:
 	/* When we find the window to delete, we need to restart the search
 	 * as deleting this window could cascade in deleting (many) others
@@ -680,6 +699,7 @@ static Window *LocalAllocateWindow(
 
 		*wz = w;
 		_last_z_window++;
+		_window_class_count[w->window_class]++;
 	}
 
 	WindowEvent e;
@@ -994,6 +1014,7 @@ void InitWindowSystem()
 
 	memset(&_windows, 0, sizeof(_windows));
 	_last_z_window = _z_windows;
+	memset(_window_class_count, 0, sizeof(_window_class_count));
 	InitViewports();
 	_no_scroll = 0;
 }
@@ -1628,6 +1649,8 @@ void SendWindowMessageClass(WindowClass wnd_class, int msg, int wparam, int lpar
 {
 	Window* const *wz;
 
+	if (!HasWindowOfClass(wnd_class)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		if ((*wz)->window_class == wnd_class) SendWindowMessageW(*wz, msg, wparam, lparam);
 	}
@@ -1978,6 +2001,8 @@ void InvalidateWindow(WindowClass cls, WindowNumber number)
 {
 	Window* const *wz;
 
+	if (_screen_headless || !HasWindowOfClass(cls)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		const Window *w = *wz;
 		if (w->window_class == cls && w->window_number == number) SetWindowDirty(w);
@@ -1988,6 +2013,8 @@ void InvalidateWindowWidget(WindowClass cls, WindowNumber number, byte widget_in
 {
 	Window* const *wz;
 
+	if (_screen_headless || !HasWindowOfClass(cls)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		const Window *w = *wz;
 		if (w->window_class == cls && w->window_number == number) {
@@ -2000,6 +2027,8 @@ void InvalidateWindowClasses(WindowClass cls)
 {
 	Window* const *wz;
 
+	if (_screen_headless || !HasWindowOfClass(cls)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		if ((*wz)->window_class == cls) SetWindowDirty(*wz);
 	}
@@ -2015,6 +2044,8 @@ void InvalidateWindowData(WindowClass cls, WindowNumber number)
 {
 	Window* const *wz;
 
+	if (!HasWindowOfClass(cls)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		Window *w = *wz;
 		if (w->window_class == cls && w->window_number == number) InvalidateThisWindowData(w);
@@ -2025,6 +2056,8 @@ void InvalidateWindowClassesData(WindowClass cls)
 {
 	Window* const *wz;
 
+	if (!HasWindowOfClass(cls)) return;
+
 	FOR_ALL_WINDOWS(wz) {
 		if ((*wz)->window_class == cls) InvalidateThisWindowData(*wz);
 	}
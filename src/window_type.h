@@ -90,6 +90,8 @@ enum WindowClass {
 	WC_VEHICLE_TIMETABLE,
 	WC_BUILD_SIGNAL,
 	WC_COMPANY_PASSWORD_WINDOW,
+
+	WC_END
 };
 
 struct Window;